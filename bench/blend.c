@@ -0,0 +1,131 @@
+// Draws an R8G8B8A8 image over R8G8B8A8 and R8G8B8 images with ImageDrawBlend(), straight and premultiplied
+// alpha, and compares it to the per pixel path: GetPixelColor(), a blend function and SetPixelColor() for every pixel
+#include "raylib.h"
+#include <stdio.h>
+#include <string.h>
+
+#define SIZE 2048
+#define RUNS 5
+#define THREADS 4
+
+// Premultiplied alpha blend, tint already premultiplied: out = src*tint + dst*(1 - src.a*tint.a)
+Color blend_premultiplied(Color dst, Color src, Color tint)
+{
+    unsigned char *d = &dst.r;
+    unsigned char *s = &src.r;
+    unsigned char *t = &tint.r;
+    Color out;
+    unsigned char *o = &out.r;
+
+    for (int c = 0; c < 4; c++) s[c] = s[c]*(t[c] + 1) >> 8;
+    for (int c = 0; c < 4; c++) {
+        int value = s[c] + (d[c]*(255 - s[3]) + 127)/255;
+        o[c] = (value > 255)? 255 : value;
+    }
+    return out;
+}
+
+// Previous ImageDraw() loop, for premultiplied alpha with the tint premultiplied as ImageDrawBlend() does
+void draw_per_pixel(Image *dst, Image src, Color tint, int mode)
+{
+    if (mode == BLEND_ALPHA_PREMULTIPLY) tint = (Color){ (tint.r*tint.a + 127)/255, (tint.g*tint.a + 127)/255, (tint.b*tint.a + 127)/255, tint.a };
+
+    int src_size = GetPixelDataSize(1, 1, src.format);
+    int dst_size = GetPixelDataSize(1, 1, dst->format);
+    unsigned char *s = src.data;
+    unsigned char *d = dst->data;
+    for (int i = 0; i < src.width*src.height; i++, s += src_size, d += dst_size) {
+        Color from = GetPixelColor(s, src.format);
+        Color to = GetPixelColor(d, dst->format);
+        SetPixelColor(d, (mode == BLEND_ALPHA)? ColorAlphaBlend(to, from, tint) : blend_premultiplied(to, from, tint), dst->format);
+    }
+}
+
+typedef struct {
+    double per_pixel; // ms of the per pixel path
+    double single;    // ms of ImageDrawBlend() on the calling thread only
+    double threaded;  // ms of ImageDrawBlend() with THREADS threads
+    bool same;        // all ways draw the same pixels
+} Result;
+
+// Best time of every way drawing src over a fresh copy of dst
+Result run(Image dst, Image src, Color tint, int mode)
+{
+    Result best = { .same = true };
+    Rectangle rec = { 0, 0, SIZE, SIZE };
+    for (int run = 0; run < RUNS; run++) {
+        Image reference = ImageCopy(dst);
+        double start = GetTime();
+        draw_per_pixel(&reference, src, tint, mode);
+        double end = GetTime();
+        if (run == 0 || end - start < best.per_pixel/1000) best.per_pixel = (end - start)*1000;
+
+        for (int threaded = 0; threaded < 2; threaded++) {
+            SetImageThreadCount(threaded ? THREADS : 1);
+            Image image = ImageCopy(dst);
+            start = GetTime();
+            ImageDrawBlend(&image, src, rec, rec, tint, mode);
+            end = GetTime();
+            double *time = threaded ? &best.threaded : &best.single;
+            if (run == 0 || end - start < *time/1000) *time = (end - start)*1000;
+            best.same = best.same && memcmp(image.data, reference.data, GetPixelDataSize(SIZE, SIZE, dst.format)) == 0;
+            UnloadImage(image);
+        }
+        UnloadImage(reference);
+    }
+    SetImageThreadCount(0);
+    return best;
+}
+
+int main(void)
+{
+    SetTraceLogLevel(LOG_WARNING);
+
+    // Sprite like source: a quarter transparent, a quarter opaque and the rest random alpha
+    SetRandomSeed(42);
+    Image straight = GenImageColor(SIZE, SIZE, BLANK);
+    Image premultiplied = GenImageColor(SIZE, SIZE, BLANK);
+    Image rgba = GenImageColor(SIZE, SIZE, BLANK);
+    Color *s = straight.data;
+    Color *p = premultiplied.data;
+    Color *d = rgba.data;
+    for (int i = 0; i < SIZE*SIZE; i++) {
+        int kind = GetRandomValue(0, 3);
+        unsigned char alpha = (kind == 0)? 0 : (kind == 1)? 255 : GetRandomValue(0, 255);
+        s[i] = (Color){ GetRandomValue(0, 255), GetRandomValue(0, 255), GetRandomValue(0, 255), alpha };
+        p[i] = (Color){ s[i].r*alpha/255, s[i].g*alpha/255, s[i].b*alpha/255, alpha };
+        d[i] = (Color){ GetRandomValue(0, 255), GetRandomValue(0, 255), GetRandomValue(0, 255), GetRandomValue(0, 255) };
+    }
+    Image rgb = ImageCopy(rgba);
+    ImageFormat(&rgb, PIXELFORMAT_UNCOMPRESSED_R8G8B8);
+
+    struct {
+        const char *name;
+        Image dst;
+        Image src;
+        Color tint;
+        int mode;
+    } cases[] = {
+        { "straight RGBA", rgba, straight, WHITE, BLEND_ALPHA },
+        { "straight RGBA tint", rgba, straight, (Color){ 200, 150, 100, 180 }, BLEND_ALPHA },
+        { "straight RGB", rgb, straight, WHITE, BLEND_ALPHA },
+        { "premultiplied RGBA", rgba, premultiplied, WHITE, BLEND_ALPHA_PREMULTIPLY },
+        { "premultiplied RGBA tint", rgba, premultiplied, (Color){ 200, 150, 100, 180 }, BLEND_ALPHA_PREMULTIPLY },
+        { "premultiplied RGB", rgb, premultiplied, WHITE, BLEND_ALPHA_PREMULTIPLY },
+    };
+
+    printf("blend: %dx%d R8G8B8A8 source, best of %d runs, %d threads by default\n", SIZE, SIZE, RUNS, GetImageThreadCount());
+    printf("    %-24s %10s %10s %10s %8s %10s\n", "case", "per pixel", "1 thread", "4 threads", "speedup", "output");
+    for (int i = 0; i < (int)(sizeof(cases)/sizeof(cases[0])); i++) {
+        Result result = run(cases[i].dst, cases[i].src, cases[i].tint, cases[i].mode);
+        double fastest = (result.single < result.threaded)? result.single : result.threaded;
+        printf("    %-24s %8.2fms %8.2fms %8.2fms %7.1fx %10s\n", cases[i].name, result.per_pixel, result.single, result.threaded,
+               result.per_pixel/fastest, result.same ? "same" : "DIFFERENT");
+    }
+
+    UnloadImage(straight);
+    UnloadImage(premultiplied);
+    UnloadImage(rgba);
+    UnloadImage(rgb);
+    return 0;
+}
@@ -0,0 +1,157 @@
+// Chains tint, contrast, brightness and invert on an image: with the previous functions, which convert to
+// an R8G8B8A8 copy and back with every call, with the current in place functions and fused with ImageColorOps()
+// NOTE: Outputs are compared to the current functions, the previous ones load 16 bit formats with LoadImageColors(),
+// which scales 5 and 6 bit channels with integer factors (255/31 = 8), so R5G6B5 differs from them. Fused operations
+// quantize to the image format once and not after every operation, they are compared to the current functions
+// applied to an R8G8B8A8 copy formatted back
+#include "raylib.h"
+#include <stdio.h>
+#include <string.h>
+
+#define SIZE 2048
+#define RUNS 5
+#define THREADS 4
+
+static const Color tint = { 230, 200, 180, 255 };
+
+// Previous ImageColor*() functions: load colors, modify them, replace image data and format it back
+void replace_colors(Image *image, Color *pixels)
+{
+    int format = image->format;
+    MemFree(image->data);
+    image->data = pixels;
+    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    ImageFormat(image, format);
+}
+
+void previous_tint(Image *image, Color color)
+{
+    Color *pixels = LoadImageColors(*image);
+    float c[4] = { (float)color.r/255, (float)color.g/255, (float)color.b/255, (float)color.a/255 };
+    for (int i = 0; i < image->width*image->height; i++) {
+        unsigned char *p = &pixels[i].r;
+        for (int k = 0; k < 4; k++) p[k] = (unsigned char)(((float)p[k]/255*c[k])*255.0f);
+    }
+    replace_colors(image, pixels);
+}
+
+void previous_contrast(Image *image, float contrast)
+{
+    contrast = (100.0f + contrast)/100.0f;
+    contrast *= contrast;
+    Color *pixels = LoadImageColors(*image);
+    for (int i = 0; i < image->width*image->height; i++) {
+        unsigned char *p = &pixels[i].r;
+        for (int k = 0; k < 3; k++) {
+            float value = ((float)p[k]/255.0f - 0.5f)*contrast;
+            value = (value + 0.5f)*255;
+            p[k] = (unsigned char)((value < 0)? 0 : (value > 255)? 255 : value);
+        }
+    }
+    replace_colors(image, pixels);
+}
+
+void previous_brightness(Image *image, int brightness)
+{
+    Color *pixels = LoadImageColors(*image);
+    for (int i = 0; i < image->width*image->height; i++) {
+        unsigned char *p = &pixels[i].r;
+        for (int k = 0; k < 3; k++) {
+            int value = p[k] + brightness;
+            p[k] = (value < 0)? 1 : (value > 255)? 255 : value;
+        }
+    }
+    replace_colors(image, pixels);
+}
+
+void previous_invert(Image *image)
+{
+    Color *pixels = LoadImageColors(*image);
+    for (int i = 0; i < image->width*image->height; i++) {
+        pixels[i].r = 255 - pixels[i].r;
+        pixels[i].g = 255 - pixels[i].g;
+        pixels[i].b = 255 - pixels[i].b;
+    }
+    replace_colors(image, pixels);
+}
+
+typedef enum { PREVIOUS, FUNCTIONS, FUSED, FUSED_THREADS, WAYS } Way;
+static const char *way_names[WAYS] = { "previous", "functions", "fused", "fused threads" };
+
+void adjust(Image *image, Way way)
+{
+    ImageColorOp ops[] = {
+        { .type = IMAGE_COLOR_TINT, .color = tint },
+        { .type = IMAGE_COLOR_CONTRAST, .value = 30 },
+        { .type = IMAGE_COLOR_BRIGHTNESS, .value = -20 },
+        { .type = IMAGE_COLOR_INVERT },
+    };
+    switch (way) {
+    case PREVIOUS:
+        previous_tint(image, tint);
+        previous_contrast(image, 30);
+        previous_brightness(image, -20);
+        previous_invert(image);
+        break;
+    case FUNCTIONS:
+        ImageColorTint(image, tint);
+        ImageColorContrast(image, 30);
+        ImageColorBrightness(image, -20);
+        ImageColorInvert(image);
+        break;
+    default:
+        SetImageThreadCount((way == FUSED_THREADS)? THREADS : 1);
+        ImageColorOps(image, ops, sizeof(ops)/sizeof(ops[0]));
+        SetImageThreadCount(0);
+        break;
+    }
+}
+
+int main(void)
+{
+    SetTraceLogLevel(LOG_WARNING);
+
+    SetRandomSeed(42);
+    Image colors = GenImageColor(SIZE, SIZE, BLANK);
+    unsigned char *bytes = colors.data;
+    for (int i = 0; i < SIZE*SIZE*4; i++) bytes[i] = GetRandomValue(0, 255);
+
+    int formats[] = { PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, PIXELFORMAT_UNCOMPRESSED_R8G8B8, PIXELFORMAT_UNCOMPRESSED_R5G6B5 };
+    const char *format_names[] = { "R8G8B8A8", "R8G8B8", "R5G6B5" };
+
+    printf("colorops: %dx%d image, tint + contrast + brightness + invert, best of %d runs\n", SIZE, SIZE, RUNS);
+    printf("    %-10s %-14s %10s %8s %10s\n", "format", "way", "time", "speedup", "output");
+    for (int f = 0; f < 3; f++) {
+        Image source = ImageCopy(colors);
+        ImageFormat(&source, formats[f]);
+        Image reference = ImageCopy(source);
+        adjust(&reference, FUNCTIONS);
+        Image reference_fused = ImageCopy(source);
+        ImageFormat(&reference_fused, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+        adjust(&reference_fused, FUNCTIONS);
+        ImageFormat(&reference_fused, formats[f]);
+        double best[WAYS] = { 0 };
+        for (int way = 0; way < WAYS; way++) {
+            bool same = true;
+            for (int run = 0; run < RUNS; run++) {
+                Image image = ImageCopy(source);
+                double start = GetTime();
+                adjust(&image, way);
+                double end = GetTime();
+                if (run == 0 || end - start < best[way]/1000) best[way] = (end - start)*1000;
+
+                Image expected = (way >= FUSED)? reference_fused : reference;
+                same = same && memcmp(image.data, expected.data, GetPixelDataSize(SIZE, SIZE, formats[f])) == 0;
+                UnloadImage(image);
+            }
+            printf("    %-10s %-14s %8.2fms %7.1fx %10s\n", format_names[f], way_names[way], best[way], best[PREVIOUS]/best[way],
+                   same ? "same" : "DIFFERENT");
+        }
+        UnloadImage(reference);
+        UnloadImage(reference_fused);
+        UnloadImage(source);
+    }
+
+    UnloadImage(colors);
+    return 0;
+}
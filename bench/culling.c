@@ -0,0 +1,77 @@
+// Draws a large grid of meshes with a camera that only sees part of it, with and without frustum culling
+#include "raylib.h"
+#include "rlgl.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#define GRID 40
+#define FRAMES 30
+
+typedef struct {
+    double frame;     // ms of the whole frame
+    int culled;       // meshes culled in the last frame
+    int tested;       // meshes checked against the frustum in the last frame
+    Image image;      // last frame, culling must not change it
+} Result;
+
+// Best frame of the run, the camera turns around the center of the grid
+Result run(Model model, bool culling)
+{
+    Camera camera = { .position = { 0, 8, 0 }, .up = { 0, 1, 0 }, .fovy = 60, .projection = CAMERA_PERSPECTIVE };
+    if (culling) EnableMeshCulling();
+    else DisableMeshCulling();
+
+    Result best = {0};
+    for (int frame = 0; frame < FRAMES; frame++) {
+        float angle = frame*2*PI/FRAMES;
+        camera.target = (Vector3){ 10*cosf(angle), 0, 10*sinf(angle) };
+
+        double start = GetTime();
+        BeginDrawing();
+        ClearBackground(RAYWHITE);
+        BeginMode3D(camera);
+        for (int z = 0; z < GRID; z++) {
+            for (int x = 0; x < GRID; x++) {
+                DrawModel(model, (Vector3){ (x - GRID/2)*3.0f, 0, (z - GRID/2)*3.0f }, 1, (x + z)%2 ? MAROON : DARKBLUE);
+            }
+        }
+        EndMode3D();
+        if (frame == FRAMES - 1) best.image = LoadImageFromScreen();
+        EndDrawing();
+        double end = GetTime();
+
+        if (frame == 0 || end - start < best.frame/1000) best.frame = (end - start)*1000;
+    }
+
+    // NOTE: statistics are the ones of the last finished frame
+    rlFrameStats stats = rlGetFrameStats();
+    best.culled = stats.culledCount;
+    best.tested = stats.cullTests;
+    DisableMeshCulling();
+    return best;
+}
+
+int main(void)
+{
+    SetTraceLogLevel(LOG_WARNING);
+    InitWindow(800, 600, "bench culling");
+
+    Model model = LoadModelFromMesh(GenMeshSphere(1, 16, 16));
+
+    Result all = run(model, false);
+    Result culled = run(model, true);
+
+    printf("culling: %d meshes of %d vertices, best of %d frames\n", GRID*GRID, model.meshes[0].vertexCount, FRAMES);
+    bool same = memcmp(all.image.data, culled.image.data, GetPixelDataSize(all.image.width, all.image.height, all.image.format)) == 0;
+    printf("    %-10s %10s %14s %10s\n", "culling", "frame", "culled", "output");
+    printf("    %-10s %8.2fms %14s %10s\n", "off", all.frame, "-", "-");
+    printf("    %-10s %8.2fms %8d/%5d %10s\n", "on", culled.frame, culled.culled, culled.tested, same ? "same" : "DIFFERENT");
+
+    UnloadImage(all.image);
+    UnloadImage(culled.image);
+
+    UnloadModel(model);
+    CloseWindow();
+    return 0;
+}
@@ -0,0 +1,139 @@
+// Draws the same mixed scene of sprites, health bars and labels immediately and in deferred mode,
+// where the draw commands are sorted by layer and texture before they reach the render batch
+#include "raylib.h"
+#include "rlgl.h"
+#include <stdio.h>
+
+#define ENTITIES 1000
+#define SPRITES 4
+#define FRAMES 120
+
+typedef struct {
+    Vector2 position;
+    Vector2 velocity;
+    int sprite;
+    int health;
+} Entity;
+
+static Entity entities[ENTITIES];
+static Texture2D sprites[SPRITES];
+
+void update_entities(void)
+{
+    for (int i = 0; i < ENTITIES; i++) {
+        Entity *e = &entities[i];
+        e->position.x += e->velocity.x;
+        e->position.y += e->velocity.y;
+        if (e->position.x < 0 || e->position.x > GetScreenWidth() - 32) e->velocity.x = -e->velocity.x;
+        if (e->position.y < 0 || e->position.y > GetScreenHeight() - 32) e->velocity.y = -e->velocity.y;
+    }
+}
+
+// Every entity draws its sprite, its health bar and its label, switching textures all the time
+void draw_entities(bool deferred)
+{
+    for (int i = 0; i < ENTITIES; i++) {
+        Entity *e = &entities[i];
+        int x = (int)e->position.x;
+        int y = (int)e->position.y;
+
+        if (deferred) SetDrawLayer(0);
+        DrawTexture(sprites[e->sprite], x, y, WHITE);
+        if (deferred) SetDrawLayer(1);
+        DrawRectangle(x, y - 6, 32, 4, DARKGRAY);
+        DrawRectangle(x, y - 6, 32*e->health/100, 4, GREEN);
+        DrawText(TextFormat("%d", i), x, y + 34, 10, BLACK);
+    }
+}
+
+typedef struct {
+    double submit;    // ms to issue the draw commands, for deferred mode including their replay
+    double frame;     // ms of the whole frame, including rendering and presenting it
+    int draw_calls;   // after sorting, what deferred mode issues
+    int draw_calls_recorded; // in recorded order, what immediate mode issues
+} Result;
+
+// Best frame of the run
+Result run(bool deferred)
+{
+    Result best = {0};
+    for (int frame = 0; frame < FRAMES; frame++) {
+        update_entities();
+        double start = GetTime();
+        BeginDrawing();
+        ClearBackground(RAYWHITE);
+        if (deferred) BeginDeferredMode();
+        draw_entities(deferred);
+        if (deferred) EndDeferredMode();
+        double submitted = GetTime();
+        EndDrawing();
+        double end = GetTime();
+
+        if (frame == 0 || submitted - start < best.submit/1000) best.submit = (submitted - start)*1000;
+        if (frame == 0 || end - start < best.frame/1000) best.frame = (end - start)*1000;
+        if (deferred) {
+            // NOTE: statistics cover the deferred mode since it was last begun, so this frame
+            rlDeferredStats stats = rlGetDeferredStats();
+            best.draw_calls = stats.drawCallsSorted;
+            best.draw_calls_recorded = stats.drawCallsRecorded;
+        }
+    }
+    return best;
+}
+
+// A sprite drawn right after a line has to sample its texture: DrawTexture() sets the texture before
+// rlBegin() opens the quads draw, which with RLGL_MULTI_TEXTURE_BATCH comes after the lines draw
+bool check_line_then_texture(bool deferred)
+{
+    BeginDrawing();
+    ClearBackground(BLACK);
+    if (deferred) BeginDeferredMode();
+    DrawLine(0, 0, 50, 50, WHITE);
+    DrawTexture(sprites[0], 100, 100, WHITE);
+    if (deferred) EndDeferredMode();
+    rlDrawRenderBatchActive();
+    Image screen = LoadImageFromScreen();
+    EndDrawing();
+
+    Color pixel = GetImageColor(screen, 102, 102);    // First checker of the sprite
+    UnloadImage(screen);
+    return pixel.r == RED.r && pixel.g == RED.g && pixel.b == RED.b;
+}
+
+int main(void)
+{
+    SetTraceLogLevel(LOG_WARNING);
+    InitWindow(800, 600, "bench draw2d");
+
+    Color colors[SPRITES] = { RED, BLUE, ORANGE, PURPLE };
+    for (int i = 0; i < SPRITES; i++) {
+        Image image = GenImageChecked(32, 32, 8, 8, colors[i], WHITE);
+        sprites[i] = LoadTextureFromImage(image);
+        UnloadImage(image);
+    }
+
+    SetRandomSeed(42);
+    for (int i = 0; i < ENTITIES; i++) {
+        entities[i] = (Entity){
+            .position = { (float)GetRandomValue(0, 760), (float)GetRandomValue(0, 560) },
+            .velocity = { GetRandomValue(-20, 20)/10.0f, GetRandomValue(-20, 20)/10.0f },
+            .sprite = GetRandomValue(0, SPRITES - 1),
+            .health = GetRandomValue(10, 100),
+        };
+    }
+
+    bool textured = check_line_then_texture(false) && check_line_then_texture(true);
+
+    Result immediate = run(false);
+    Result deferred = run(true);
+
+    printf("draw2d: %d entities, best of %d frames\n", ENTITIES, FRAMES);
+    printf("    %-10s %10s %10s %11s\n", "mode", "submit", "frame", "draw calls");
+    printf("    %-10s %8.2fms %8.2fms %11d\n", "immediate", immediate.submit, immediate.frame, deferred.draw_calls_recorded);
+    printf("    %-10s %8.2fms %8.2fms %11d\n", "deferred", deferred.submit, deferred.frame, deferred.draw_calls);
+    printf("    texture drawn after a line: %s\n", textured ? "textured" : "WRONG TEXTURE");
+
+    for (int i = 0; i < SPRITES; i++) UnloadTexture(sprites[i]);
+    CloseWindow();
+    return textured ? 0 : 1;
+}
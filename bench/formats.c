@@ -0,0 +1,123 @@
+// Converts an image between every pair of uncompressed pixel formats with ImageFormat() and compares
+// it to the float path: pixels normalized to floats (as LoadImageDataNormalized() does) and packed back
+#include "raylib.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#define SIZE 1024
+#define RUNS 3
+
+static const char *format_names[] = {
+    "", "GRAYSCALE", "GRAY_ALPHA", "R5G6B5", "R8G8B8", "R5G5B5A1", "R4G4B4A4", "R8G8B8A8",
+    "R32", "R32G32B32", "R32G32B32A32", "R16", "R16G16B16", "R16G16B16A16",
+};
+
+#define FORMAT_COUNT ((int)(sizeof(format_names)/sizeof(format_names[0])))
+
+// Source formats ImageFormat() converts without floats
+bool direct_source(int format)
+{
+    return format <= PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+}
+
+// Image normalized to R32G32B32A32 with the math of LoadImageDataNormalized(), only for direct source formats
+Image normalize(Image image)
+{
+    Image result = { MemAlloc(image.width*image.height*4*sizeof(float)), image.width, image.height, 1, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32 };
+    float *f = result.data;
+    unsigned char *s = image.data;
+    unsigned short *s16 = image.data;
+
+    for (int i = 0; i < image.width*image.height; i++, f += 4) {
+        switch (image.format) {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: f[0] = f[1] = f[2] = (float)s[i]/255.0f; f[3] = 1.0f; break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: f[0] = f[1] = f[2] = (float)s[i*2]/255.0f; f[3] = (float)s[i*2 + 1]/255.0f; break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+            f[0] = (float)(s16[i] >> 11)*(1.0f/31); f[1] = (float)((s16[i] >> 5) & 0x3f)*(1.0f/63); f[2] = (float)(s16[i] & 0x1f)*(1.0f/31); f[3] = 1.0f;
+            break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+            for (int c = 0; c < 3; c++) f[c] = (float)s[i*3 + c]/255.0f;
+            f[3] = 1.0f;
+            break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+            f[0] = (float)(s16[i] >> 11)*(1.0f/31); f[1] = (float)((s16[i] >> 6) & 0x1f)*(1.0f/31); f[2] = (float)((s16[i] >> 1) & 0x1f)*(1.0f/31);
+            f[3] = (s16[i] & 1)? 1.0f : 0.0f;
+            break;
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+            for (int c = 0; c < 4; c++) f[c] = (float)((s16[i] >> (12 - 4*c)) & 0xf)*(1.0f/15);
+            break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+            for (int c = 0; c < 4; c++) f[c] = (float)s[i*4 + c]/255.0f;
+            break;
+        }
+    }
+    return result;
+}
+
+typedef struct {
+    double direct;    // ms of ImageFormat()
+    double reference; // ms of the float path, normalizing and ImageFormat() from R32G32B32A32
+    bool same;        // ImageFormat() gives the same data as the float path
+} Result;
+
+Result run(Image source, int format)
+{
+    Result best = { .same = true };
+    for (int run = 0; run < RUNS; run++) {
+        Image direct = ImageCopy(source);
+        double start = GetTime();
+        ImageFormat(&direct, format);
+        double end = GetTime();
+        if (run == 0 || end - start < best.direct/1000) best.direct = (end - start)*1000;
+
+        if (direct_source(source.format)) {
+            start = GetTime();
+            Image reference = normalize(source);
+            ImageFormat(&reference, format);
+            end = GetTime();
+            if (run == 0 || end - start < best.reference/1000) best.reference = (end - start)*1000;
+
+            best.same = best.same && memcmp(direct.data, reference.data, GetPixelDataSize(SIZE, SIZE, format)) == 0;
+            UnloadImage(reference);
+        }
+        UnloadImage(direct);
+    }
+    return best;
+}
+
+int main(void)
+{
+    SetTraceLogLevel(LOG_WARNING);
+
+    // Random colors and alpha, with every byte value in every channel
+    SetRandomSeed(42);
+    Image colors = GenImageColor(SIZE, SIZE, BLANK);
+    unsigned char *bytes = colors.data;
+    for (int i = 0; i < SIZE*SIZE*4; i++) bytes[i] = (i < 256*4)? i/4 : GetRandomValue(0, 255);
+
+    printf("formats: %dx%d image, best of %d runs\n", SIZE, SIZE, RUNS);
+    printf("    %-13s %-13s %10s %10s %8s %10s\n", "from", "to", "float", "direct", "speedup", "output");
+    double total_reference = 0, total_direct = 0;
+    for (int from = 1; from < FORMAT_COUNT; from++) {
+        Image source = ImageCopy(colors);
+        ImageFormat(&source, from);
+        for (int to = 1; to < FORMAT_COUNT; to++) {
+            if (to == from) continue;
+            Result result = run(source, to);
+            if (direct_source(from)) {
+                total_reference += result.reference;
+                total_direct += result.direct;
+                printf("    %-13s %-13s %8.2fms %8.2fms %7.1fx %10s\n", format_names[from], format_names[to], result.reference, result.direct,
+                       result.reference/result.direct, result.same ? "same" : "DIFFERENT");
+            } else {
+                printf("    %-13s %-13s %10s %8.2fms %8s %10s\n", format_names[from], format_names[to], "-", result.direct, "-", "float");
+            }
+        }
+        UnloadImage(source);
+    }
+    printf("    direct formats pairs: float %.2fms, direct %.2fms, %.1fx\n", total_reference, total_direct, total_reference/total_direct);
+
+    UnloadImage(colors);
+    return 0;
+}
@@ -0,0 +1,179 @@
+// Generates 4K perlin noise, cellular and white noise images: with the previous per pixel loops, with the current
+// functions on the calling thread only and with worker threads, and as 1024x1024 tiles with the GenImage*Rec() functions
+// NOTE: White noise uses a seeded hash and not GetRandomValue() per pixel any more, only its white pixel ratio is compared
+#include "raylib.h"
+#include "external/stb_perlin.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define WIDTH 3840
+#define HEIGHT 2160
+#define TILE 1024
+#define RUNS 3
+#define THREADS 4
+#define CELL 64
+#define SEED 42
+
+typedef enum { PERLIN, CELLULAR, WHITE_NOISE, GENERATORS } Generator;
+static const char *generator_names[GENERATORS] = { "perlin", "cellular", "white noise" };
+
+// Previous GenImagePerlinNoise()
+Image previous_perlin(int width, int height, int offsetX, int offsetY, float scale)
+{
+    Color *pixels = MemAlloc(width*height*sizeof(Color));
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            float nx = (float)(x + offsetX)*(scale/(float)width);
+            float ny = (float)(y + offsetY)*(scale/(float)height);
+            float p = stb_perlin_fbm_noise3(nx, ny, 1.0f, 2.0f, 0.5f, 6);
+            if (p < -1.0f) p = -1.0f;
+            if (p > 1.0f) p = 1.0f;
+            int intensity = (int)((p + 1.0f)/2.0f*255.0f);
+            pixels[y*width + x] = (Color){ intensity, intensity, intensity, 255 };
+        }
+    }
+    return (Image){ pixels, width, height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+}
+
+// Previous GenImageCellular(): distances with hypot() to the seeds of the 3x3 adjacent tiles
+Image previous_cellular(int width, int height, int tileSize)
+{
+    Color *pixels = MemAlloc(width*height*sizeof(Color));
+    int seedsPerRow = width/tileSize;
+    int seedsPerCol = height/tileSize;
+    int seedCount = seedsPerRow*seedsPerCol;
+    Vector2 *seeds = MemAlloc(seedCount*sizeof(Vector2));
+    for (int i = 0; i < seedCount; i++) {
+        int y = (i/seedsPerRow)*tileSize + GetRandomValue(0, tileSize - 1);
+        int x = (i%seedsPerRow)*tileSize + GetRandomValue(0, tileSize - 1);
+        seeds[i] = (Vector2){ (float)x, (float)y };
+    }
+    for (int y = 0; y < height; y++) {
+        int tileY = y/tileSize;
+        for (int x = 0; x < width; x++) {
+            int tileX = x/tileSize;
+            float minDistance = 65536.0f;
+            for (int i = -1; i < 2; i++) {
+                if (tileX + i < 0 || tileX + i >= seedsPerRow) continue;
+                for (int j = -1; j < 2; j++) {
+                    if (tileY + j < 0 || tileY + j >= seedsPerCol) continue;
+                    Vector2 neighborSeed = seeds[(tileY + j)*seedsPerRow + tileX + i];
+                    float dist = (float)hypot(x - (int)neighborSeed.x, y - (int)neighborSeed.y);
+                    minDistance = (float)fmin(minDistance, dist);
+                }
+            }
+            int intensity = (int)(minDistance*256.0f/tileSize);
+            if (intensity > 255) intensity = 255;
+            pixels[y*width + x] = (Color){ intensity, intensity, intensity, 255 };
+        }
+    }
+    MemFree(seeds);
+    return (Image){ pixels, width, height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+}
+
+// Previous GenImageWhiteNoise(): GetRandomValue() for every pixel
+Image previous_white_noise(int width, int height, float factor)
+{
+    Color *pixels = MemAlloc(width*height*sizeof(Color));
+    for (int i = 0; i < width*height; i++) pixels[i] = (GetRandomValue(0, 99) < (int)(factor*100.0f))? WHITE : BLACK;
+    return (Image){ pixels, width, height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+}
+
+Image generate(Generator generator, bool previous)
+{
+    SetRandomSeed(SEED);
+    switch (generator) {
+    case PERLIN: return previous ? previous_perlin(WIDTH, HEIGHT, 0, 0, 8) : GenImagePerlinNoise(WIDTH, HEIGHT, 0, 0, 8);
+    case CELLULAR: return previous ? previous_cellular(WIDTH, HEIGHT, CELL) : GenImageCellular(WIDTH, HEIGHT, CELL);
+    default: return previous ? previous_white_noise(WIDTH, HEIGHT, 0.3f) : GenImageWhiteNoise(WIDTH, HEIGHT, 0.3f);
+    }
+}
+
+Image generate_rec(Generator generator, Rectangle rec)
+{
+    switch (generator) {
+    case PERLIN: return GenImagePerlinNoiseRec(WIDTH, HEIGHT, rec, 0, 0, 8);
+    case CELLULAR: return GenImageCellularRec(WIDTH, HEIGHT, rec, CELL, SEED);
+    default: return GenImageWhiteNoiseRec(WIDTH, HEIGHT, rec, 0.3f, SEED);
+    }
+}
+
+double white_ratio(Image image)
+{
+    Color *pixels = image.data;
+    int white = 0;
+    for (int i = 0; i < image.width*image.height; i++) white += pixels[i].r == 255;
+    return (double)white/(image.width*image.height);
+}
+
+bool same_pixels(Image a, Image b)
+{
+    return a.width == b.width && a.height == b.height && memcmp(a.data, b.data, a.width*a.height*sizeof(Color)) == 0;
+}
+
+// Full image generated as tiles drawn into one image, compared to the full region generated at once
+double tiled(Generator generator, Image full, bool *same)
+{
+    Image image = GenImageColor(WIDTH, HEIGHT, BLANK);
+    double start = GetTime();
+    for (int y = 0; y < HEIGHT; y += TILE) {
+        for (int x = 0; x < WIDTH; x += TILE) {
+            Rectangle rec = { x, y, TILE, TILE };
+            Image tile = generate_rec(generator, rec);
+            Rectangle src = { 0, 0, tile.width, tile.height };
+            ImageDraw(&image, tile, src, (Rectangle){ x, y, tile.width, tile.height }, WHITE);
+            UnloadImage(tile);
+        }
+    }
+    double end = GetTime();
+    *same = same_pixels(image, full);
+    UnloadImage(image);
+    return (end - start)*1000;
+}
+
+int main(void)
+{
+    SetTraceLogLevel(LOG_WARNING);
+
+    printf("noise: %dx%d images, %dx%d tiles, best of %d runs, %d threads by default\n", WIDTH, HEIGHT, TILE, TILE, RUNS, GetImageThreadCount());
+    printf("    %-12s %10s %10s %10s %8s %10s %10s %10s\n", "generator", "previous", "1 thread", "4 threads", "speedup", "output",
+           "tiles", "tiled");
+    for (int g = 0; g < GENERATORS; g++) {
+        double best[3] = { 0 };
+        bool same = true;
+        Image previous = { 0 };
+        for (int run = 0; run < RUNS; run++) {
+            for (int way = 0; way < 3; way++) {
+                SetImageThreadCount((way == 2)? THREADS : 1);
+                double start = GetTime();
+                Image image = generate(g, way == 0);
+                double end = GetTime();
+                if (run == 0 || end - start < best[way]/1000) best[way] = (end - start)*1000;
+
+                if (way == 0) {
+                    if (run == 0) previous = image;
+                    else UnloadImage(image);
+                    continue;
+                }
+                if (g == WHITE_NOISE) same = same && fabs(white_ratio(image) - white_ratio(previous)) < 0.005;
+                else same = same && same_pixels(image, previous);
+                UnloadImage(image);
+            }
+        }
+        SetImageThreadCount(0);
+        UnloadImage(previous);
+
+        // NOTE: Cellular tiles use hashed cell seeds, they are compared to the full GenImageCellularRec() image
+        Image full = generate_rec(g, (Rectangle){ 0, 0, WIDTH, HEIGHT });
+        bool tiles_same = false;
+        double time = tiled(g, full, &tiles_same);
+        UnloadImage(full);
+
+        double fastest = (best[1] < best[2])? best[1] : best[2];
+        printf("    %-12s %8.2fms %8.2fms %8.2fms %7.1fx %10s %8.2fms %10s\n", generator_names[g], best[0], best[1], best[2],
+               best[0]/fastest, same ? "same" : "DIFFERENT", time, tiles_same ? "same" : "DIFFERENT");
+    }
+    return 0;
+}
@@ -0,0 +1,136 @@
+// Resizes 4K and 8K images with ImageResize() and generates their mipmaps with ImageMipmaps(), on the calling
+// thread only and with worker threads, mipmaps are compared to the previous generation: an ImageResize() per level
+#include "raylib.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define RUNS 3
+#define THREADS 4
+
+typedef struct {
+    double single;    // ms on the calling thread only
+    double threaded;  // ms with THREADS threads
+    bool same;        // both give the same pixels
+} Result;
+
+// Image resized to the given size, or its mipmaps generated with size 0
+Image process(Image source, int width, int height)
+{
+    Image image = ImageCopy(source);
+    if (width == 0) ImageMipmaps(&image);
+    else ImageResize(&image, width, height);
+    return image;
+}
+
+Result run(Image source, int width, int height)
+{
+    Result best = { .same = true };
+    for (int run = 0; run < RUNS; run++) {
+        Image images[2];
+        for (int threaded = 0; threaded < 2; threaded++) {
+            SetImageThreadCount(threaded ? THREADS : 1);
+            double start = GetTime();
+            images[threaded] = process(source, width, height);
+            double end = GetTime();
+            double *time = threaded ? &best.threaded : &best.single;
+            if (run == 0 || end - start < *time/1000) *time = (end - start)*1000;
+        }
+        int size = GetPixelDataSize(images[0].width, images[0].height, images[0].format);
+        for (int level = 1, w = images[0].width, h = images[0].height; level < images[0].mipmaps; level++) {
+            w = (w > 1)? w/2 : 1;
+            h = (h > 1)? h/2 : 1;
+            size += GetPixelDataSize(w, h, images[0].format);
+        }
+        best.same = best.same && images[0].mipmaps == images[1].mipmaps && memcmp(images[0].data, images[1].data, size) == 0;
+        UnloadImage(images[0]);
+        UnloadImage(images[1]);
+    }
+    SetImageThreadCount(0);
+    return best;
+}
+
+// Previous ImageMipmaps(): every level resized from the previous one with ImageResize(), on the calling thread
+double previous_mipmaps(Image source, Image *result)
+{
+    double start = GetTime();
+    int size = 0;
+    int levels = 0;
+    for (int w = source.width, h = source.height; ; w = (w > 1)? w/2 : 1, h = (h > 1)? h/2 : 1) {
+        size += GetPixelDataSize(w, h, source.format);
+        levels++;
+        if (w == 1 && h == 1) break;
+    }
+    unsigned char *data = MemAlloc(size);
+    unsigned char *next = data + GetPixelDataSize(source.width, source.height, source.format);
+    memcpy(data, source.data, next - data);
+    Image level = ImageCopy(source);
+    for (int i = 1; i < levels; i++) {
+        ImageResize(&level, (level.width > 1)? level.width/2 : 1, (level.height > 1)? level.height/2 : 1);
+        int levelSize = GetPixelDataSize(level.width, level.height, level.format);
+        memcpy(next, level.data, levelSize);
+        next += levelSize;
+    }
+    UnloadImage(level);
+    double end = GetTime();
+    *result = (Image){ data, source.width, source.height, levels, source.format };
+    return (end - start)*1000;
+}
+
+// Mean absolute difference of the mipmap levels below the base one, 0 to 255
+double mipmaps_difference(Image a, Image b)
+{
+    int offset = GetPixelDataSize(a.width, a.height, a.format);
+    int size = 0;
+    for (int level = 1, w = a.width, h = a.height; level < a.mipmaps; level++) {
+        w = (w > 1)? w/2 : 1;
+        h = (h > 1)? h/2 : 1;
+        size += GetPixelDataSize(w, h, a.format);
+    }
+    unsigned char *pa = (unsigned char *)a.data + offset;
+    unsigned char *pb = (unsigned char *)b.data + offset;
+    double sum = 0;
+    for (int i = 0; i < size; i++) sum += abs(pa[i] - pb[i]);
+    return sum/size;
+}
+
+int main(void)
+{
+    SetTraceLogLevel(LOG_WARNING);
+
+    struct { const char *name; int width; int height; } sizes[] = { { "4K", 3840, 2160 }, { "8K", 7680, 4320 } };
+
+    printf("resize: R8G8B8A8 images, best of %d runs, %d threads by default\n", RUNS, GetImageThreadCount());
+    printf("    %-4s %-22s %10s %10s %8s %10s\n", "size", "operation", "1 thread", "4 threads", "speedup", "output");
+    for (int s = 0; s < 2; s++) {
+        int width = sizes[s].width;
+        int height = sizes[s].height;
+        Image source = GenImagePerlinNoise(width, height, 0, 0, 8);
+        ImageDrawRectangle(&source, width/4, height/4, width/2, height/2, Fade(RED, 0.5f));
+
+        struct { const char *name; int width; int height; } operations[] = {
+            { "ImageResize() to 1/2", width/2, height/2 },
+            { "ImageResize() to 1/3", width/3, height/3 },
+            { "ImageResize() to 1.5x", width*3/2, height*3/2 },
+            { "ImageMipmaps()", 0, 0 },
+        };
+        for (int o = 0; o < 4; o++) {
+            if (s == 1 && operations[o].width > width) continue;   // Skip 12K
+            Result result = run(source, operations[o].width, operations[o].height);
+            printf("    %-4s %-22s %8.2fms %8.2fms %7.1fx %10s\n", sizes[s].name, operations[o].name, result.single, result.threaded,
+                   result.single/result.threaded, result.same ? "same" : "DIFFERENT");
+        }
+
+        Image previous = { 0 };
+        SetImageThreadCount(1);
+        double time = previous_mipmaps(source, &previous);
+        Image current = process(source, 0, 0);
+        SetImageThreadCount(0);
+        printf("    %-4s %-22s %8.2fms %10s %8s %10s\n", sizes[s].name, "previous mipmaps", time, "-", "-", "-");
+        printf("         box filter levels differ from previous ones by %.2f/255 on average\n", mipmaps_difference(previous, current));
+        UnloadImage(previous);
+        UnloadImage(current);
+        UnloadImage(source);
+    }
+    return 0;
+}
@@ -0,0 +1,128 @@
+// Draws the same particles from a sprite atlas with DrawTexturePro() in a loop and with
+// DrawSpriteInstances(), which streams them as 32 bytes instances into one instanced draw call
+#include "raylib.h"
+#include "rlgl.h"
+#include <stdio.h>
+#include <string.h>
+
+#define PARTICLES 1000000
+#define SPRITES 4
+#define SPRITE_SIZE 8
+#define FRAMES 5
+
+static SpriteInstance particles[PARTICLES];
+static Vector2 velocities[PARTICLES];
+static Texture2D atlas;
+
+void init_particles(void)
+{
+    SetRandomSeed(42);
+    for (int i = 0; i < PARTICLES; i++) {
+        int sprite = GetRandomValue(0, SPRITES - 1);
+        float scale = GetRandomValue(5, 15)/10.0f;
+        particles[i] = (SpriteInstance){
+            .position = { (float)GetRandomValue(0, 800), (float)GetRandomValue(0, 600) },
+            .rotation = (float)GetRandomValue(0, 359),
+            .scale = { scale, scale },
+            .source = { sprite*SPRITE_SIZE, 0, SPRITE_SIZE, SPRITE_SIZE },
+            .color = Fade(WHITE, GetRandomValue(20, 100)/100.0f),
+        };
+        velocities[i] = (Vector2){ GetRandomValue(-20, 20)/10.0f, GetRandomValue(-20, 20)/10.0f };
+    }
+}
+
+void update_particles(void)
+{
+    for (int i = 0; i < PARTICLES; i++) {
+        SpriteInstance *p = &particles[i];
+        p->position.x += velocities[i].x;
+        p->position.y += velocities[i].y;
+        if (p->position.x < 0 || p->position.x > GetScreenWidth()) velocities[i].x = -velocities[i].x;
+        if (p->position.y < 0 || p->position.y > GetScreenHeight()) velocities[i].y = -velocities[i].y;
+        p->rotation += 1.0f;
+    }
+}
+
+void draw_particles(bool instanced)
+{
+    if (instanced) {
+        DrawSpriteInstances(atlas, particles, PARTICLES);
+        return;
+    }
+    for (int i = 0; i < PARTICLES; i++) {
+        SpriteInstance *p = &particles[i];
+        Rectangle source = { p->source[0], p->source[1], p->source[2], p->source[3] };
+        Rectangle dest = { p->position.x, p->position.y, source.width*p->scale.x, source.height*p->scale.y };
+        DrawTexturePro(atlas, source, dest, (Vector2){ dest.width/2, dest.height/2 }, p->rotation, p->color);
+    }
+}
+
+typedef struct {
+    double submit;    // ms to issue the draws, including the render batch flushes they cause
+    double frame;     // ms of the whole frame, including rendering and presenting it
+    int draw_calls;   // draw calls of the frame
+    Image image;      // last frame, both ways have to render the same
+} Result;
+
+// Best frame of the run, the particles are updated outside of the measured time
+Result run(bool instanced)
+{
+    Result best = {0};
+    for (int frame = 0; frame < FRAMES; frame++) {
+        update_particles();
+        double start = GetTime();
+        BeginDrawing();
+        ClearBackground(BLACK);
+        draw_particles(instanced);
+        rlDrawRenderBatchActive();
+        double submitted = GetTime();
+        if (frame == FRAMES - 1) best.image = LoadImageFromScreen();
+        EndDrawing();
+        double end = GetTime();
+
+        if (frame == 0 || submitted - start < best.submit/1000) best.submit = (submitted - start)*1000;
+        if (frame == 0 || end - start < best.frame/1000) best.frame = (end - start)*1000;
+        best.draw_calls = rlGetFrameStats().drawCalls;
+    }
+    return best;
+}
+
+// Share of pixels that differ, rotated quads can round a few edge pixels differently
+float image_difference(Image a, Image b)
+{
+    Color *pa = a.data;
+    Color *pb = b.data;
+    int different = 0;
+    for (int i = 0; i < a.width*a.height; i++) different += memcmp(&pa[i], &pb[i], sizeof(Color)) != 0;
+    return (float)different/(a.width*a.height);
+}
+
+int main(void)
+{
+    SetTraceLogLevel(LOG_WARNING);
+    InitWindow(800, 600, "bench sprites");
+
+    Color colors[SPRITES] = { RED, BLUE, ORANGE, PURPLE };
+    Image image = GenImageColor(SPRITES*SPRITE_SIZE, SPRITE_SIZE, BLANK);
+    for (int i = 0; i < SPRITES; i++) ImageDrawCircle(&image, i*SPRITE_SIZE + SPRITE_SIZE/2, SPRITE_SIZE/2, SPRITE_SIZE/2 - 1, colors[i]);
+    atlas = LoadTextureFromImage(image);
+    UnloadImage(image);
+
+    // NOTE: Both runs start from the same particles so their last frames match
+    init_particles();
+    Result loop = run(false);
+    init_particles();
+    Result instanced = run(true);
+
+    printf("sprites: %d particles of %d bytes, best of %d frames\n", PARTICLES, (int)sizeof(SpriteInstance), FRAMES);
+    printf("    %-16s %10s %10s %11s\n", "mode", "submit", "frame", "draw calls");
+    printf("    %-16s %8.2fms %8.2fms %11d\n", "DrawTexturePro", loop.submit, loop.frame, loop.draw_calls);
+    printf("    %-16s %8.2fms %8.2fms %11d\n", "instanced", instanced.submit, instanced.frame, instanced.draw_calls);
+    printf("    pixels different: %.3f%%\n", 100*image_difference(loop.image, instanced.image));
+
+    UnloadImage(loop.image);
+    UnloadImage(instanced.image);
+    UnloadTexture(atlas);
+    CloseWindow();
+    return 0;
+}
@@ -0,0 +1,118 @@
+// Draws a scene of 10k small cubes with DrawCube(), with DrawMesh() for every cube and
+// merged once into a static batch, which draws them with a few large meshes
+#include "raylib.h"
+#include "rlgl.h"
+#include "raymath.h"
+#include <stdio.h>
+#include <string.h>
+
+#define GRID 100
+#define OBJECTS (GRID*GRID)
+#define FRAMES 10
+
+typedef enum { MODE_DRAWCUBE, MODE_DRAWMESH, MODE_BATCH, MODE_BATCH_RANGE } Mode;
+
+static Matrix transforms[OBJECTS];
+
+typedef struct {
+    double frame;     // ms of the whole frame
+    int draw_calls;   // draw calls of the frame
+    Image image;      // last frame, all modes have to render the same
+} Result;
+
+// Best frame of the run, the camera looks at the whole grid from above
+Result run(Mode mode, Mesh cube, Material material, StaticBatch batch)
+{
+    Camera camera = { .position = { 0, 120, 90 }, .target = { 0, 0, 0 }, .up = { 0, 1, 0 }, .fovy = 60, .projection = CAMERA_PERSPECTIVE };
+
+    Result best = {0};
+    for (int frame = 0; frame < FRAMES; frame++) {
+        double start = GetTime();
+        BeginDrawing();
+        ClearBackground(RAYWHITE);
+        BeginMode3D(camera);
+        switch (mode) {
+        case MODE_DRAWCUBE:
+            for (int i = 0; i < OBJECTS; i++) {
+                DrawCube((Vector3){ transforms[i].m12, transforms[i].m13, transforms[i].m14 }, 1, 1, 1, MAROON);
+            }
+            break;
+        case MODE_DRAWMESH:
+            for (int i = 0; i < OBJECTS; i++) DrawMesh(cube, material, transforms[i]);
+            break;
+        case MODE_BATCH:
+            DrawStaticBatch(batch, MatrixIdentity());
+            break;
+        case MODE_BATCH_RANGE:
+            // Every row separately, ranges of a merged mesh are drawn together
+            for (int z = 0; z < GRID; z++) DrawStaticBatchRange(batch, z*GRID, GRID, MatrixIdentity());
+            break;
+        }
+        EndMode3D();
+        rlDrawRenderBatchActive();
+        if (frame == FRAMES - 1) best.image = LoadImageFromScreen();
+        EndDrawing();
+        double end = GetTime();
+
+        if (frame == 0 || end - start < best.frame/1000) best.frame = (end - start)*1000;
+        best.draw_calls = rlGetFrameStats().drawCalls;
+    }
+    return best;
+}
+
+// Share of pixels that differ, vertices transformed on loading or per draw can round a few edge pixels differently
+float image_difference(Image a, Image b)
+{
+    Color *pa = a.data;
+    Color *pb = b.data;
+    int different = 0;
+    for (int i = 0; i < a.width*a.height; i++) different += memcmp(&pa[i], &pb[i], sizeof(Color)) != 0;
+    return (float)different/(a.width*a.height);
+}
+
+int main(void)
+{
+    SetTraceLogLevel(LOG_WARNING);
+    InitWindow(800, 600, "bench static");
+
+    for (int z = 0; z < GRID; z++) {
+        for (int x = 0; x < GRID; x++) {
+            transforms[z*GRID + x] = MatrixTranslate((x - GRID/2)*1.5f, 0, (z - GRID/2)*1.5f);
+        }
+    }
+
+    // NOTE: Meshes are drawn with the default material, DrawCube() with plain vertex colors
+    Mesh cube = GenMeshCube(1, 1, 1);
+    Material material = LoadMaterialDefault();
+    material.maps[MATERIAL_MAP_DIFFUSE].color = MAROON;
+
+    Mesh *meshes = MemAlloc(OBJECTS*sizeof(Mesh));
+    for (int i = 0; i < OBJECTS; i++) meshes[i] = cube;
+    double start = GetTime();
+    StaticBatch batch = LoadStaticBatch(meshes, transforms, OBJECTS, material);
+    double loaded = GetTime();
+    MemFree(meshes);
+
+    Result drawcube = run(MODE_DRAWCUBE, cube, material, batch);
+    Result drawmesh = run(MODE_DRAWMESH, cube, material, batch);
+    Result batched = run(MODE_BATCH, cube, material, batch);
+    Result ranges = run(MODE_BATCH_RANGE, cube, material, batch);
+
+    printf("static: %d cubes, %d merged meshes loaded in %.2fms, best of %d frames\n", OBJECTS, batch.meshCount, (loaded - start)*1000, FRAMES);
+    printf("    %-14s %10s %11s %12s\n", "mode", "frame", "draw calls", "different");
+    printf("    %-14s %8.2fms %11d %12s\n", "DrawCube", drawcube.frame, drawcube.draw_calls, "-");
+    printf("    %-14s %8.2fms %11d %11.3f%%\n", "DrawMesh", drawmesh.frame, drawmesh.draw_calls, 100*image_difference(drawcube.image, drawmesh.image));
+    printf("    %-14s %8.2fms %11d %11.3f%%\n", "static batch", batched.frame, batched.draw_calls, 100*image_difference(drawmesh.image, batched.image));
+    printf("    %-14s %8.2fms %11d %11.3f%%\n", "batch ranges", ranges.frame, ranges.draw_calls, 100*image_difference(drawmesh.image, ranges.image));
+
+    UnloadImage(drawcube.image);
+    UnloadImage(drawmesh.image);
+    UnloadImage(batched.image);
+    UnloadImage(ranges.image);
+
+    UnloadStaticBatch(batch);
+    UnloadMaterial(material);
+    UnloadMesh(cube);
+    CloseWindow();
+    return 0;
+}
@@ -0,0 +1,131 @@
+// Draws the same scene of shapes and labels immediately on the main thread and recorded into
+// command lists by worker threads, which the main thread then submits in order
+#include "raylib.h"
+#include "rlgl.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+
+#define ENTITIES 4000
+#define MAX_WORKERS 8
+#define FRAMES 60
+
+typedef struct {
+    Vector2 position;
+    float radius;
+    Color color;
+} Entity;
+
+static Entity entities[ENTITIES];
+
+typedef struct {
+    rlCommandList *list;
+    int first;
+    int count;
+} Job;
+
+// Every entity draws a circle, a rounded frame and its label
+// NOTE: TextFormat() is not thread safe, labels are formatted on the stack
+void draw_entities(int first, int count)
+{
+    Font font = GetFontDefault();
+    char label[16];
+    for (int i = first; i < first + count; i++) {
+        Entity *e = &entities[i];
+        DrawCircleV(e->position, e->radius, e->color);
+        DrawRectangleRounded((Rectangle){ e->position.x - e->radius, e->position.y - e->radius, 2*e->radius, 2*e->radius }, 0.4f, 4, Fade(BLACK, 0.2f));
+        snprintf(label, sizeof(label), "%d", i);
+        DrawTextEx(font, label, (Vector2){ e->position.x - e->radius, e->position.y + e->radius }, 10, 1, BLACK);
+    }
+}
+
+void *record(void *arg)
+{
+    Job *job = arg;
+    rlBeginCommandList(job->list);
+    draw_entities(job->first, job->count);
+    rlEndCommandList();
+    return NULL;
+}
+
+typedef struct {
+    double record;    // ms to record the draw commands, for immediate mode to draw them into the render batch
+    double submit;    // ms to submit the command lists into the render batch, on the main thread
+    Image image;      // last frame, command lists have to render the same
+} Result;
+
+// Best frame of the run: recording the draw commands with the given workers and submitting them,
+// or drawing them immediately without workers
+// NOTE: Drawing into the render batch includes its flushes whenever it fills up, with --headless
+// that is the rasterization, which only the main thread does
+Result run(int workers, rlCommandList **lists)
+{
+    Result best = {0};
+    for (int frame = 0; frame < FRAMES; frame++) {
+        BeginDrawing();
+        ClearBackground(RAYWHITE);
+        double start = GetTime();
+        double recorded = start;
+        if (workers == 0) {
+            draw_entities(0, ENTITIES);
+        } else {
+            pthread_t threads[MAX_WORKERS];
+            Job jobs[MAX_WORKERS];
+            for (int i = 0; i < workers; i++) {
+                jobs[i] = (Job){ lists[i], i*ENTITIES/workers, (i + 1)*ENTITIES/workers - i*ENTITIES/workers };
+                pthread_create(&threads[i], NULL, record, &jobs[i]);
+            }
+            for (int i = 0; i < workers; i++) pthread_join(threads[i], NULL);
+            recorded = GetTime();
+            for (int i = 0; i < workers; i++) rlSubmitCommandList(lists[i]);
+        }
+        double end = GetTime();
+        if (workers == 0) recorded = end;
+        if (frame == FRAMES - 1) best.image = LoadImageFromScreen();
+        EndDrawing();
+
+        if (frame == 0 || recorded - start < best.record/1000) best.record = (recorded - start)*1000;
+        if (frame == 0 || end - recorded < best.submit/1000) best.submit = (end - recorded)*1000;
+    }
+    return best;
+}
+
+bool same_image(Image a, Image b)
+{
+    return a.width == b.width && a.height == b.height &&
+           memcmp(a.data, b.data, GetPixelDataSize(a.width, a.height, a.format)) == 0;
+}
+
+int main(void)
+{
+    SetTraceLogLevel(LOG_WARNING);
+    InitWindow(800, 600, "bench threads");
+
+    SetRandomSeed(42);
+    for (int i = 0; i < ENTITIES; i++) {
+        entities[i] = (Entity){
+            .position = { (float)GetRandomValue(20, 780), (float)GetRandomValue(20, 580) },
+            .radius = (float)GetRandomValue(4, 12),
+            .color = (Color){ GetRandomValue(0, 255), GetRandomValue(0, 255), GetRandomValue(0, 255), 255 },
+        };
+    }
+
+    rlCommandList *lists[MAX_WORKERS];
+    for (int i = 0; i < MAX_WORKERS; i++) lists[i] = rlLoadCommandList();
+
+    printf("threads: %d entities, best of %d frames\n", ENTITIES, FRAMES);
+    printf("    %-10s %10s %10s %10s\n", "workers", "record", "submit", "output");
+    Result immediate = run(0, lists);
+    printf("    %-10s %8.2fms %10s %10s\n", "immediate", immediate.record, "-", "-");
+    for (int workers = 1; workers <= MAX_WORKERS; workers *= 2) {
+        Result recorded = run(workers, lists);
+        printf("    %-10d %8.2fms %8.2fms %10s\n", workers, recorded.record, recorded.submit,
+               same_image(immediate.image, recorded.image) ? "same" : "DIFFERENT");
+        UnloadImage(recorded.image);
+    }
+    UnloadImage(immediate.image);
+
+    for (int i = 0; i < MAX_WORKERS; i++) rlUnloadCommandList(lists[i]);
+    CloseWindow();
+    return 0;
+}
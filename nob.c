@@ -1,5 +1,8 @@
 #define NOB_IMPLEMENTATION
 #include "nob.h"
+#include <stdint.h>
+#include <time.h>
+#include <sys/resource.h>
 
 static const char *modules[] = {
     "rcore",
@@ -12,213 +15,1282 @@ static const char *modules[] = {
     "utils",
 };
 
-bool build_raylib_linux()
+// Collect every dependency listed in a compiler generated depfile (the kind `-MMD -MF` produces).
+// The paths are allocated in the temporary storage.
+bool read_depfile(const char *dep_path, Nob_File_Paths *deps)
+{
+    bool result = true;
+    Nob_String_Builder sb = {0};
+    if (!nob_read_entire_file(dep_path, &sb)) nob_return_defer(false);
+
+    Nob_String_View content = nob_sv_from_parts(sb.items, sb.count);
+    nob_sv_chop_by_delim(&content, ':'); // skip the target, we know which object this is
+    for (;;) {
+        content = nob_sv_trim_left(content);
+        if (content.count == 0) break;
+
+        // NOTE: paths with escaped spaces are not supported, none of ours have them
+        size_t n = 0;
+        while (n < content.count && !isspace(content.data[n])) n += 1;
+        Nob_String_View dep = nob_sv_from_parts(content.data, n);
+        content = nob_sv_from_parts(content.data + n, content.count - n);
+
+        if (nob_sv_eq(dep, nob_sv_from_cstr("\\"))) continue; // line continuation
+        nob_da_append(deps, nob_temp_sv_to_cstr(dep));
+    }
+
+defer:
+    nob_sb_free(sb);
+    return result;
+}
+
+// Same as nob_needs_rebuild1, but also checks every header the object was compiled from according
+// to its depfile. A missing depfile or a dependency that went away always means rebuild.
+int needs_rebuild_with_deps(const char *out, const char *in, const char *dep)
+{
+    int result = 0;
+    Nob_File_Paths deps = {0};
+    size_t checkpoint = nob_temp_save();
+
+    if (nob_file_exists(dep) != 1)    nob_return_defer(1);
+    if (!read_depfile(dep, &deps))    nob_return_defer(1);
+    nob_da_append(&deps, in);
+    for (size_t i = 0; i < deps.count; i++) {
+        if (nob_file_exists(deps.items[i]) != 1) nob_return_defer(1);
+    }
+    result = nob_needs_rebuild(out, deps.items, deps.count);
+
+defer:
+    nob_temp_rewind(checkpoint);
+    nob_da_free(deps);
+    return result;
+}
+
+// Writes the file only if its content differs, so generated sources don't look stale for no reason
+bool write_file_if_changed(const char *path, Nob_String_Builder content)
+{
+    bool result = true;
+    Nob_String_Builder old = {0};
+
+    if (nob_file_exists(path) == 1 && nob_read_entire_file(path, &old) &&
+        old.count == content.count && memcmp(old.items, content.items, old.count) == 0) {
+        nob_return_defer(true);
+    }
+    result = nob_write_entire_file(path, content.items, content.count);
+
+defer:
+    nob_sb_free(old);
+    return result;
+}
+
+#define CACHE_DIR "./build/cache"
+
+typedef struct {
+    const char *in;
+    const char *out;
+    const char *dep;
+    const char *pp;
+    const char *cached;
+    const char *pch;  // precompiled prelude the object is compiled with (--pch), NULL if none
+    bool pch_stale;
+} Object;
+
+typedef struct {
+    Object *items;
+    size_t count;
+    size_t capacity;
+} Objects;
+
+typedef struct {
+    size_t hits;
+    size_t misses;
+} Cache_Stats;
+Cache_Stats cache_stats = {0};
+
+// Objects that missed the cache and are waiting to be compiled, see cache_store
+Objects cache_pending = {0};
+bool cache_enabled = true;
+
+// Maximum amount of commands in flight, 0 means the amount of online processors
+size_t max_jobs = 0;
+
+// Rebuild every object no matter what needs_rebuild_with_deps says. Used when the inputs changed in a
+// way the dependencies can't tell, like switching phases of PGO.
+bool force_rebuild = false;
+
+// 64-bit FNV-1a, good enough to tell apart the handful of objects we cache
+uint64_t hash_fnv1a(uint64_t hash, const void *data, size_t size)
+{
+    const unsigned char *bytes = data;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+// Store the objects compiled since the last call, through a rename so a cache entry is never half written.
+// Has to be called after the compile jobs ran successfully.
+bool cache_store(void)
+{
+    bool result = true;
+    for (size_t i = 0; i < cache_pending.count; i++) {
+        const Object *obj = &cache_pending.items[i];
+        const char *tmp = nob_temp_sprintf("%s.tmp", obj->cached);
+        if (!nob_copy_file(obj->out, tmp)) nob_return_defer(false);
+        if (!nob_rename(tmp, obj->cached)) nob_return_defer(false);
+    }
+    if (cache_enabled) {
+        nob_log(NOB_INFO, "object cache: %zu hits, %zu misses", cache_stats.hits, cache_stats.misses);
+    }
+
+defer:
+    cache_pending.count = 0;
+    return result;
+}
+
+bool sv_starts_with(Nob_String_View sv, const char *prefix)
+{
+    size_t n = strlen(prefix);
+    return sv.count >= n && memcmp(sv.data, prefix, n) == 0;
+}
+
+bool sv_ends_with(Nob_String_View sv, const char *suffix)
+{
+    size_t n = strlen(suffix);
+    return sv.count >= n && memcmp(sv.data + sv.count - n, suffix, n) == 0;
+}
+
+// Command every compile goes through (ccache, distcc, a local cache daemon...), from --launcher or the
+// NOB_LAUNCHER environment variable. Arguments are separated by spaces.
+Nob_Cmd launcher = {0};
+
+// Launchers report what they did to this file, one line per cache lookup: NOB_LAUNCHER_STATS names it
+// for our own launchers which write `hit` or `miss`, CCACHE_STATSLOG for ccache which writes its
+// counters like `direct_cache_hit` or `cache_miss`.
+#define LAUNCHER_STATS_PATH "./build/launcher-stats.log"
+
+bool set_launcher(const char *launcher_cstr)
+{
+    launcher.count = 0;
+    Nob_String_View sv = nob_sv_from_cstr(launcher_cstr);
+    while (sv.count > 0) {
+        Nob_String_View arg = nob_sv_trim(nob_sv_chop_by_delim(&sv, ' '));
+        if (arg.count > 0) nob_da_append(&launcher, nob_temp_sv_to_cstr(arg));
+    }
+    if (launcher.count == 0) return true;
+
+    if (!nob_mkdir_if_not_exists("build")) return false;
+    if (setenv("NOB_LAUNCHER_STATS", LAUNCHER_STATS_PATH, 1) < 0 || setenv("CCACHE_STATSLOG", LAUNCHER_STATS_PATH, 1) < 0) {
+        nob_log(NOB_ERROR, "could not set the launcher environment: %s", strerror(errno));
+        return false;
+    }
+    return true;
+}
+
+void append_launcher(Nob_Cmd *cmd)
+{
+    nob_da_append_many(cmd, launcher.items, launcher.count);
+}
+
+// Logs the hits and misses the launcher reported since the last call
+bool launcher_stats(void)
+{
+    bool result = true;
+    Nob_String_Builder sb = {0};
+    size_t hits = 0;
+    size_t misses = 0;
+
+    if (launcher.count == 0) nob_return_defer(true);
+    if (nob_file_exists(LAUNCHER_STATS_PATH) == 1) {
+        if (!nob_read_entire_file(LAUNCHER_STATS_PATH, &sb)) nob_return_defer(false);
+        if (remove(LAUNCHER_STATS_PATH) < 0) {
+            nob_log(NOB_ERROR, "could not remove %s: %s", LAUNCHER_STATS_PATH, strerror(errno));
+            nob_return_defer(false);
+        }
+    }
+
+    Nob_String_View content = nob_sv_from_parts(sb.items, sb.count);
+    while (content.count > 0) {
+        Nob_String_View line = nob_sv_trim(nob_sv_chop_by_delim(&content, '\n'));
+        if (nob_sv_eq(line, nob_sv_from_cstr("hit"))  || sv_ends_with(line, "_cache_hit")) hits += 1;
+        if (nob_sv_eq(line, nob_sv_from_cstr("miss")) || nob_sv_eq(line, nob_sv_from_cstr("cache_miss"))) misses += 1;
+    }
+    if (hits + misses == 0) {
+        nob_log(NOB_INFO, "launcher %s: no cache statistics reported", launcher.items[0]);
+    } else {
+        nob_log(NOB_INFO, "launcher %s: %zu hits, %zu misses", launcher.items[0], hits, misses);
+    }
+
+defer:
+    nob_sb_free(sb);
+    return result;
+}
+
+// Modules compiled through a precompiled header with --pch, the ones implementing big single header
+// libraries. Only the gcc flavour of precompiled headers is supported, so this is limited to linux.
+static const char *pch_modules[] = {
+    "raudio",
+    "rtext",
+    "rtextures",
+    "rmodels",
+};
+bool pch_enabled = false;
+
+// The prelude of a split module includes raylib.h and friends by their plain names
+#define PCH_INCLUDE "-I./src/ext/raylib-5.0/src"
+
+typedef struct {
+    Nob_String_View *items;
+    size_t count;
+    size_t capacity;
+} Lines;
+
+
+bool is_pch_module(Nob_String_View name)
+{
+    for (size_t i = 0; i < NOB_ARRAY_LEN(pch_modules); i++) {
+        if (nob_sv_eq(name, nob_sv_from_cstr(pch_modules[i]))) return true;
+    }
+    return false;
+}
+
+#define MAX_CONDITIONAL_DEPTH 32
+
+// Keeps track of the preprocessor conditionals open at a line: the #if, #elif and #else lines of all of
+// them in `open` and where each one starts in `levels`
+void track_conditionals(Nob_String_View line, Lines *open, size_t *levels, size_t *depth)
+{
+    line = nob_sv_trim(line);
+    if (line.count == 0 || line.data[0] != '#') return;
+    Nob_String_View directive = nob_sv_trim_left(nob_sv_from_parts(line.data + 1, line.count - 1));
+
+    if (sv_starts_with(directive, "if")) {
+        NOB_ASSERT(*depth < MAX_CONDITIONAL_DEPTH && "conditionals nested too deep");
+        levels[(*depth)++] = open->count;
+        nob_da_append(open, line);
+    } else if (sv_starts_with(directive, "el") && *depth > 0) {
+        nob_da_append(open, line);
+    } else if (sv_starts_with(directive, "endif") && *depth > 0) {
+        open->count = levels[--(*depth)];
+    }
+}
+
+// Splits a raylib module at the end of its external includes into a prelude header, which gets
+// precompiled, and the rest of the module which includes the prelude first. The conditionals open at
+// the split are closed at the end of the prelude and opened again in the rest, #line keeps diagnostics
+// and debug info pointing at the module.
+// NOTE: precompiling the externals and force including them in front of the untouched module does not
+// work, most of them have no include guard around their implementation
+bool split_pch_module(const char *source, const char *header_path, const char *body_path)
+{
+    bool result = true;
+    Nob_String_Builder sb = {0};
+    Nob_String_Builder out = {0};
+    Lines lines = {0};
+    Lines open = {0};
+    size_t levels[MAX_CONDITIONAL_DEPTH];
+    size_t depth = 0;
+
+    if (!nob_read_entire_file(source, &sb)) nob_return_defer(false);
+    Nob_String_View content = nob_sv_from_parts(sb.items, sb.count);
+    while (content.count > 0) nob_da_append(&lines, nob_sv_chop_by_delim(&content, '\n'));
+
+    /* find the last external include and the outermost conditional level of all of them */
+    size_t last = lines.count;
+    size_t base = MAX_CONDITIONAL_DEPTH;
+    for (size_t i = 0; i < lines.count; i++) {
+        track_conditionals(lines.items[i], &open, levels, &depth);
+        if (!sv_starts_with(nob_sv_trim(lines.items[i]), "#include \"external/")) continue;
+        last = i;
+        if (depth < base) base = depth;
+    }
+    if (last == lines.count) {
+        nob_log(NOB_ERROR, "%s includes no external headers to precompile", source);
+        nob_return_defer(false);
+    }
+
+    /* split where that level is back after the last external include */
+    size_t cut = lines.count;
+    open.count = 0;
+    depth = 0;
+    for (size_t i = 0; i < lines.count; i++) {
+        track_conditionals(lines.items[i], &open, levels, &depth);
+        if (i >= last && depth <= base) {
+            cut = i;
+            break;
+        }
+    }
+    if (cut == lines.count) {
+        nob_log(NOB_ERROR, "could not find where to split %s", source);
+        nob_return_defer(false);
+    }
+
+    nob_sb_append_cstr(&out, "// Generated by nob.c, do not edit\n");
+    nob_sb_append_cstr(&out, nob_temp_sprintf("#line 1 \"%s\"\n", source));
+    for (size_t i = 0; i <= cut; i++) {
+        nob_sb_append_buf(&out, lines.items[i].data, lines.items[i].count);
+        nob_sb_append_cstr(&out, "\n");
+    }
+    for (size_t i = 0; i < depth; i++) nob_sb_append_cstr(&out, "#endif\n");
+    if (!write_file_if_changed(header_path, out)) nob_return_defer(false);
+
+    const char *header_name = strrchr(header_path, '/');
+    out.count = 0;
+    nob_sb_append_cstr(&out, "// Generated by nob.c, do not edit\n");
+    nob_sb_append_cstr(&out, nob_temp_sprintf("#include \"%s\"\n", header_name ? header_name + 1 : header_path));
+    for (size_t i = 0; i < open.count; i++) {
+        nob_sb_append_buf(&out, open.items[i].data, open.items[i].count);
+        nob_sb_append_cstr(&out, "\n");
+    }
+    nob_sb_append_cstr(&out, nob_temp_sprintf("#line %zu \"%s\"\n", cut + 2, source));
+    for (size_t i = cut + 1; i < lines.count; i++) {
+        nob_sb_append_buf(&out, lines.items[i].data, lines.items[i].count);
+        nob_sb_append_cstr(&out, "\n");
+    }
+    if (!write_file_if_changed(body_path, out)) nob_return_defer(false);
+
+defer:
+    nob_sb_free(sb);
+    nob_sb_free(out);
+    nob_da_free(lines);
+    nob_da_free(open);
+    return result;
+}
+
+// The cache is content addressed: an object is keyed by the full command line it is compiled with
+// (launcher and precompiled header included) and its preprocessed source, so mtimes touched by a
+// checkout or a cache restore do not matter.
+const char *cache_path(Nob_Cmd flags, bool pch, const char *pp_path)
+{
+    const char *result = NULL;
+    Nob_String_Builder sb = {0};
+
+    nob_cmd_render(launcher, &sb);
+    nob_sb_append_null(&sb);
+    nob_cmd_render(flags, &sb);
+    if (pch) nob_sb_append_cstr(&sb, " " PCH_INCLUDE " -Winvalid-pch");
+    nob_sb_append_null(&sb);
+    if (!nob_read_entire_file(pp_path, &sb)) nob_return_defer(NULL);
+    uint64_t hash = hash_fnv1a(0xcbf29ce484222325ULL, sb.items, sb.count);
+    result = nob_temp_sprintf("%s/%016llx.o", CACHE_DIR, (unsigned long long)hash);
+
+defer:
+    nob_sb_free(sb);
+    return result;
+}
+
+// Schedules compiling the given raylib sources into build_dir with the compiler and flags in `flags`.
+// Stale objects are looked up in the object cache first and only get a compile job on a miss, the ids
+// of those jobs are appended to obj_jobs.
+bool build_raylib_objects(Nob_Jobs *jobs, Nob_Cmd flags, const char *build_dir, Nob_File_Paths sources,
+                          Nob_File_Paths *obj_files, Nob_Job_Ids *obj_jobs)
+{
+    bool result = true;
+    Nob_Cmd cmd = {0};
+    Nob_Jobs pp_jobs = {0};
+    Objects stale = {0};
+
+    if (!nob_mkdir_if_not_exists(CACHE_DIR)) nob_return_defer(false);
+
+    // NOTE: cached objects are shared by every checkout, debug info gets paths relative to the checkout
+    // instead of the absolute directory of whichever one compiled them first
+    const char *prefix_map = NULL;
+    if (cache_enabled) {
+        char cwd[4096];
+        if (getcwd(cwd, sizeof(cwd)) == NULL) {
+            nob_log(NOB_ERROR, "could not get the current directory: %s", strerror(errno));
+            nob_return_defer(false);
+        }
+        prefix_map = nob_temp_sprintf("-fdebug-prefix-map=%s=.", cwd);
+    }
+
+    /* preprocess the stale modules, this is what the cache is keyed by */
+    for (size_t i = 0; i < sources.count; i++) {
+        Object obj = {0};
+        Nob_String_View name = nob_sv_from_cstr(sources.items[i]);
+        while (strchr(name.data, '/')) nob_sv_chop_by_delim(&name, '/');
+        name = nob_sv_chop_by_delim(&name, '.');
+        obj.in  = sources.items[i];
+        obj.out = nob_temp_sprintf("%s/"SV_Fmt".o", build_dir, SV_Arg(name));
+        obj.dep = nob_temp_sprintf("%s/"SV_Fmt".d", build_dir, SV_Arg(name));
+        obj.pp  = nob_temp_sprintf("%s/"SV_Fmt".i", build_dir, SV_Arg(name));
+        nob_da_append(obj_files, obj.out);
+
+        int rebuild = 0;
+        if (pch_enabled && is_pch_module(name)) {
+            obj.pch = nob_temp_sprintf("%s/"SV_Fmt"_pch.h", build_dir, SV_Arg(name));
+            obj.in  = nob_temp_sprintf("%s/"SV_Fmt"_pch.c", build_dir, SV_Arg(name));
+            if (!split_pch_module(sources.items[i], obj.pch, obj.in)) nob_return_defer(false);
+
+            const char *gch = nob_temp_sprintf("%s.gch", obj.pch);
+            int pch_stale = force_rebuild ? 1 : needs_rebuild_with_deps(gch, obj.pch, nob_temp_sprintf("%s.d", gch));
+            if (pch_stale < 0) nob_return_defer(false);
+            obj.pch_stale = pch_stale;
+
+            // NOTE: the depfile of an object compiled with a precompiled header only lists the source
+            // itself, the headers are in the depfile of the precompiled header
+            rebuild = pch_stale ? 1 : nob_needs_rebuild1(obj.out, gch);
+            if (rebuild < 0) nob_return_defer(false);
+        }
+        if (!rebuild) rebuild = force_rebuild ? 1 : needs_rebuild_with_deps(obj.out, obj.in, obj.dep);
+        if (rebuild < 0) nob_return_defer(false);
+        if (!rebuild) continue;
+
+        nob_da_append(&stale, obj);
+        if (!cache_enabled) continue;
+
+        cmd.count = 0;
+        nob_da_append_many(&cmd, flags.items, flags.count);
+        if (obj.pch) nob_cmd_append(&cmd, PCH_INCLUDE);
+        nob_cmd_append(&cmd, "-fno-working-directory", "-E", obj.in);
+        nob_cmd_append(&cmd, "-o", obj.pp);
+        nob_cmd_append(&cmd, "-MMD", "-MF", obj.dep, "-MT", obj.out);
+        nob_jobs_add(&pp_jobs, cmd);
+    }
+    if (!nob_jobs_run(&pp_jobs, max_jobs)) nob_return_defer(false);
+
+    /* reuse cached objects, schedule compiling the rest */
+    for (size_t i = 0; i < stale.count; i++) {
+        Object *obj = &stale.items[i];
+
+        // NOTE: a stale precompiled header is rebuilt on a cache hit too, otherwise it stays stale and
+        // the module is preprocessed again on every run
+        size_t pch_job = NOB_NO_JOB;
+        if (obj->pch && obj->pch_stale) {
+            const char *gch = nob_temp_sprintf("%s.gch", obj->pch);
+            cmd.count = 0;
+            append_launcher(&cmd);
+            nob_da_append_many(&cmd, flags.items, flags.count);
+            if (prefix_map) nob_cmd_append(&cmd, prefix_map);
+            nob_cmd_append(&cmd, PCH_INCLUDE);
+            nob_cmd_append(&cmd, "-x", "c-header", obj->pch);
+            nob_cmd_append(&cmd, "-o", gch);
+            nob_cmd_append(&cmd, "-MMD", "-MF", nob_temp_sprintf("%s.d", gch));
+            pch_job = nob_jobs_add(jobs, cmd);
+        }
+
+        if (cache_enabled) {
+            obj->cached = cache_path(flags, obj->pch != NULL, obj->pp);
+            remove(obj->pp);
+            if (obj->cached == NULL) nob_return_defer(false);
+
+            if (nob_file_exists(obj->cached) == 1) {
+                cache_stats.hits += 1;
+                if (pch_job == NOB_NO_JOB) {
+                    if (!nob_copy_file(obj->cached, obj->out)) nob_return_defer(false);
+                    continue;
+                }
+                // NOTE: the object is copied once the precompiled header is rebuilt, so it is newer
+                // than the header and the next run does not take it for stale
+                cmd.count = 0;
+                nob_cmd_append(&cmd, "cp", obj->cached, obj->out);
+                size_t copy_job = nob_jobs_add(jobs, cmd);
+                nob_jobs_depend(jobs, copy_job, pch_job);
+                nob_da_append(obj_jobs, copy_job);
+                continue;
+            }
+        }
+
+        cmd.count = 0;
+        append_launcher(&cmd);
+        nob_da_append_many(&cmd, flags.items, flags.count);
+        if (prefix_map) nob_cmd_append(&cmd, prefix_map);
+        if (obj->pch) nob_cmd_append(&cmd, PCH_INCLUDE, "-Winvalid-pch");
+        nob_cmd_append(&cmd, "-c", obj->in);
+        nob_cmd_append(&cmd, "-o", obj->out);
+        nob_cmd_append(&cmd, "-MMD", "-MF", obj->dep);
+        size_t obj_job = nob_jobs_add(jobs, cmd);
+        nob_jobs_depend(jobs, obj_job, pch_job);
+        nob_da_append(obj_jobs, obj_job);
+        if (cache_enabled) {
+            nob_da_append(&cache_pending, *obj);
+            cache_stats.misses += 1;
+        }
+    }
+
+defer:
+    nob_cmd_free(cmd);
+    nob_jobs_free(&pp_jobs);
+    nob_da_free(stale);
+    return result;
+}
+
+// 0 means a translation unit per module, otherwise the amount of unity shards raylib is amalgamated into
+size_t unity_shards = 0;
+
+// Modules in an order they can be amalgamated in. rcore.c implements rlgl.h (and glad.h with it) so it
+// has to come after every other module including rlgl.h, rtextures.c implements stb_image.h which
+// rmodels.c includes as well, and utils.c goes first so TRACELOG is not defined away by rlgl.h.
+// rglfw.c compiles the GLFW sources and always gets a translation unit of its own.
+static const char *unity_order[] = {
+    "utils",
+    "rshapes",
+    "rtext",
+    "rtextures",
+    "rmodels",
+    "raudio",
+    "rcore",
+};
+
+typedef enum {
+    PROFILE_DEBUG,
+    PROFILE_RELEASE,
+    PROFILE_LTO,
+    PROFILE_PGO,
+} Profile;
+Profile profile = PROFILE_DEBUG;
+
+const char *profile_names[] = {
+    [PROFILE_DEBUG]   = "debug",
+    [PROFILE_RELEASE] = "release",
+    [PROFILE_LTO]     = "lto",
+    [PROFILE_PGO]     = "pgo",
+};
+
+// Which phase of PGO is being built: the instrumented binary or the one optimized with the profile
+bool pgo_generate = false;
+
+// Build the game logic as libplug.so which the host reloads whenever nob rebuilds it, see watch_plug_linux
+bool hot_reload = false;
+
+// Build raylib for PLATFORM_HEADLESS: rendered in software by rlsw into memory, no display or GPU needed
+bool headless = false;
+
+// Build desktop raylib with the render batch variants that still have to run on real GL 3.3, GL 2.1 and
+// ES2 drivers before they become the default: interleaved vertices in a mapped ring (RLGL_INTERLEAVED_BATCH)
+// and draws sampling several textures picked per vertex (RLGL_MULTI_TEXTURE_BATCH)
+bool experimental_batch = false;
+
+// Frames ./main renders when it is run headless, there is no window to close
+#define HEADLESS_FRAMES "120"
+
+// Frames of ./main the PGO profile is collected from
+#define PGO_TRAINING_FRAMES "600"
+
+// Feature profile raylib is built with, a set of modules to leave out and of config.h flags to turn off
+typedef struct {
+    const char *name;
+    const char *drop_modules[8];
+    const char *disable[32];
+} Features;
+
+// Everything the game never uses in the lean profile: recording, automation and file formats
+#define LEAN_DISABLE                                                                                 \
+    "SUPPORT_GIF_RECORDING", "SUPPORT_AUTOMATION_EVENTS", "SUPPORT_SSH_KEYBOARD_RPI",                \
+    "SUPPORT_FILEFORMAT_GIF", "SUPPORT_FILEFORMAT_QOI", "SUPPORT_FILEFORMAT_DDS",                    \
+    "SUPPORT_FILEFORMAT_OBJ", "SUPPORT_FILEFORMAT_MTL", "SUPPORT_FILEFORMAT_IQM",                    \
+    "SUPPORT_FILEFORMAT_GLTF", "SUPPORT_FILEFORMAT_VOX", "SUPPORT_FILEFORMAT_M3D",                   \
+    "SUPPORT_FILEFORMAT_MP3", "SUPPORT_FILEFORMAT_QOA", "SUPPORT_FILEFORMAT_XM", "SUPPORT_FILEFORMAT_MOD"
+
+static const Features feature_profiles[] = {
+    { .name = "full" },
+    { .name = "lean", .disable = { LEAN_DISABLE } },
+    { .name = "minimal", .drop_modules = { "raudio", "rmodels" }, .disable = { LEAN_DISABLE } },
+};
+
+// The first profile builds with config.h as it is
+const Features *features = &feature_profiles[0];
+
+#define FEATURES_HEADER_PATH(name) nob_temp_sprintf("./build/config-%s.h", (name))
+
+bool module_enabled(const char *module)
+{
+    if (headless && strcmp(module, "rglfw") == 0) return false;
+    for (size_t i = 0; i < NOB_ARRAY_LEN(features->drop_modules) && features->drop_modules[i]; i++) {
+        if (strcmp(features->drop_modules[i], module) == 0) return false;
+    }
+    return true;
+}
+
+// Generates the config header of the feature profile: config.h with the disabled flags commented out,
+// the flags of the dropped modules included. Does nothing for the first profile.
+bool write_features_header(void)
+{
+    bool result = true;
+    Nob_String_Builder sb = {0};
+    Nob_String_Builder out = {0};
+    Nob_File_Paths disable = {0};
+    Nob_File_Paths found = {0};
+
+    if (features == &feature_profiles[0]) nob_return_defer(true);
+    if (!nob_mkdir_if_not_exists("build")) nob_return_defer(false);
+
+    for (size_t i = 0; i < NOB_ARRAY_LEN(features->disable) && features->disable[i]; i++) {
+        nob_da_append(&disable, features->disable[i]);
+    }
+    for (size_t i = 0; i < NOB_ARRAY_LEN(features->drop_modules) && features->drop_modules[i]; i++) {
+        char *flag = nob_temp_sprintf("SUPPORT_MODULE_%s", features->drop_modules[i]);
+        for (char *c = flag; *c; c++) *c = toupper(*c);
+        nob_da_append(&disable, flag);
+    }
+
+    if (!nob_read_entire_file("./src/ext/raylib-5.0/src/config.h", &sb)) nob_return_defer(false);
+    nob_sb_append_cstr(&out, nob_temp_sprintf("// Generated by nob.c from config.h for the %s feature profile, do not edit\n", features->name));
+    Nob_String_View content = nob_sv_from_parts(sb.items, sb.count);
+    while (content.count > 0) {
+        Nob_String_View line = nob_sv_chop_by_delim(&content, '\n');
+        Nob_String_View define = nob_sv_trim(line);
+        if (sv_starts_with(define, "#define ")) {
+            nob_sv_chop_by_delim(&define, ' ');
+            Nob_String_View flag = nob_sv_chop_by_delim(&define, ' ');
+            for (size_t i = 0; i < disable.count; i++) {
+                if (!nob_sv_eq(flag, nob_sv_from_cstr(disable.items[i]))) continue;
+                nob_sb_append_cstr(&out, "//");
+                nob_da_append(&found, disable.items[i]);
+            }
+        }
+        nob_sb_append_buf(&out, line.data, line.count);
+        nob_sb_append_cstr(&out, "\n");
+    }
+
+    // NOTE: catches typos in the profiles as well as modules that are not optional, like rcore
+    if (found.count != disable.count) {
+        for (size_t i = 0; i < disable.count; i++) {
+            bool was_found = false;
+            for (size_t j = 0; j < found.count; j++) was_found = was_found || strcmp(found.items[j], disable.items[i]) == 0;
+            if (!was_found) nob_log(NOB_ERROR, "feature profile %s: config.h does not define %s", features->name, disable.items[i]);
+        }
+        nob_return_defer(false);
+    }
+    if (!write_file_if_changed(FEATURES_HEADER_PATH(features->name), out)) nob_return_defer(false);
+
+defer:
+    nob_sb_free(sb);
+    nob_sb_free(out);
+    nob_da_free(disable);
+    nob_da_free(found);
+    return result;
+}
+
+// Flags making raylib use the config header of the feature profile instead of config.h
+void append_feature_flags(Nob_Cmd *cmd)
+{
+    if (features == &feature_profiles[0]) return;
+    nob_cmd_append(cmd, "-DEXTERNAL_CONFIG_FLAGS", "-include", FEATURES_HEADER_PATH(features->name));
+}
+
+// Compiler flags of the current profile, these are used for linking as well
+void append_profile_flags(Nob_Cmd *cmd)
+{
+    switch (profile) {
+    case PROFILE_DEBUG:
+        nob_cmd_append(cmd, "-g");
+        break;
+    case PROFILE_RELEASE:
+        nob_cmd_append(cmd, "-O2", "-DNDEBUG");
+        break;
+    case PROFILE_LTO:
+        nob_cmd_append(cmd, "-O2", "-DNDEBUG", "-flto");
+        break;
+    case PROFILE_PGO:
+        nob_cmd_append(cmd, "-O2", "-DNDEBUG");
+        if (pgo_generate) {
+            nob_cmd_append(cmd, "-fprofile-generate");
+        } else {
+            nob_cmd_append(cmd, "-fprofile-use", "-fprofile-correction", "-Wno-missing-profile");
+        }
+        break;
+    default:
+        NOB_ASSERT(0 && "unreachable");
+    }
+}
+
+// Objects of different profiles and build modes live in different directories so they never clobber
+// each other. The debug profile keeps the plain directory names.
+const char *build_suffix(void)
+{
+    bool full = features == &feature_profiles[0];
+    return nob_temp_sprintf("%s%s%s%s%s%s%s",
+                            profile == PROFILE_DEBUG ? "" : "-",
+                            profile == PROFILE_DEBUG ? "" : profile_names[profile],
+                            full ? "" : "-",
+                            full ? "" : features->name,
+                            headless ? "-headless" : "",
+                            (experimental_batch && !headless) ? "-batch" : "",
+                            unity_shards > 0 ? "-unity" : "");
+}
+
+const char *raylib_build_dir(const char *target_name)
+{
+    return nob_temp_sprintf("./build/raylib-%s%s", target_name, build_suffix());
+}
+
+// Rough cost of compiling a module: its own size plus the size of the external headers it includes
+size_t module_weight(const char *module)
+{
+    size_t weight = 0;
+    Nob_String_Builder sb = {0};
+    Nob_String_Builder header_sb = {0};
+
+    if (!nob_read_entire_file(nob_temp_sprintf("./src/ext/raylib-5.0/src/%s.c", module), &sb)) goto defer;
+    weight += sb.count;
+
+    Nob_String_View content = nob_sv_from_parts(sb.items, sb.count);
+    while (content.count > 0) {
+        Nob_String_View line = nob_sv_trim(nob_sv_chop_by_delim(&content, '\n'));
+        if (!sv_starts_with(line, "#include \"external/")) continue;
+
+        nob_sv_chop_by_delim(&line, '"');
+        Nob_String_View header = nob_sv_chop_by_delim(&line, '"');
+        header_sb.count = 0;
+        if (nob_read_entire_file(nob_temp_sprintf("./src/ext/raylib-5.0/src/"SV_Fmt, SV_Arg(header)), &header_sb)) {
+            weight += header_sb.count;
+        }
+    }
+
+defer:
+    nob_sb_free(sb);
+    nob_sb_free(header_sb);
+    return weight;
+}
+
+// Sources raylib is compiled from for the given modules: the modules themselves, or unity shards
+// generated into build_dir that amalgamate them when --unity is on
+bool collect_raylib_sources(const char *build_dir, const char **mods, size_t mods_count, Nob_File_Paths *sources)
+{
+    bool result = true;
+    Nob_File_Paths unity = {0};
+    Nob_String_Builder sb = {0};
+    size_t weights[NOB_ARRAY_LEN(unity_order)] = {0};
+
+    if (!nob_mkdir_if_not_exists("build"))   nob_return_defer(false);
+    if (!nob_mkdir_if_not_exists(build_dir)) nob_return_defer(false);
+
+    for (size_t i = 0; i < mods_count; i++) {
+        if (!module_enabled(mods[i])) continue;
+        bool amalgamated = false;
+        for (size_t j = 0; unity_shards > 0 && j < NOB_ARRAY_LEN(unity_order); j++) {
+            if (strcmp(mods[i], unity_order[j]) == 0) amalgamated = true;
+        }
+        if (!amalgamated) nob_da_append(sources, nob_temp_sprintf("./src/ext/raylib-5.0/src/%s.c", mods[i]));
+    }
+    if (unity_shards == 0) nob_return_defer(true);
+
+    size_t total_weight = 0;
+    for (size_t j = 0; j < NOB_ARRAY_LEN(unity_order); j++) {
+        for (size_t i = 0; i < mods_count; i++) {
+            if (strcmp(mods[i], unity_order[j]) != 0 || !module_enabled(mods[i])) continue;
+            weights[unity.count] = module_weight(unity_order[j]);
+            total_weight += weights[unity.count];
+            nob_da_append(&unity, unity_order[j]);
+        }
+    }
+
+    /* split the modules into contiguous shards of about the same weight, keeping the order above */
+    size_t shards = unity_shards < unity.count ? unity_shards : unity.count;
+    size_t begin = 0;
+    for (size_t shard = 0; shard < shards; shard++) {
+        size_t shards_left = shards - shard;
+        size_t target = total_weight/shards_left;
+        size_t weight = weights[begin];
+        size_t end = begin + 1;
+        while (end < unity.count && unity.count - end > shards_left - 1 && weight + weights[end]/2 <= target) {
+            weight += weights[end];
+            end += 1;
+        }
+        if (shards_left == 1) end = unity.count;
+
+        // NOTE: build_dir is always two levels deep, see raylib_build_dir
+        sb.count = 0;
+        nob_sb_append_cstr(&sb, "// Generated by nob.c, do not edit\n");
+        for (size_t i = begin; i < end; i++) {
+            nob_sb_append_cstr(&sb, nob_temp_sprintf("#include \"../../src/ext/raylib-5.0/src/%s.c\"\n", unity.items[i]));
+        }
+        const char *path = nob_temp_sprintf("%s/raylib_unity_%zu.c", build_dir, shard);
+        if (!write_file_if_changed(path, sb)) nob_return_defer(false);
+        nob_da_append(sources, path);
+
+        total_weight -= weight;
+        begin = end;
+    }
+
+defer:
+    nob_da_free(unity);
+    nob_sb_free(sb);
+    return result;
+}
+
+// Schedules the archive (or any other kind of library) step, which waits for every object job.
+// Nothing is scheduled if the library is already up to date and lib_job is left as NOB_NO_JOB.
+bool schedule_lib(Nob_Jobs *jobs, Nob_Cmd cmd, const char *lib_path, Nob_File_Paths obj_files, Nob_Job_Ids obj_jobs, size_t *lib_job)
+{
+    *lib_job = NOB_NO_JOB;
+    if (obj_jobs.count == 0) {
+        int rebuild = nob_needs_rebuild(lib_path, obj_files.items, obj_files.count);
+        if (rebuild < 0) return false;
+        if (!rebuild)    return true;
+    }
+
+    // NOTE: ar only ever adds and replaces members, so start from scratch to not keep any objects of a
+    // previous configuration (other unity shards for instance) around
+    remove(lib_path);
+    *lib_job = nob_jobs_add(jobs, cmd);
+    for (size_t i = 0; i < obj_jobs.count; i++) {
+        nob_jobs_depend(jobs, *lib_job, obj_jobs.items[i]);
+    }
+    return true;
+}
+
+// Render batch flags of desktop builds, see experimental_batch
+void append_batch_flags(Nob_Cmd *cmd)
+{
+    if (experimental_batch) nob_cmd_append(cmd, "-DRLGL_INTERLEAVED_BATCH", "-DRLGL_MULTI_TEXTURE_BATCH");
+}
+
+// Compiler and flags raylib is compiled with for linux
+void raylib_linux_flags(Nob_Cmd *cmd)
+{
+    nob_cmd_append(cmd, "cc");
+    append_profile_flags(cmd);
+    append_feature_flags(cmd);
+    if (headless) {
+        nob_cmd_append(cmd, "-DPLATFORM_HEADLESS", "-DGRAPHICS_API_OPENGL_11_SOFTWARE", "-fPIC");
+    } else {
+        nob_cmd_append(cmd, "-DPLATFORM_DESKTOP", "-fPIC");
+        append_batch_flags(cmd);
+        nob_cmd_append(cmd, "-I./src/ext/raylib-5.0/src/external/glfw/include");
+    }
+}
+
+bool build_raylib_linux(Nob_Jobs *jobs, size_t *lib_job)
 {
     bool result = true;
     Nob_Cmd cmd = {0};
     Nob_File_Paths obj_files = {0};
+    Nob_Job_Ids obj_jobs = {0};
+    Nob_File_Paths sources = {0};
+    const char *build_dir = raylib_build_dir("linux");
 
     /* build raylib */
-    if (!nob_mkdir_if_not_exists("build"))        nob_return_defer(false);
-    if (!nob_mkdir_if_not_exists("build/raylib-linux")) nob_return_defer(false);
-    Nob_Procs procs = {0};
-    for (size_t i = 0; i < NOB_ARRAY_LEN(modules); i++) {
-        const char *in  = nob_temp_sprintf("./src/ext/raylib-5.0/src/%s.c", modules[i]);
-        const char *out = nob_temp_sprintf("./build/raylib-linux/%s.o", modules[i]);
-        nob_da_append(&obj_files, out);
-        if (nob_needs_rebuild(out, &in, 1)) {
-            cmd.count = 0;
-            nob_cmd_append(&cmd, "cc");
-            nob_cmd_append(&cmd, "-g");
-            nob_cmd_append(&cmd, "-DPLATFORM_DESKTOP", "-fPIC");
-            nob_cmd_append(&cmd, "-I./src/ext/raylib-5.0/src/external/glfw/include");
-            nob_cmd_append(&cmd, "-c", in);
-            nob_cmd_append(&cmd, "-o", out);
-
-            Nob_Proc proc = nob_cmd_run_async(cmd);
-            nob_da_append(&procs, proc);
-        }
-    }
-    if (!nob_procs_wait(procs)) nob_return_defer(false);
+    if (!collect_raylib_sources(build_dir, modules, NOB_ARRAY_LEN(modules), &sources)) nob_return_defer(false);
+    raylib_linux_flags(&cmd);
+    if (!build_raylib_objects(jobs, cmd, build_dir, sources, &obj_files, &obj_jobs)) nob_return_defer(false);
 
-    /* archive raylib as static library */
-    const char *libraylib_path = "./build/raylib-linux/libraylib.a";
-    if (nob_needs_rebuild(libraylib_path, obj_files.items, obj_files.count)) {
+    if (hot_reload) {
+        /* link raylib as shared library, the host and libplug.so have to share its global state */
+        const char *libraylib_path = nob_temp_sprintf("%s/libraylib.so", build_dir);
         cmd.count = 0;
-        nob_cmd_append(&cmd, "ar", "-crs", libraylib_path);
-        for (size_t i = 0; i < NOB_ARRAY_LEN(modules); i++) {
-            const char *in = nob_temp_sprintf("./build/raylib-linux/%s.o", modules[i]);
-            nob_cmd_append(&cmd, in);
-        }
-        if (!nob_cmd_run_sync(cmd)) nob_return_defer(false);
+        nob_cmd_append(&cmd, "cc");
+        append_profile_flags(&cmd);
+        nob_cmd_append(&cmd, "-shared", "-o", libraylib_path);
+        nob_da_append_many(&cmd, obj_files.items, obj_files.count);
+        nob_cmd_append(&cmd, "-lm", "-ldl", "-lpthread");
+        if (!schedule_lib(jobs, cmd, libraylib_path, obj_files, obj_jobs, lib_job)) nob_return_defer(false);
+        nob_return_defer(true);
     }
 
+    /* archive raylib as static library */
+    const char *libraylib_path = nob_temp_sprintf("%s/libraylib.a", build_dir);
+    cmd.count = 0;
+    // NOTE: gcc-ar loads the LTO plugin, so the archive gets a symbol table for the GIMPLE objects
+    nob_cmd_append(&cmd, profile == PROFILE_LTO ? "gcc-ar" : "ar", "-crs", libraylib_path);
+    nob_da_append_many(&cmd, obj_files.items, obj_files.count);
+    if (!schedule_lib(jobs, cmd, libraylib_path, obj_files, obj_jobs, lib_job)) nob_return_defer(false);
+
 defer:
     nob_cmd_free(cmd);
     nob_da_free(obj_files);
-    nob_da_free(procs);
+    nob_da_free(obj_jobs);
+    nob_da_free(sources);
     return result;
 }
 
-bool build_raylib_web()
+bool build_raylib_web(Nob_Jobs *jobs, size_t *lib_job)
 {
     bool result = true;
 
     Nob_Cmd cmd = {0};
     Nob_File_Paths obj_files = {0};
+    Nob_File_Paths web_modules = {0};
+    Nob_Job_Ids obj_jobs = {0};
+    Nob_File_Paths sources = {0};
+    const char *build_dir = raylib_build_dir("web");
 
     /* build raylib */
-    if (!nob_mkdir_if_not_exists("build"))            nob_return_defer(false);
-    if (!nob_mkdir_if_not_exists("build/raylib-web")) nob_return_defer(false);
-    Nob_Procs procs = {0};
-
     for (size_t i = 0; i < NOB_ARRAY_LEN(modules); i++) {
         if (strcmp("rglfw", modules[i]) == 0) continue;
-
-        const char *in  = nob_temp_sprintf("./src/ext/raylib-5.0/src/%s.c", modules[i]);
-        const char *out = nob_temp_sprintf("./build/raylib-web/%s.o", modules[i]);
-        nob_da_append(&obj_files, out);
-        if (nob_needs_rebuild(out, &in, 1)) {
-            cmd.count = 0;
-            nob_cmd_append(&cmd, "emcc");
-            nob_cmd_append(&cmd, "-Os", "-w");
-            nob_cmd_append(&cmd, "-DPLATFORM_WEB", "-DGRAPHICS_API_OPENGL_ES2");
-            nob_cmd_append(&cmd, "-c", in);
-            nob_cmd_append(&cmd, "-o", out);
-
-            Nob_Proc proc = nob_cmd_run_async(cmd);
-            nob_da_append(&procs, proc);
-        }
+        nob_da_append(&web_modules, modules[i]);
     }
-    if (!nob_procs_wait(procs)) nob_return_defer(false);
+    if (!collect_raylib_sources(build_dir, web_modules.items, web_modules.count, &sources)) nob_return_defer(false);
+    nob_cmd_append(&cmd, "emcc");
+    nob_cmd_append(&cmd, "-Os", "-w");
+    nob_cmd_append(&cmd, "-DPLATFORM_WEB", "-DGRAPHICS_API_OPENGL_ES2");
+    append_feature_flags(&cmd);
+    if (!build_raylib_objects(jobs, cmd, build_dir, sources, &obj_files, &obj_jobs)) nob_return_defer(false);
 
     /* archive raylib as static library */
-    const char *libraylib_path = "./build/raylib-web/libraylib.a";
-    if (nob_needs_rebuild(libraylib_path, obj_files.items, obj_files.count)) {
-        cmd.count = 0;
-        nob_cmd_append(&cmd, "emar", "crs", libraylib_path);
-        for (size_t i = 0; i < NOB_ARRAY_LEN(modules); i++) {
-            if (strcmp("rglfw", modules[i]) == 0) continue;
-            const char *in = nob_temp_sprintf("./build/raylib-web/%s.o", modules[i]);
-            nob_cmd_append(&cmd, in);
-        }
-        if (!nob_cmd_run_sync(cmd)) nob_return_defer(false);
-    }
+    const char *libraylib_path = nob_temp_sprintf("%s/libraylib.a", build_dir);
+    cmd.count = 0;
+    nob_cmd_append(&cmd, "emar", "crs", libraylib_path);
+    nob_da_append_many(&cmd, obj_files.items, obj_files.count);
+    if (!schedule_lib(jobs, cmd, libraylib_path, obj_files, obj_jobs, lib_job)) nob_return_defer(false);
 
 defer:
     nob_cmd_free(cmd);
     nob_da_free(obj_files);
-    nob_da_free(procs);
+    nob_da_free(web_modules);
+    nob_da_free(obj_jobs);
+    nob_da_free(sources);
     return result;
 }
 
 
-bool build_raylib_win()
+bool build_raylib_win(Nob_Jobs *jobs, size_t *lib_job)
 {
     bool result = true;
     Nob_Cmd cmd = {0};
     Nob_File_Paths obj_files = {0};
+    Nob_Job_Ids obj_jobs = {0};
+    Nob_File_Paths sources = {0};
+    const char *build_dir = raylib_build_dir("windows");
 
     /* build raylib */
-    if (!nob_mkdir_if_not_exists("build"))        nob_return_defer(false);
-    if (!nob_mkdir_if_not_exists("build/raylib-windows")) nob_return_defer(false);
-    Nob_Procs procs = {0};
-    for (size_t i = 0; i < NOB_ARRAY_LEN(modules); i++) {
-        const char *in  = nob_temp_sprintf("./src/ext/raylib-5.0/src/%s.c", modules[i]);
-        const char *out = nob_temp_sprintf("./build/raylib-windows/%s.o", modules[i]);
-        nob_da_append(&obj_files, out);
-        if (nob_needs_rebuild(out, &in, 1)) {
-            cmd.count = 0;
-            nob_cmd_append(&cmd, "x86_64-w64-mingw32-gcc");
-            nob_cmd_append(&cmd, "-DPLATFORM_DESKTOP", "-fPIC");
-            nob_cmd_append(&cmd, "-I./src/ext/raylib-5.0/src/external/glfw/include");
-            nob_cmd_append(&cmd, "-c", in);
-            nob_cmd_append(&cmd, "-o", out);
-
-            Nob_Proc proc = nob_cmd_run_async(cmd);
-            nob_da_append(&procs, proc);
-        }
-    }
-    if (!nob_procs_wait(procs)) nob_return_defer(false);
+    if (!collect_raylib_sources(build_dir, modules, NOB_ARRAY_LEN(modules), &sources)) nob_return_defer(false);
+    nob_cmd_append(&cmd, "x86_64-w64-mingw32-gcc");
+    nob_cmd_append(&cmd, "-DPLATFORM_DESKTOP", "-fPIC");
+    append_batch_flags(&cmd);
+    append_feature_flags(&cmd);
+    nob_cmd_append(&cmd, "-I./src/ext/raylib-5.0/src/external/glfw/include");
+    if (!build_raylib_objects(jobs, cmd, build_dir, sources, &obj_files, &obj_jobs)) nob_return_defer(false);
 
-    /* archive raylib as static library */
-    cmd.count = 0;
+    /* link raylib as shared library */
     const char *libraylib_path = "./libraylib.dll";
-    if (nob_needs_rebuild(libraylib_path, obj_files.items, obj_files.count)) {
-        nob_cmd_append(&cmd, "x86_64-w64-mingw32-gcc", "-static-libgcc", "-shared", "-o", libraylib_path);
-        for (size_t i = 0; i < NOB_ARRAY_LEN(modules); i++) {
-            const char *in = nob_temp_sprintf("./build/raylib-windows/%s.o", modules[i]);
-            nob_cmd_append(&cmd, in);
-        }
-        nob_cmd_append(&cmd, "-lwinmm", "-lgdi32");
-        if (!nob_cmd_run_sync(cmd)) nob_return_defer(false);
-    }
+    cmd.count = 0;
+    nob_cmd_append(&cmd, "x86_64-w64-mingw32-gcc", "-static-libgcc", "-shared", "-o", libraylib_path);
+    nob_da_append_many(&cmd, obj_files.items, obj_files.count);
+    nob_cmd_append(&cmd, "-lwinmm", "-lgdi32");
+    if (!schedule_lib(jobs, cmd, libraylib_path, obj_files, obj_jobs, lib_job)) nob_return_defer(false);
 
 defer:
     nob_cmd_free(cmd);
     nob_da_free(obj_files);
-    nob_da_free(procs);
+    nob_da_free(obj_jobs);
+    nob_da_free(sources);
     return result;
 }
 
-bool build_exec_linux()
+// Sources of the game executable. With --hot, plug.c becomes libplug.so and hotreload.c loads it.
+static const char *exec_sources[] = {
+    "main",
+    "plug",
+};
+
+// Sources libplug.so is built from, nob watches them with --hot
+static const char *plug_sources[] = {
+    "src/plug.c",
+    "src/plug.h",
+};
+
+// Where the host loads libplug.so from, has to match hotreload.c
+#define LIBPLUG_PATH "./build/libplug.so"
+
+void append_plug_cmd(Nob_Cmd *cmd, const char *out)
+{
+    nob_cmd_append(cmd, "cc");
+    nob_cmd_append(cmd, "-Werror", "-Wall", "-Wextra");
+    append_profile_flags(cmd);
+    nob_cmd_append(cmd, "-I./src/ext/raylib-5.0/src");
+    nob_cmd_append(cmd, "-fPIC", "-shared", "-o", out, "src/plug.c");
+    nob_cmd_append(cmd, nob_temp_sprintf("-L%s", raylib_build_dir("linux")), "-l:libraylib.so");
+}
+
+// main is compiled while raylib is still being built, only linking has to wait for the library
+bool build_exec_linux(Nob_Jobs *jobs, size_t lib_job)
 {
     bool result = true;
-
     Nob_Cmd cmd = {0};
+    Nob_File_Paths objs = {0};
+    Nob_Job_Ids obj_jobs = {0};
+
+    for (size_t i = 0; i < NOB_ARRAY_LEN(exec_sources); i++) {
+        const char *name = exec_sources[i];
+        if (hot_reload && strcmp(name, "plug") == 0) name = "hotreload";
+
+        const char *obj = nob_temp_sprintf("./build/%s-linux%s.o", name, build_suffix());
+        cmd.count = 0;
+        append_launcher(&cmd);
+        nob_cmd_append(&cmd, "cc");
+        nob_cmd_append(&cmd, "-Werror", "-Wall", "-Wextra");
+        append_profile_flags(&cmd);
+        if (hot_reload) nob_cmd_append(&cmd, "-DHOTRELOAD");
+        nob_cmd_append(&cmd, "-I./src/ext/raylib-5.0/src");
+        nob_cmd_append(&cmd, "-c", nob_temp_sprintf("src/%s.c", name), "-o", obj);
+        nob_da_append(&objs, obj);
+        nob_da_append(&obj_jobs, nob_jobs_add(jobs, cmd));
+    }
+
+    cmd.count = 0;
     nob_cmd_append(&cmd, "cc");
-    nob_cmd_append(&cmd, "-Werror", "-Wall", "-Wextra", "-g");
-    nob_cmd_append(&cmd, "-I./src/ext/raylib-5.0/src");
-    nob_cmd_append(&cmd, "-o", "main", "src/main.c");
-    nob_cmd_append(&cmd, "-L./build/raylib-linux", "-l:libraylib.a");
+    append_profile_flags(&cmd);
+    nob_cmd_append(&cmd, "-o", "main");
+    nob_da_append_many(&cmd, objs.items, objs.count);
+    if (hot_reload) {
+        // NOTE: $ORIGIN is expanded by the dynamic loader, so ./main runs from anywhere
+        const char *build_dir = raylib_build_dir("linux");
+        nob_cmd_append(&cmd, nob_temp_sprintf("-L%s", build_dir), "-l:libraylib.so");
+        nob_cmd_append(&cmd, nob_temp_sprintf("-Wl,-rpath,$ORIGIN/%s", build_dir + 2));
+    } else {
+        nob_cmd_append(&cmd, nob_temp_sprintf("-L%s", raylib_build_dir("linux")), "-l:libraylib.a");
+    }
     nob_cmd_append(&cmd, "-lm", "-ldl", "-lpthread");
-    if (!nob_cmd_run_sync(cmd)) nob_return_defer(false);
+    size_t link_job = nob_jobs_add(jobs, cmd);
+    for (size_t i = 0; i < obj_jobs.count; i++) nob_jobs_depend(jobs, link_job, obj_jobs.items[i]);
+    nob_jobs_depend(jobs, link_job, lib_job);
+
+    if (hot_reload) {
+        cmd.count = 0;
+        append_plug_cmd(&cmd, LIBPLUG_PATH);
+        nob_jobs_depend(jobs, nob_jobs_add(jobs, cmd), lib_job);
+    }
 
-defer:
     nob_cmd_free(cmd);
+    nob_da_free(objs);
+    nob_da_free(obj_jobs);
     return result;
 }
 
-bool build_exec_web()
+bool build_exec_web(Nob_Jobs *jobs, size_t lib_job)
 {
     bool result = true;
     Nob_Cmd cmd = {0};
 
+    Nob_Job_Ids obj_jobs = {0};
+
+    for (size_t i = 0; i < NOB_ARRAY_LEN(exec_sources); i++) {
+        cmd.count = 0;
+        append_launcher(&cmd);
+        nob_cmd_append(&cmd, "emcc", "-c", nob_temp_sprintf("./src/%s.c", exec_sources[i]));
+        nob_cmd_append(&cmd, "-Os", "-Wall");
+        nob_cmd_append(&cmd, "-I./src/ext/raylib-5.0/src");
+        nob_cmd_append(&cmd, "-o", nob_temp_sprintf("./build/%s-web.o", exec_sources[i]));
+        nob_da_append(&obj_jobs, nob_jobs_add(jobs, cmd));
+    }
+
+    cmd.count = 0;
     nob_cmd_append(&cmd, "emcc", "-o", "index.js");
-    nob_cmd_append(&cmd, "./src/main.c");
+    for (size_t i = 0; i < NOB_ARRAY_LEN(exec_sources); i++) {
+        nob_cmd_append(&cmd, nob_temp_sprintf("./build/%s-web.o", exec_sources[i]));
+    }
     nob_cmd_append(&cmd, "-Os", "-Wall");
-    nob_cmd_append(&cmd, "-I./src/ext/raylib-5.0/src");
-    nob_cmd_append(&cmd, "-L./build/raylib-web", "-l:libraylib.a");
+    nob_cmd_append(&cmd, nob_temp_sprintf("-L%s", raylib_build_dir("web")), "-l:libraylib.a");
     nob_cmd_append(&cmd, "-s", "USE_GLFW=3");
     nob_cmd_append(&cmd, "-s", "ASYNCIFY");
-    if(!nob_cmd_run_sync(cmd)) nob_return_defer(false);
+    size_t link_job = nob_jobs_add(jobs, cmd);
+    for (size_t i = 0; i < obj_jobs.count; i++) nob_jobs_depend(jobs, link_job, obj_jobs.items[i]);
+    nob_jobs_depend(jobs, link_job, lib_job);
 
-defer:
     nob_cmd_free(cmd);
+    nob_da_free(obj_jobs);
     return result;
 }
 
-bool build_exec_win()
+bool build_exec_win(Nob_Jobs *jobs, size_t lib_job)
 {
     bool result = true;
 
     Nob_Cmd cmd = {0};
+    Nob_Job_Ids obj_jobs = {0};
+
+    for (size_t i = 0; i < NOB_ARRAY_LEN(exec_sources); i++) {
+        cmd.count = 0;
+        append_launcher(&cmd);
+        nob_cmd_append(&cmd, "x86_64-w64-mingw32-gcc");
+        nob_cmd_append(&cmd, "-I./src/ext/raylib-5.0/src");
+        nob_cmd_append(&cmd, "-c", nob_temp_sprintf("src/%s.c", exec_sources[i]));
+        nob_cmd_append(&cmd, "-o", nob_temp_sprintf("./build/%s-windows.o", exec_sources[i]));
+        nob_da_append(&obj_jobs, nob_jobs_add(jobs, cmd));
+    }
+
+    cmd.count = 0;
     nob_cmd_append(&cmd, "x86_64-w64-mingw32-gcc");
-    nob_cmd_append(&cmd, "-I./src/ext/raylib-5.0/src");
-    nob_cmd_append(&cmd, "-o", "main", "src/main.c");
-    nob_cmd_append(&cmd, "-L./build/raylib-windows", "-l:libraylib.dll");
+    nob_cmd_append(&cmd, "-o", "main");
+    for (size_t i = 0; i < NOB_ARRAY_LEN(exec_sources); i++) {
+        nob_cmd_append(&cmd, nob_temp_sprintf("./build/%s-windows.o", exec_sources[i]));
+    }
+    nob_cmd_append(&cmd, nob_temp_sprintf("-L%s", raylib_build_dir("windows")), "-l:libraylib.dll");
     nob_cmd_append(&cmd, "-lwinmm", "-lgdi32");
-    if (!nob_cmd_run_sync(cmd)) nob_return_defer(false);
+    size_t link_job = nob_jobs_add(jobs, cmd);
+    for (size_t i = 0; i < obj_jobs.count; i++) nob_jobs_depend(jobs, link_job, obj_jobs.items[i]);
+    nob_jobs_depend(jobs, link_job, lib_job);
+
+    nob_cmd_free(cmd);
+    nob_da_free(obj_jobs);
+    return result;
+}
+
+double now_secs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec*1e-9;
+}
+
+// Builds raylib for linux from scratch, once a translation unit per module and once amalgamated into a
+// single unity translation unit. Every build runs in a forked child so the wall time and the peak RSS
+// of its compilers can be told apart. The object cache is off, it would make both builds instant.
+bool bench_unity(void)
+{
+    size_t variants[] = { 0, 1 };
+    double wall[NOB_ARRAY_LEN(variants)] = {0};
+    long maxrss[NOB_ARRAY_LEN(variants)] = {0};
+
+    cache_enabled = false;
+    for (size_t i = 0; i < NOB_ARRAY_LEN(variants); i++) {
+        unity_shards = variants[i];
+        Nob_Cmd cmd = {0};
+        nob_cmd_append(&cmd, "rm", "-rf", raylib_build_dir("linux"));
+        bool cleaned = nob_cmd_run_sync(cmd);
+        nob_cmd_free(cmd);
+        if (!cleaned) return false;
+
+        double start = now_secs();
+        pid_t pid = fork();
+        if (pid < 0) {
+            nob_log(NOB_ERROR, "could not fork: %s", strerror(errno));
+            return false;
+        }
+        if (pid == 0) {
+            Nob_Jobs jobs = {0};
+            size_t lib_job = NOB_NO_JOB;
+            if (!build_raylib_linux(&jobs, &lib_job)) exit(1);
+            exit(nob_jobs_run(&jobs, max_jobs) ? 0 : 1);
+        }
+
+        int wstatus = 0;
+        struct rusage usage = {0};
+        if (wait4(pid, &wstatus, 0, &usage) < 0) {
+            nob_log(NOB_ERROR, "could not wait on benchmark build: %s", strerror(errno));
+            return false;
+        }
+        if (!WIFEXITED(wstatus) || WEXITSTATUS(wstatus) != 0) {
+            nob_log(NOB_ERROR, "benchmark build failed");
+            return false;
+        }
+        wall[i] = now_secs() - start;
+        maxrss[i] = usage.ru_maxrss;
+    }
+
+    nob_log(NOB_INFO, "cold raylib build with -j %zu:", max_jobs);
+    nob_log(NOB_INFO, "    %-12s %10s %24s", "mode", "wall time", "peak RSS (one compiler)");
+    for (size_t i = 0; i < NOB_ARRAY_LEN(variants); i++) {
+        nob_log(NOB_INFO, "    %-12s %9.2fs %20ld MiB", variants[i] ? "unity" : "per-module", wall[i], maxrss[i]/1024);
+    }
+    return true;
+}
+
+// Compiles every module of pch_modules for linux once as it is and once split around its precompiled
+// prelude. Building the precompiled header is paid once, what gets faster is compiling the module every
+// time it changes while its externals don't.
+bool bench_pch(void)
+{
+    bool result = true;
+    Nob_Cmd flags = {0};
+    Nob_Cmd cmd = {0};
+    const char *dir = "./build/bench-pch";
+
+    if (!nob_mkdir_if_not_exists("build")) nob_return_defer(false);
+    if (!nob_mkdir_if_not_exists(dir))     nob_return_defer(false);
+    raylib_linux_flags(&flags);
+    nob_cmd_append(&flags, PCH_INCLUDE);
+
+    double plain[NOB_ARRAY_LEN(pch_modules)] = {0};
+    double build[NOB_ARRAY_LEN(pch_modules)] = {0};
+    double with[NOB_ARRAY_LEN(pch_modules)] = {0};
+    for (size_t i = 0; i < NOB_ARRAY_LEN(pch_modules); i++) {
+        const char *source = nob_temp_sprintf("./src/ext/raylib-5.0/src/%s.c", pch_modules[i]);
+        const char *header = nob_temp_sprintf("%s/%s_pch.h", dir, pch_modules[i]);
+        const char *body   = nob_temp_sprintf("%s/%s_pch.c", dir, pch_modules[i]);
+        if (!split_pch_module(source, header, body)) nob_return_defer(false);
+
+        double start = now_secs();
+        cmd.count = 0;
+        nob_da_append_many(&cmd, flags.items, flags.count);
+        nob_cmd_append(&cmd, "-c", source, "-o", nob_temp_sprintf("%s/%s.o", dir, pch_modules[i]));
+        if (!nob_cmd_run_sync(cmd)) nob_return_defer(false);
+        plain[i] = now_secs() - start;
+
+        start = now_secs();
+        cmd.count = 0;
+        nob_da_append_many(&cmd, flags.items, flags.count);
+        nob_cmd_append(&cmd, "-x", "c-header", header, "-o", nob_temp_sprintf("%s.gch", header));
+        if (!nob_cmd_run_sync(cmd)) nob_return_defer(false);
+        build[i] = now_secs() - start;
+
+        start = now_secs();
+        cmd.count = 0;
+        nob_da_append_many(&cmd, flags.items, flags.count);
+        nob_cmd_append(&cmd, "-Winvalid-pch", "-c", body, "-o", nob_temp_sprintf("%s/%s_pch.o", dir, pch_modules[i]));
+        if (!nob_cmd_run_sync(cmd)) nob_return_defer(false);
+        with[i] = now_secs() - start;
+    }
+
+    nob_log(NOB_INFO, "compile time of the modules for linux, profile %s:", profile_names[profile]);
+    nob_log(NOB_INFO, "    %-10s %10s %10s %10s %8s", "module", "plain", "pch build", "with pch", "speedup");
+    for (size_t i = 0; i < NOB_ARRAY_LEN(pch_modules); i++) {
+        nob_log(NOB_INFO, "    %-10s %9.2fs %9.2fs %9.2fs %7.2fx", pch_modules[i], plain[i], build[i], with[i], plain[i]/with[i]);
+    }
 
 defer:
+    nob_cmd_free(flags);
     nob_cmd_free(cmd);
     return result;
 }
 
+#define TRACE_PATH "./build/trace.json"
+
+int compare_trace_duration(const void *a, const void *b)
+{
+    const Nob_Trace_Event *ea = *(const Nob_Trace_Event**)a;
+    const Nob_Trace_Event *eb = *(const Nob_Trace_Event**)b;
+    double da = ea->end - ea->start;
+    double db = eb->end - eb->start;
+    return (da < db) - (da > db);
+}
+
+// Log the slowest translation units of the trace, that is where the build time goes
+void log_trace_summary(size_t top)
+{
+    Nob_Trace_Event **compiles = NOB_REALLOC(NULL, (nob_trace.count + 1)*sizeof(*compiles));
+    NOB_ASSERT(compiles != NULL && "Buy more RAM lol");
+    size_t count = 0;
+    for (size_t i = 0; i < nob_trace.count; i++) {
+        if (nob_trace.items[i].finished && strstr(nob_trace.items[i].cmd, " -c ")) {
+            compiles[count++] = &nob_trace.items[i];
+        }
+    }
+    qsort(compiles, count, sizeof(*compiles), compare_trace_duration);
+
+    nob_log(NOB_INFO, "slowest translation units:");
+    nob_log(NOB_INFO, "    %8s %10s %6s  %s", "time", "peak RSS", "status", "file");
+    for (size_t i = 0; i < count && i < top; i++) {
+        const Nob_Trace_Event *event = compiles[i];
+        const char *file = strchr(event->name, ' ');
+        nob_log(NOB_INFO, "    %7.2fs %6ld MiB %6d  %s", event->end - event->start, event->maxrss_kb/1024,
+                event->exit_status, file ? file + 1 : event->name);
+    }
+    NOB_FREE(compiles);
+}
+
 void log_usage()
 {
     nob_log(NOB_ERROR, "usage: ./nob <flags>");
     nob_log(NOB_ERROR, "    -t <target> ([w]eb, [l]inux)");
+    nob_log(NOB_ERROR, "    -p <profile> (debug, release, lto, pgo)");
+    nob_log(NOB_ERROR, "    -f <features> (full, lean, minimal)");
+    nob_log(NOB_ERROR, "    -j <jobs>   (amount of parallel commands, defaults to the amount of cpus)");
+    nob_log(NOB_ERROR, "    --unity [shards] (amalgamate raylib into one or more translation units)");
+    nob_log(NOB_ERROR, "    --no-cache  (do not use the object cache)");
+    nob_log(NOB_ERROR, "    --launcher <cmd> (run every compile through cmd, like ccache, defaults to $NOB_LAUNCHER)");
+    nob_log(NOB_ERROR, "    --hot       (run the game with its logic in "LIBPLUG_PATH" and reload it whenever src/plug.* change, linux only)");
+    nob_log(NOB_ERROR, "    --headless  (render raylib in software into memory, no display or GPU needed, linux only)");
+    nob_log(NOB_ERROR, "    --exp-batch (desktop raylib with the render batch variants not yet run on real GL drivers)");
+    nob_log(NOB_ERROR, "    --pch       (compile the externals of the heavy modules through precompiled headers, linux only)");
+    nob_log(NOB_ERROR, "    --trace     (write a chrome trace of the build to "TRACE_PATH" and log the slowest files)");
+    nob_log(NOB_ERROR, "    --bench-unity (compare cold per-module and unity builds of raylib for linux)");
+    nob_log(NOB_ERROR, "    --bench-pch (compare compiling the heavy modules with and without precompiled headers)");
+    nob_log(NOB_ERROR, "    --bench-features (compare size and startup time of the game across feature profiles)");
+    nob_log(NOB_ERROR, "    --bench <name> (build bench/<name>.c against raylib for linux and run it)");
 }
 
 typedef enum {
@@ -258,6 +1330,244 @@ const char *host_names[] = {
     [HOST_MAC] = "host mac",
 };
 
+// Schedule everything the target needs and run it
+bool build_target(void)
+{
+    bool result = true;
+    Nob_Jobs jobs = {0};
+    size_t lib_job = NOB_NO_JOB;
+
+    switch (target) {
+    case TARGET_LINUX:
+        if (!build_raylib_linux(&jobs, &lib_job)) nob_return_defer(false);
+        if (!build_exec_linux(&jobs, lib_job))    nob_return_defer(false);
+        break;
+    case TARGET_WEB:
+        if (!build_raylib_web(&jobs, &lib_job)) nob_return_defer(false);
+        if (!build_exec_web(&jobs, lib_job))    nob_return_defer(false);
+        break;
+    case TARGET_WINDOWS:
+        if (!build_raylib_win(&jobs, &lib_job)) nob_return_defer(false);
+        if (!build_exec_win(&jobs, lib_job))    nob_return_defer(false);
+        break;
+    default:
+        nob_log(NOB_ERROR, "target %s not supported", target_names[target]);
+        log_usage();
+        nob_return_defer(false);
+    }
+    if (!nob_jobs_run(&jobs, max_jobs)) nob_return_defer(false);
+    if (!cache_store()) nob_return_defer(false);
+    if (!launcher_stats()) nob_return_defer(false);
+
+defer:
+    nob_jobs_free(&jobs);
+    return result;
+}
+
+// Remove the profile counters an instrumented run left next to the objects in dir
+bool remove_gcda(const char *dir)
+{
+    Nob_File_Paths children = {0};
+    bool result = nob_read_entire_dir(dir, &children);
+    for (size_t i = 0; result && i < children.count; i++) {
+        size_t n = strlen(children.items[i]);
+        if (n < 5 || strcmp(children.items[i] + n - 5, ".gcda") != 0) continue;
+
+        const char *path = nob_temp_sprintf("%s/%s", dir, children.items[i]);
+        if (remove(path) < 0) {
+            nob_log(NOB_ERROR, "could not remove %s: %s", path, strerror(errno));
+            result = false;
+        }
+    }
+    nob_da_free(children);
+    return result;
+}
+
+// Two phase PGO: build instrumented, run the training workload to collect the profile, then rebuild
+// everything with it. Both phases share the object directories since gcc keeps the profile of every
+// object in a .gcda file next to it.
+bool build_pgo_linux(void)
+{
+    bool result = true;
+    Nob_Cmd cmd = {0};
+
+    // NOTE: the object cache is keyed by the preprocessed source, which doesn't change with the profile
+    cache_enabled = false;
+    force_rebuild = true;
+
+    pgo_generate = true;
+    if (!build_target()) nob_return_defer(false);
+    if (!remove_gcda(raylib_build_dir("linux"))) nob_return_defer(false);
+    if (!remove_gcda("./build"))                 nob_return_defer(false);
+    nob_cmd_append(&cmd, "./main", "--frames", PGO_TRAINING_FRAMES);
+    if (!nob_cmd_run_sync(cmd)) nob_return_defer(false);
+
+    pgo_generate = false;
+    if (!build_target()) nob_return_defer(false);
+
+defer:
+    force_rebuild = false;
+    nob_cmd_free(cmd);
+    return result;
+}
+
+// Latest modification of any of the files, with the nanoseconds so quick successive saves are told apart
+double newest_mtime(const char **paths, size_t count)
+{
+    double newest = 0;
+    for (size_t i = 0; i < count; i++) {
+        struct stat st = {0};
+        if (stat(paths[i], &st) < 0) continue;
+        double mtime = st.st_mtim.tv_sec + st.st_mtim.tv_nsec*1e-9;
+        if (mtime > newest) newest = mtime;
+    }
+    return newest;
+}
+
+// Runs the host built with --hot and rebuilds libplug.so every time its sources change, until the host
+// exits. The new library is renamed into place so the host never loads one that is half written, a
+// build that fails leaves the running one alone.
+bool watch_plug_linux(void)
+{
+    bool result = true;
+    Nob_Cmd cmd = {0};
+    double built = newest_mtime(plug_sources, NOB_ARRAY_LEN(plug_sources));
+
+    nob_cmd_append(&cmd, "./main");
+    Nob_Proc host = nob_cmd_run_async(cmd);
+    if (host == NOB_INVALID_PROC) nob_return_defer(false);
+    nob_log(NOB_INFO, "watching the sources of "LIBPLUG_PATH", close the window to stop");
+
+    for (;;) {
+        int wstatus = 0;
+        pid_t pid = waitpid(host, &wstatus, WNOHANG);
+        if (pid < 0) {
+            nob_log(NOB_ERROR, "could not wait on the host: %s", strerror(errno));
+            nob_return_defer(false);
+        }
+        if (pid == host) {
+            if (!WIFEXITED(wstatus) || WEXITSTATUS(wstatus) != 0) nob_return_defer(false);
+            nob_return_defer(true);
+        }
+
+        double mtime = newest_mtime(plug_sources, NOB_ARRAY_LEN(plug_sources));
+        if (mtime != built) {
+            built = mtime;
+            double start = now_secs();
+            cmd.count = 0;
+            append_plug_cmd(&cmd, LIBPLUG_PATH".tmp");
+            if (nob_cmd_run_sync(cmd) && nob_rename(LIBPLUG_PATH".tmp", LIBPLUG_PATH)) {
+                nob_log(NOB_INFO, "rebuilt "LIBPLUG_PATH" in %.2fs", now_secs() - start);
+            } else {
+                nob_log(NOB_ERROR, "could not rebuild "LIBPLUG_PATH", the host keeps running the old one");
+            }
+        }
+
+        struct timespec poll_interval = { .tv_sec = 0, .tv_nsec = 100*1000*1000 };
+        nanosleep(&poll_interval, NULL);
+    }
+
+defer:
+    nob_cmd_free(cmd);
+    return result;
+}
+
+long file_size(const char *path)
+{
+    struct stat st = {0};
+    if (stat(path, &st) < 0) {
+        nob_log(NOB_ERROR, "could not stat %s: %s", path, strerror(errno));
+        return -1;
+    }
+    return st.st_size;
+}
+
+#define STARTUP_RUNS 5
+
+// Builds the game for linux with every feature profile and compares the size of the executable and
+// the time from starting it to the end of its first frame, the best of a few runs
+bool bench_features(void)
+{
+    long size[NOB_ARRAY_LEN(feature_profiles)] = {0};
+    double startup[NOB_ARRAY_LEN(feature_profiles)] = {0};
+
+    for (size_t i = 0; i < NOB_ARRAY_LEN(feature_profiles); i++) {
+        features = &feature_profiles[i];
+        if (!write_features_header()) return false;
+        if (!build_target()) return false;
+        size[i] = file_size("main");
+        if (size[i] < 0) return false;
+
+        Nob_Cmd cmd = {0};
+        nob_cmd_append(&cmd, "./main", "--frames", "1");
+        for (size_t run = 0; run < STARTUP_RUNS; run++) {
+            double start = now_secs();
+            if (!nob_cmd_run_sync(cmd)) {
+                nob_cmd_free(cmd);
+                return false;
+            }
+            double elapsed = now_secs() - start;
+            if (run == 0 || elapsed < startup[i]) startup[i] = elapsed;
+        }
+        nob_cmd_free(cmd);
+    }
+
+    nob_log(NOB_INFO, "feature profiles for linux, profile %s:", profile_names[profile]);
+    nob_log(NOB_INFO, "    %-10s %12s %10s %12s %10s", "features", "main size", "delta", "startup", "delta");
+    for (size_t i = 0; i < NOB_ARRAY_LEN(feature_profiles); i++) {
+        nob_log(NOB_INFO, "    %-10s %9ld KiB %+9.1f%% %10.1fms %+9.1f%%", feature_profiles[i].name,
+                size[i]/1024, 100.0*(size[i] - size[0])/size[0],
+                startup[i]*1000, 100.0*(startup[i] - startup[0])/startup[0]);
+    }
+    return true;
+}
+
+// Name of the program in bench/ that --bench runs
+const char *bench_name = NULL;
+
+// Builds raylib for linux with the current profile, features and flags, links bench/<name>.c against it
+// and runs it. Benchmarks of raylib itself live there, they measure and report on their own.
+bool bench_program(void)
+{
+    bool result = true;
+    Nob_Jobs jobs = {0};
+    Nob_Cmd cmd = {0};
+    size_t lib_job = NOB_NO_JOB;
+
+    if (hot_reload) {
+        nob_log(NOB_ERROR, "--bench links raylib statically, it can not be combined with --hot");
+        nob_return_defer(false);
+    }
+
+    const char *source = nob_temp_sprintf("./bench/%s.c", bench_name);
+    const char *exe = nob_temp_sprintf("./build/bench-%s%s", bench_name, build_suffix());
+    if (nob_file_exists(source) != 1) {
+        nob_log(NOB_ERROR, "benchmark %s does not exist", source);
+        nob_return_defer(false);
+    }
+
+    if (!build_raylib_linux(&jobs, &lib_job)) nob_return_defer(false);
+    nob_cmd_append(&cmd, "cc");
+    nob_cmd_append(&cmd, "-Werror", "-Wall", "-Wextra");
+    append_profile_flags(&cmd);
+    nob_cmd_append(&cmd, "-I./src/ext/raylib-5.0/src");
+    nob_cmd_append(&cmd, "-o", exe, source);
+    nob_cmd_append(&cmd, nob_temp_sprintf("-L%s", raylib_build_dir("linux")), "-l:libraylib.a");
+    nob_cmd_append(&cmd, "-lm", "-ldl", "-lpthread");
+    nob_jobs_depend(&jobs, nob_jobs_add(&jobs, cmd), lib_job);
+    if (!nob_jobs_run(&jobs, max_jobs)) nob_return_defer(false);
+    if (!cache_store()) nob_return_defer(false);
+
+    cmd.count = 0;
+    nob_cmd_append(&cmd, exe);
+    if (!nob_cmd_run_sync(cmd)) nob_return_defer(false);
+
+defer:
+    nob_jobs_free(&jobs);
+    nob_cmd_free(cmd);
+    return result;
+}
+
 int main(int argc, char **argv)
 {
     NOB_GO_REBUILD_URSELF(argc, argv);
@@ -270,9 +1580,43 @@ int main(int argc, char **argv)
     /* process cmd args */
     char *program = nob_shift_args(&argc, &argv);
     bool target_found = false;
+    bool (*bench)(void) = NULL;
+    const char *launcher_arg = getenv("NOB_LAUNCHER");
+    bool trace = false;
     while (argc > 0) {
         char *arg = nob_shift_args(&argc, &argv);
-        if (arg[0] - '-' == 0 && argc > 0) {
+        if (strcmp(arg, "--unity") == 0) {
+            unity_shards = 1;
+            if (argc > 0 && isdigit(**argv)) unity_shards = strtoul(nob_shift_args(&argc, &argv), NULL, 10);
+            if (unity_shards == 0) {
+                nob_log(NOB_ERROR, "--unity expects a positive amount of shards");
+                log_usage();
+                return 1;
+            }
+        } else if (strcmp(arg, "--no-cache") == 0) {
+            cache_enabled = false;
+        } else if (strcmp(arg, "--launcher") == 0 && argc > 0) {
+            launcher_arg = nob_shift_args(&argc, &argv);
+        } else if (strcmp(arg, "--hot") == 0) {
+            hot_reload = true;
+        } else if (strcmp(arg, "--headless") == 0) {
+            headless = true;
+        } else if (strcmp(arg, "--exp-batch") == 0) {
+            experimental_batch = true;
+        } else if (strcmp(arg, "--pch") == 0) {
+            pch_enabled = true;
+        } else if (strcmp(arg, "--bench-unity") == 0) {
+            bench = bench_unity;
+        } else if (strcmp(arg, "--bench-pch") == 0) {
+            bench = bench_pch;
+        } else if (strcmp(arg, "--bench-features") == 0) {
+            bench = bench_features;
+        } else if (strcmp(arg, "--bench") == 0 && argc > 0) {
+            bench_name = nob_shift_args(&argc, &argv);
+            bench = bench_program;
+        } else if (strcmp(arg, "--trace") == 0) {
+            trace = true;
+        } else if (arg[0] - '-' == 0 && argc > 0) {
             if (strcmp(arg, "-t") == 0) {
                 char *target_arg = nob_shift_args(&argc, &argv);
                 for (size_t i = 0; i < NOB_ARRAY_LEN(target_names); i++) {
@@ -290,32 +1634,87 @@ int main(int argc, char **argv)
                     log_usage();
                     return 1;
                 }
+            } else if (strcmp(arg, "-p") == 0) {
+                char *profile_arg = nob_shift_args(&argc, &argv);
+                bool profile_found = false;
+                for (size_t i = 0; i < NOB_ARRAY_LEN(profile_names); i++) {
+                    if (strcmp(profile_arg, profile_names[i]) == 0) {
+                        profile = i;
+                        profile_found = true;
+                    }
+                }
+                if (!profile_found) {
+                    nob_log(NOB_ERROR, "profile %s does not exist", profile_arg);
+                    log_usage();
+                    return 1;
+                }
+            } else if (strcmp(arg, "-f") == 0) {
+                char *features_arg = nob_shift_args(&argc, &argv);
+                bool features_found = false;
+                for (size_t i = 0; i < NOB_ARRAY_LEN(feature_profiles); i++) {
+                    if (strcmp(features_arg, feature_profiles[i].name) == 0) {
+                        features = &feature_profiles[i];
+                        features_found = true;
+                    }
+                }
+                if (!features_found) {
+                    nob_log(NOB_ERROR, "feature profile %s does not exist", features_arg);
+                    log_usage();
+                    return 1;
+                }
+            } else if (strcmp(arg, "-j") == 0) {
+                char *jobs_arg = nob_shift_args(&argc, &argv);
+                max_jobs = strtoul(jobs_arg, NULL, 10);
+                if (max_jobs == 0) {
+                    nob_log(NOB_ERROR, "-j expects a positive amount of jobs, got %s", jobs_arg);
+                    log_usage();
+                    return 1;
+                }
             } else {
                 log_usage();
                 return 1;
             }
         }
     }
+    if (max_jobs == 0) max_jobs = nob_nprocs();
+    if (!write_features_header()) return 1;
+    if (launcher_arg && !set_launcher(launcher_arg)) return 1;
+    if (bench) return bench() ? 0 : 1;
+    if (profile != PROFILE_DEBUG && target != TARGET_LINUX) {
+        nob_log(NOB_ERROR, "profile %s is only supported for target linux", profile_names[profile]);
+        return 1;
+    }
+    if (pch_enabled && target != TARGET_LINUX) {
+        nob_log(NOB_ERROR, "--pch is only supported for target linux");
+        return 1;
+    }
+    if (hot_reload && target != TARGET_LINUX) {
+        nob_log(NOB_ERROR, "--hot is only supported for target linux");
+        return 1;
+    }
+    if (headless && target != TARGET_LINUX) {
+        nob_log(NOB_ERROR, "--headless is only supported for target linux");
+        return 1;
+    }
+
+    if (trace) nob_trace_enable();
+    bool built = profile == PROFILE_PGO ? build_pgo_linux() : build_target();
+    if (trace) {
+        if (!nob_trace_write_json(TRACE_PATH)) return 1;
+        log_trace_summary(10);
+    }
+    if (!built) return 1;
+    if (hot_reload) return watch_plug_linux() ? 0 : 1;
 
+    /* run after building*/
     Nob_Cmd cmd = {0};
     switch (target) {
     case TARGET_LINUX:
-        if (!build_raylib_linux()) return 1;
-        if (!build_exec_linux())   return 1;
-
-        /* run after building*/
         nob_cmd_append(&cmd, "./main");
+        if (headless) nob_cmd_append(&cmd, "--frames", HEADLESS_FRAMES);
         if (!nob_cmd_run_sync(cmd)) return 1;
         break;
-    case TARGET_WEB:
-        if (!build_raylib_web()) return 1;
-        if (!build_exec_web())   return 1;
-        break;
     case TARGET_WINDOWS:
-        if (!build_raylib_win()) return 1;
-        if (!build_exec_win())   return 1;
-
-        /* run after building*/
         if (host != HOST_LINUX) {
             nob_log(NOB_ERROR, "target windows expects host linux for now");
             return 1;
@@ -324,10 +1723,8 @@ int main(int argc, char **argv)
         if (!nob_cmd_run_sync(cmd)) return 1;
         break;
     default:
-        nob_log(NOB_ERROR, "target %s not supported", target_names[target]);
-        log_usage();
-        return 1;
-    } 
+        break;
+    }
 
     nob_cmd_free(cmd);
     return 0;
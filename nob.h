@@ -48,10 +48,16 @@
 #    include <windows.h>
 #    include <direct.h>
 #    include <shellapi.h>
+#    ifndef PSAPI_VERSION
+#        define PSAPI_VERSION 2 // GetProcessMemoryInfo from kernel32, no psapi library to link
+#    endif
+#    include <psapi.h>
 #else
 #    include <sys/types.h>
 #    include <sys/wait.h>
 #    include <sys/stat.h>
+#    include <sys/resource.h>
+#    include <time.h>
 #    include <unistd.h>
 #    include <fcntl.h>
 #endif
@@ -180,6 +186,14 @@ bool nob_procs_wait(Nob_Procs procs);
 // Wait until the process has finished
 bool nob_proc_wait(Nob_Proc proc);
 
+// Wait until any of the processes has finished and remove it from procs. The finished process is
+// returned and `success` tells whether it exited successfully. Returns NOB_INVALID_PROC if there is
+// nothing to wait on or waiting failed.
+Nob_Proc nob_procs_wait_any(Nob_Procs *procs, bool *success);
+
+// Amount of processors currently online. Good default for the amount of parallel jobs.
+size_t nob_nprocs(void);
+
 // A command - the main workhorse of Nob. Nob is all about building commands an running them
 typedef struct {
     const char **items;
@@ -204,6 +218,80 @@ Nob_Proc nob_cmd_run_async(Nob_Cmd cmd);
 // Run command synchronously
 bool nob_cmd_run_sync(Nob_Cmd cmd);
 
+// Id of a job in Nob_Jobs. NOB_NO_JOB can be used anywhere a dependency is expected and is ignored.
+#define NOB_NO_JOB ((size_t)-1)
+
+typedef struct {
+    size_t *items;
+    size_t count;
+    size_t capacity;
+} Nob_Job_Ids;
+
+typedef enum {
+    NOB_JOB_PENDING = 0,
+    NOB_JOB_RUNNING,
+    NOB_JOB_DONE,
+    NOB_JOB_FAILED,
+} Nob_Job_State;
+
+typedef struct {
+    Nob_Cmd cmd;
+    Nob_Job_Ids deps;
+    Nob_Job_State state;
+    Nob_Proc proc;
+} Nob_Job;
+
+// A graph of commands. Every job is started as soon as all of its dependencies have finished
+// successfully and there is a free slot in the pool.
+typedef struct {
+    Nob_Job *items;
+    size_t count;
+    size_t capacity;
+} Nob_Jobs;
+
+// Add a copy of the command as a new job. Returns the id of the job.
+size_t nob_jobs_add(Nob_Jobs *jobs, Nob_Cmd cmd);
+
+// Make `job` wait for `dep` to finish successfully before starting
+void nob_jobs_depend(Nob_Jobs *jobs, size_t job, size_t dep);
+
+// Run all the jobs keeping at most max_procs processes in flight. After the first failure no new
+// jobs are started, the running ones are waited on and false is returned.
+bool nob_jobs_run(Nob_Jobs *jobs, size_t max_procs);
+
+// Free all the memory allocated by the jobs and their copies of the commands
+void nob_jobs_free(Nob_Jobs *jobs);
+
+// Tracing of the commands Nob runs. Once enabled, every command started by nob_cmd_run_async is
+// recorded and completed with its exit status and peak RSS when it is waited on.
+typedef struct {
+    char *name;          // argv[0] and the file the command works on, if it can be guessed
+    char *cmd;           // the full rendered command
+    Nob_Proc proc;
+    bool finished;
+    double start;        // seconds since nob_trace_enable
+    double end;
+    int exit_status;     // 128 + signal number for commands killed by a signal
+    long maxrss_kb;      // peak resident set size, 0 where it can't be measured
+} Nob_Trace_Event;
+
+typedef struct {
+    Nob_Trace_Event *items;
+    size_t count;
+    size_t capacity;
+    bool enabled;
+    double epoch;
+} Nob_Trace;
+
+// Every command recorded since nob_trace_enable
+extern Nob_Trace nob_trace;
+
+void nob_trace_enable(void);
+
+// Write the recorded commands as Chrome trace events (chrome://tracing, ui.perfetto.dev). Commands
+// running at the same time are spread over separate rows.
+bool nob_trace_write_json(const char *path);
+
 #ifndef NOB_TEMP_CAPACITY
 #define NOB_TEMP_CAPACITY (8*1024*1024)
 #endif // NOB_TEMP_CAPACITY
@@ -298,6 +386,8 @@ const char *nob_temp_sv_to_cstr(Nob_String_View sv);
 
 Nob_String_View nob_sv_chop_by_delim(Nob_String_View *sv, char delim);
 Nob_String_View nob_sv_trim(Nob_String_View sv);
+Nob_String_View nob_sv_trim_left(Nob_String_View sv);
+Nob_String_View nob_sv_trim_right(Nob_String_View sv);
 bool nob_sv_eq(Nob_String_View a, Nob_String_View b);
 Nob_String_View nob_sv_from_cstr(const char *cstr);
 Nob_String_View nob_sv_from_parts(const char *data, size_t count);
@@ -377,6 +467,143 @@ int closedir(DIR *dirp);
 static size_t nob_temp_size = 0;
 static char nob_temp[NOB_TEMP_CAPACITY] = {0};
 
+Nob_Trace nob_trace = {0};
+
+static double nob__trace_now(void)
+{
+#ifdef _WIN32
+    LARGE_INTEGER freq, counter;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart/(double)freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec*1e-9;
+#endif // _WIN32
+}
+
+static char *nob__strdup(const char *cstr)
+{
+    size_t n = strlen(cstr);
+    char *result = NOB_REALLOC(NULL, n + 1);
+    NOB_ASSERT(result != NULL && "Buy more RAM lol");
+    memcpy(result, cstr, n + 1);
+    return result;
+}
+
+static void nob__trace_proc_start(Nob_Cmd cmd, Nob_Proc proc)
+{
+    if (!nob_trace.enabled) return;
+
+    Nob_Trace_Event event = {0};
+    Nob_String_Builder sb = {0};
+
+    nob_sb_append_cstr(&sb, cmd.items[0]);
+    const char *file = NULL;
+    for (size_t i = 1; i + 1 < cmd.count; ++i) {
+        if (strcmp(cmd.items[i], "-c") == 0) {
+            file = cmd.items[i + 1];
+            break;
+        }
+        if (strcmp(cmd.items[i], "-o") == 0 && file == NULL) file = cmd.items[i + 1];
+    }
+    if (file) {
+        nob_sb_append_cstr(&sb, " ");
+        nob_sb_append_cstr(&sb, file);
+    }
+    nob_sb_append_null(&sb);
+    event.name = nob__strdup(sb.items);
+
+    sb.count = 0;
+    nob_cmd_render(cmd, &sb);
+    nob_sb_append_null(&sb);
+    event.cmd = nob__strdup(sb.items);
+    nob_sb_free(sb);
+
+    event.proc = proc;
+    event.start = nob__trace_now() - nob_trace.epoch;
+    nob_da_append(&nob_trace, event);
+}
+
+static void nob__trace_proc_end(Nob_Proc proc, int exit_status, long maxrss_kb)
+{
+    if (!nob_trace.enabled) return;
+
+    for (size_t i = nob_trace.count; i > 0; --i) {
+        Nob_Trace_Event *event = &nob_trace.items[i - 1];
+        if (event->finished || event->proc != proc) continue;
+        event->finished = true;
+        event->end = nob__trace_now() - nob_trace.epoch;
+        event->exit_status = exit_status;
+        event->maxrss_kb = maxrss_kb;
+        return;
+    }
+}
+
+void nob_trace_enable(void)
+{
+    nob_trace.enabled = true;
+    nob_trace.epoch = nob__trace_now();
+}
+
+static void nob__sb_append_json_string(Nob_String_Builder *sb, const char *cstr)
+{
+    nob_da_append(sb, '"');
+    for (; *cstr; ++cstr) {
+        switch (*cstr) {
+        case '"':  nob_sb_append_cstr(sb, "\\\""); break;
+        case '\\': nob_sb_append_cstr(sb, "\\\\"); break;
+        case '\n': nob_sb_append_cstr(sb, "\\n"); break;
+        case '\t': nob_sb_append_cstr(sb, "\\t"); break;
+        default:   nob_da_append(sb, *cstr);
+        }
+    }
+    nob_da_append(sb, '"');
+}
+
+bool nob_trace_write_json(const char *path)
+{
+    Nob_String_Builder sb = {0};
+    double *lanes = NOB_REALLOC(NULL, (nob_trace.count + 1)*sizeof(*lanes));
+    NOB_ASSERT(lanes != NULL && "Buy more RAM lol");
+    size_t lanes_count = 0;
+    double now = nob__trace_now() - nob_trace.epoch;
+    char buf[256];
+
+    nob_sb_append_cstr(&sb, "{\"traceEvents\":[\n");
+    for (size_t i = 0; i < nob_trace.count; ++i) {
+        const Nob_Trace_Event *event = &nob_trace.items[i];
+        double end = event->finished ? event->end : now;
+
+        // NOTE: the events are recorded in the order the commands started, so the first row that is
+        // free at the start of a command is the one it goes to
+        size_t lane = 0;
+        while (lane < lanes_count && lanes[lane] > event->start) lane += 1;
+        if (lane == lanes_count) lanes_count += 1;
+        lanes[lane] = end;
+
+        if (i > 0) nob_sb_append_cstr(&sb, ",\n");
+        nob_sb_append_cstr(&sb, "{\"name\":");
+        nob__sb_append_json_string(&sb, event->name);
+        snprintf(buf, sizeof(buf), ",\"cat\":\"cmd\",\"ph\":\"X\",\"pid\":1,\"tid\":%zu,\"ts\":%.0f,\"dur\":%.0f",
+                 lane + 1, event->start*1e6, (end - event->start)*1e6);
+        nob_sb_append_cstr(&sb, buf);
+        nob_sb_append_cstr(&sb, ",\"args\":{\"cmd\":");
+        nob__sb_append_json_string(&sb, event->cmd);
+        snprintf(buf, sizeof(buf), ",\"finished\":%s,\"exit_status\":%d,\"peak_rss_kb\":%ld}}",
+                 event->finished ? "true" : "false", event->exit_status, event->maxrss_kb);
+        nob_sb_append_cstr(&sb, buf);
+    }
+    nob_sb_append_cstr(&sb, "\n]}\n");
+
+    bool result = nob_write_entire_file(path, sb.items, sb.count);
+    if (result) nob_log(NOB_INFO, "wrote trace of %zu commands to %s", nob_trace.count, path);
+    NOB_FREE(lanes);
+    nob_sb_free(sb);
+    return result;
+}
+
 bool nob_mkdir_if_not_exists(const char *path)
 {
 #ifdef _WIN32
@@ -520,6 +747,7 @@ Nob_Proc nob_cmd_run_async(Nob_Cmd cmd)
 
     CloseHandle(piProcInfo.hThread);
 
+    nob__trace_proc_start(cmd, piProcInfo.hProcess);
     return piProcInfo.hProcess;
 #else
     pid_t cpid = fork();
@@ -542,6 +770,7 @@ Nob_Proc nob_cmd_run_async(Nob_Cmd cmd)
         NOB_ASSERT(0 && "unreachable");
     }
 
+    nob__trace_proc_start(cmd, cpid);
     return cpid;
 #endif
 }
@@ -575,6 +804,12 @@ bool nob_proc_wait(Nob_Proc proc)
         nob_log(NOB_ERROR, "could not get process exit code: %lu", GetLastError());
         return false;
     }
+    long maxrss_kb = 0;
+    PROCESS_MEMORY_COUNTERS counters = {0};
+    if (GetProcessMemoryInfo(proc, &counters, sizeof(counters))) {
+        maxrss_kb = (long)(counters.PeakWorkingSetSize/1024);
+    }
+    nob__trace_proc_end(proc, (int)exit_status, maxrss_kb);
 
     if (exit_status != 0) {
         nob_log(NOB_ERROR, "command exited with exit code %lu", exit_status);
@@ -587,13 +822,15 @@ bool nob_proc_wait(Nob_Proc proc)
 #else
     for (;;) {
         int wstatus = 0;
-        if (waitpid(proc, &wstatus, 0) < 0) {
+        struct rusage usage = {0};
+        if (wait4(proc, &wstatus, 0, &usage) < 0) {
             nob_log(NOB_ERROR, "could not wait on command (pid %d): %s", proc, strerror(errno));
             return false;
         }
 
         if (WIFEXITED(wstatus)) {
             int exit_status = WEXITSTATUS(wstatus);
+            nob__trace_proc_end(proc, exit_status, usage.ru_maxrss);
             if (exit_status != 0) {
                 nob_log(NOB_ERROR, "command exited with exit code %d", exit_status);
                 return false;
@@ -603,6 +840,7 @@ bool nob_proc_wait(Nob_Proc proc)
         }
 
         if (WIFSIGNALED(wstatus)) {
+            nob__trace_proc_end(proc, 128 + WTERMSIG(wstatus), usage.ru_maxrss);
             nob_log(NOB_ERROR, "command process was terminated by %s", strsignal(WTERMSIG(wstatus)));
             return false;
         }
@@ -619,6 +857,141 @@ bool nob_cmd_run_sync(Nob_Cmd cmd)
     return nob_proc_wait(p);
 }
 
+Nob_Proc nob_procs_wait_any(Nob_Procs *procs, bool *success)
+{
+    if (procs->count == 0) return NOB_INVALID_PROC;
+
+    size_t index = 0;
+#ifdef _WIN32
+    // NOTE: WaitForMultipleObjects can't wait on more than MAXIMUM_WAIT_OBJECTS handles at once
+    DWORD count = procs->count < MAXIMUM_WAIT_OBJECTS ? (DWORD)procs->count : MAXIMUM_WAIT_OBJECTS;
+    DWORD result = WaitForMultipleObjects(count, procs->items, FALSE, INFINITE);
+    if (result == WAIT_FAILED || result >= WAIT_OBJECT_0 + count) {
+        nob_log(NOB_ERROR, "could not wait on child processes: %lu", GetLastError());
+        return NOB_INVALID_PROC;
+    }
+    index = result - WAIT_OBJECT_0;
+#else
+    // Peek at whichever child finished first without reaping it, so nob_proc_wait can do the
+    // reaping and the exit status handling as usual.
+    siginfo_t info = {0};
+    if (waitid(P_ALL, 0, &info, WEXITED | WNOWAIT) < 0) {
+        nob_log(NOB_ERROR, "could not wait on child processes: %s", strerror(errno));
+        return NOB_INVALID_PROC;
+    }
+    // NOTE: if the finished child is not one of ours we just block on the first one of ours.
+    // Whoever spawned the other child is going to reap it.
+    for (index = 0; index < procs->count; ++index) {
+        if (procs->items[index] == info.si_pid) break;
+    }
+    if (index == procs->count) index = 0;
+#endif // _WIN32
+
+    Nob_Proc proc = procs->items[index];
+    *success = nob_proc_wait(proc);
+    procs->items[index] = procs->items[procs->count - 1];
+    procs->count -= 1;
+    return proc;
+}
+
+size_t nob_nprocs(void)
+{
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors;
+#else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (size_t)n : 1;
+#endif // _WIN32
+}
+
+size_t nob_jobs_add(Nob_Jobs *jobs, Nob_Cmd cmd)
+{
+    Nob_Job job = {0};
+    job.proc = NOB_INVALID_PROC;
+    nob_da_append_many(&job.cmd, cmd.items, cmd.count);
+    nob_da_append(jobs, job);
+    return jobs->count - 1;
+}
+
+void nob_jobs_depend(Nob_Jobs *jobs, size_t job, size_t dep)
+{
+    if (job == NOB_NO_JOB || dep == NOB_NO_JOB) return;
+    NOB_ASSERT(job < jobs->count && dep < jobs->count);
+    nob_da_append(&jobs->items[job].deps, dep);
+}
+
+bool nob_jobs_run(Nob_Jobs *jobs, size_t max_procs)
+{
+    bool result = true;
+    Nob_Procs running = {0};
+    if (max_procs == 0) max_procs = 1;
+
+    for (;;) {
+        /* start everything that is ready while there are free slots */
+        for (size_t i = 0; result && i < jobs->count && running.count < max_procs; ++i) {
+            Nob_Job *job = &jobs->items[i];
+            if (job->state != NOB_JOB_PENDING) continue;
+
+            bool ready = true;
+            for (size_t j = 0; j < job->deps.count; ++j) {
+                Nob_Job_State dep_state = jobs->items[job->deps.items[j]].state;
+                if (dep_state != NOB_JOB_DONE) ready = false;
+            }
+            if (!ready) continue;
+
+            job->proc = nob_cmd_run_async(job->cmd);
+            if (job->proc == NOB_INVALID_PROC) {
+                job->state = NOB_JOB_FAILED;
+                result = false;
+                continue;
+            }
+            job->state = NOB_JOB_RUNNING;
+            nob_da_append(&running, job->proc);
+        }
+
+        if (running.count == 0) break;
+
+        bool success = false;
+        Nob_Proc proc = nob_procs_wait_any(&running, &success);
+        if (proc == NOB_INVALID_PROC) {
+            // NOTE: we don't know which one of the running jobs is gone anymore, so just wait for
+            // all of them in order
+            nob_procs_wait(running);
+            running.count = 0;
+            nob_return_defer(false);
+        }
+        for (size_t i = 0; i < jobs->count; ++i) {
+            Nob_Job *job = &jobs->items[i];
+            if (job->state == NOB_JOB_RUNNING && job->proc == proc) {
+                job->state = success ? NOB_JOB_DONE : NOB_JOB_FAILED;
+                break;
+            }
+        }
+        if (!success) result = false;
+    }
+
+    /* whatever is still pending depends on a failed job */
+    for (size_t i = 0; i < jobs->count; ++i) {
+        if (jobs->items[i].state == NOB_JOB_PENDING) result = false;
+    }
+
+defer:
+    nob_da_free(running);
+    return result;
+}
+
+void nob_jobs_free(Nob_Jobs *jobs)
+{
+    for (size_t i = 0; i < jobs->count; ++i) {
+        nob_cmd_free(jobs->items[i].cmd);
+        nob_da_free(jobs->items[i].deps);
+    }
+    nob_da_free(*jobs);
+    memset(jobs, 0, sizeof(*jobs));
+}
+
 char *nob_shift_args(int *argc, char ***argv)
 {
     NOB_ASSERT(*argc > 0);
@@ -66,6 +66,8 @@
 #define SUPPORT_COMPRESSION_API         1
 // Support automatic generated events, loading and recording of those events when required
 #define SUPPORT_AUTOMATION_EVENTS       1
+// Support shader program binaries cache, enabled with SetShaderCacheDirectory() (requires GL_ARB_get_program_binary)
+#define SUPPORT_SHADER_CACHE            1
 // Support custom frame control, only for advance users
 // By default EndDrawing() does this job: draws everything + SwapScreenBuffer() + manage frame timing + PollInputEvents()
 // Enabling this flag allows manual control of the frame processes, use at your own risk
@@ -170,6 +172,8 @@
 // Support multiple image editing functions to scale, adjust colors, flip, draw on images, crop...
 // If not defined, still some functions are supported: ImageFormat(), ImageCrop(), ImageToPOT()
 #define SUPPORT_IMAGE_MANIPULATION      1
+// Support processing large images with worker threads: ImageDraw(), ImageColor*(), ImageResize(), ImageMipmaps(), GenImage*Noise(), GenImageCellular()
+#define SUPPORT_IMAGE_THREADS           1
 
 
 //------------------------------------------------------------------------------------
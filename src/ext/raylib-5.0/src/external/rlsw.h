@@ -0,0 +1,2000 @@
+/**********************************************************************************************
+*
+*   rlsw v1.0 - Software rasterizer implementing the OpenGL 1.1 subset used by rlgl
+*
+*   DESCRIPTION:
+*
+*     Renders into an in-memory RGBA8 color buffer and a float depth buffer, no GPU or
+*     windowing system required. Provides the fixed-function OpenGL 1.1 entry points rlgl
+*     calls on GRAPHICS_API_OPENGL_11 (immediate mode, vertex arrays, matrix stacks, textures,
+*     blending, depth test, scissor, culling), named sw*() and mapped to their gl*() names.
+*
+*     Vertices are transformed and clipped when they are submitted, triangles are set up and
+*     recorded into a command list together with a snapshot of the render state. The command
+*     list is rasterized on swFinish() (also called implicitly when pixels are read back or a
+*     texture is modified): the framebuffer is split in horizontal bands and a pool of worker
+*     threads rasterizes them in parallel, every band replaying the commands in order, so the
+*     result does not depend on the amount of threads.
+*
+*   LIMITATIONS:
+*     - Only the 2D texture target and the GL_MODULATE texture environment
+*     - Only the first mipmap level is stored, minification uses the base level
+*     - No lighting, fog, stencil, alpha test, points (GL_POINTS, GL_POINT polygon mode) or line stipple
+*     - Lines are rasterized as window aligned quads of glLineWidth() width
+*
+*   CONFIGURATION:
+*
+*   #define RLSW_IMPLEMENTATION
+*       Generates the implementation of the library into the included file.
+*
+*   #define RLSW_NO_THREADS
+*       Rasterize on the calling thread only, no pthreads dependency
+*
+*   #define RLSW_MAX_THREADS        16      // Maximum amount of rasterizer threads (caller included)
+*   #define RLSW_BAND_HEIGHT        16      // Height in pixels of the framebuffer bands threads work on
+*   #define RLSW_MAX_COMMANDS    16384      // Recorded commands that force a flush when reached
+*   #define RLSW_MAX_MATRIX_STACK   32      // Depth of every matrix stack
+*
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2026 Nob + Raylib template contributors, written for rlgl of raylib 5.0
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef RLSW_H
+#define RLSW_H
+
+#include <stdbool.h>
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef unsigned int GLenum;
+typedef unsigned char GLboolean;
+typedef unsigned int GLbitfield;
+typedef void GLvoid;
+typedef signed char GLbyte;
+typedef short GLshort;
+typedef int GLint;
+typedef unsigned char GLubyte;
+typedef unsigned short GLushort;
+typedef unsigned int GLuint;
+typedef int GLsizei;
+typedef float GLfloat;
+typedef float GLclampf;
+typedef double GLdouble;
+typedef double GLclampd;
+
+//----------------------------------------------------------------------------------
+// Defines and Macros (OpenGL 1.1 values)
+//----------------------------------------------------------------------------------
+#define GL_FALSE                        0
+#define GL_TRUE                         1
+#define GL_NO_ERROR                     0
+
+#define GL_POINTS                       0x0000
+#define GL_LINES                        0x0001
+#define GL_LINE_LOOP                    0x0002
+#define GL_LINE_STRIP                   0x0003
+#define GL_TRIANGLES                    0x0004
+#define GL_TRIANGLE_STRIP               0x0005
+#define GL_TRIANGLE_FAN                 0x0006
+#define GL_QUADS                        0x0007
+
+#define GL_NEVER                        0x0200
+#define GL_LESS                         0x0201
+#define GL_EQUAL                        0x0202
+#define GL_LEQUAL                       0x0203
+#define GL_GREATER                      0x0204
+#define GL_NOTEQUAL                     0x0205
+#define GL_GEQUAL                       0x0206
+#define GL_ALWAYS                       0x0207
+
+#define GL_ZERO                         0
+#define GL_ONE                          1
+#define GL_SRC_COLOR                    0x0300
+#define GL_ONE_MINUS_SRC_COLOR          0x0301
+#define GL_SRC_ALPHA                    0x0302
+#define GL_ONE_MINUS_SRC_ALPHA          0x0303
+#define GL_DST_ALPHA                    0x0304
+#define GL_ONE_MINUS_DST_ALPHA          0x0305
+#define GL_DST_COLOR                    0x0306
+#define GL_ONE_MINUS_DST_COLOR          0x0307
+#define GL_SRC_ALPHA_SATURATE           0x0308
+
+#define GL_FRONT                        0x0404
+#define GL_BACK                         0x0405
+#define GL_FRONT_AND_BACK               0x0408
+#define GL_CW                           0x0900
+#define GL_CCW                          0x0901
+
+#define GL_LINE_SMOOTH                  0x0B20
+#define GL_LINE_WIDTH                   0x0B21
+#define GL_CULL_FACE                    0x0B44
+#define GL_LIGHTING                     0x0B50
+#define GL_DEPTH_TEST                   0x0B71
+#define GL_NORMALIZE                    0x0BA1
+#define GL_ALPHA_TEST                   0x0BC0
+#define GL_DITHER                       0x0BD0
+#define GL_BLEND                        0x0BE2
+#define GL_SCISSOR_TEST                 0x0C11
+#define GL_TEXTURE_2D                   0x0DE1
+#define GL_PROGRAM_POINT_SIZE           0x8642
+
+#define GL_VIEWPORT                     0x0BA2
+#define GL_MODELVIEW_MATRIX             0x0BA6
+#define GL_PROJECTION_MATRIX            0x0BA7
+#define GL_TEXTURE_MATRIX               0x0BA8
+#define GL_MAX_TEXTURE_SIZE             0x0D33
+
+#define GL_PERSPECTIVE_CORRECTION_HINT  0x0C50
+#define GL_DONT_CARE                    0x1100
+#define GL_FASTEST                      0x1101
+#define GL_NICEST                       0x1102
+
+#define GL_UNPACK_ALIGNMENT             0x0CF5
+#define GL_PACK_ALIGNMENT               0x0D05
+
+#define GL_BYTE                         0x1400
+#define GL_UNSIGNED_BYTE                0x1401
+#define GL_SHORT                        0x1402
+#define GL_UNSIGNED_SHORT               0x1403
+#define GL_INT                          0x1404
+#define GL_UNSIGNED_INT                 0x1405
+#define GL_FLOAT                        0x1406
+#define GL_DOUBLE                       0x140A
+#define GL_UNSIGNED_SHORT_4_4_4_4       0x8033
+#define GL_UNSIGNED_SHORT_5_5_5_1       0x8034
+#define GL_UNSIGNED_SHORT_5_6_5         0x8363
+
+#define GL_ALPHA                        0x1906
+#define GL_RGB                          0x1907
+#define GL_RGBA                         0x1908
+#define GL_LUMINANCE                    0x1909
+#define GL_LUMINANCE_ALPHA              0x190A
+
+#define GL_MODELVIEW                    0x1700
+#define GL_PROJECTION                   0x1701
+#define GL_TEXTURE                      0x1702
+
+#define GL_POINT                        0x1B00
+#define GL_LINE                         0x1B01
+#define GL_FILL                         0x1B02
+#define GL_FLAT                         0x1D00
+#define GL_SMOOTH                       0x1D01
+
+#define GL_VENDOR                       0x1F00
+#define GL_RENDERER                     0x1F01
+#define GL_VERSION                      0x1F02
+#define GL_EXTENSIONS                   0x1F03
+
+#define GL_NEAREST                      0x2600
+#define GL_LINEAR                       0x2601
+#define GL_NEAREST_MIPMAP_NEAREST       0x2700
+#define GL_LINEAR_MIPMAP_NEAREST        0x2701
+#define GL_NEAREST_MIPMAP_LINEAR        0x2702
+#define GL_LINEAR_MIPMAP_LINEAR         0x2703
+#define GL_TEXTURE_MAG_FILTER           0x2800
+#define GL_TEXTURE_MIN_FILTER           0x2801
+#define GL_TEXTURE_WRAP_S               0x2802
+#define GL_TEXTURE_WRAP_T               0x2803
+#define GL_CLAMP                        0x2900
+#define GL_REPEAT                       0x2901
+#define GL_CLAMP_TO_EDGE                0x812F
+#define GL_MIRRORED_REPEAT              0x8370
+
+#define GL_VERTEX_ARRAY                 0x8074
+#define GL_NORMAL_ARRAY                 0x8075
+#define GL_COLOR_ARRAY                  0x8076
+#define GL_TEXTURE_COORD_ARRAY          0x8078
+
+#define GL_DEPTH_BUFFER_BIT             0x00000100
+#define GL_STENCIL_BUFFER_BIT           0x00000400
+#define GL_COLOR_BUFFER_BIT             0x00004000
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+#if defined(__cplusplus)
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+// Framebuffer management
+bool swInit(int width, int height);                 // Allocate the framebuffer and start the rasterizer threads
+void swClose(void);                                 // Free the framebuffer, textures and threads
+bool swResize(int width, int height);               // Reallocate the framebuffer, contents are lost
+void swFinish(void);                                // Rasterize every recorded command
+unsigned char *swGetColorBuffer(int *width, int *height);   // Get the RGBA8 color buffer (bottom-up rows), finishes first
+int swGetThreadCount(void);                         // Get the amount of threads rasterizing (caller included)
+
+// OpenGL 1.1 subset
+void swEnable(GLenum cap);
+void swDisable(GLenum cap);
+void swEnableClientState(GLenum array);
+void swDisableClientState(GLenum array);
+void swHint(GLenum target, GLenum mode);
+void swShadeModel(GLenum mode);
+void swGetFloatv(GLenum pname, GLfloat *params);
+void swGetIntegerv(GLenum pname, GLint *params);
+const GLubyte *swGetString(GLenum name);
+GLenum swGetError(void);
+void swPixelStorei(GLenum pname, GLint param);
+
+void swClear(GLbitfield mask);
+void swClearColor(GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha);
+void swClearDepth(GLclampd depth);
+void swViewport(GLint x, GLint y, GLsizei width, GLsizei height);
+void swScissor(GLint x, GLint y, GLsizei width, GLsizei height);
+void swBlendFunc(GLenum sfactor, GLenum dfactor);
+void swDepthFunc(GLenum func);
+void swDepthMask(GLboolean flag);
+void swCullFace(GLenum mode);
+void swFrontFace(GLenum mode);
+void swPolygonMode(GLenum face, GLenum mode);
+void swLineWidth(GLfloat width);
+void swFlush(void);
+
+void swMatrixMode(GLenum mode);
+void swLoadIdentity(void);
+void swLoadMatrixf(const GLfloat *m);
+void swMultMatrixf(const GLfloat *m);
+void swPushMatrix(void);
+void swPopMatrix(void);
+void swOrtho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar);
+void swFrustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar);
+void swTranslatef(GLfloat x, GLfloat y, GLfloat z);
+void swRotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z);
+void swScalef(GLfloat x, GLfloat y, GLfloat z);
+
+void swBegin(GLenum mode);
+void swEnd(void);
+void swVertex2i(GLint x, GLint y);
+void swVertex2f(GLfloat x, GLfloat y);
+void swVertex3f(GLfloat x, GLfloat y, GLfloat z);
+void swTexCoord2f(GLfloat s, GLfloat t);
+void swNormal3f(GLfloat nx, GLfloat ny, GLfloat nz);
+void swColor3f(GLfloat red, GLfloat green, GLfloat blue);
+void swColor4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
+void swColor4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha);
+
+void swVertexPointer(GLint size, GLenum type, GLsizei stride, const GLvoid *pointer);
+void swTexCoordPointer(GLint size, GLenum type, GLsizei stride, const GLvoid *pointer);
+void swNormalPointer(GLenum type, GLsizei stride, const GLvoid *pointer);
+void swColorPointer(GLint size, GLenum type, GLsizei stride, const GLvoid *pointer);
+void swDrawArrays(GLenum mode, GLint first, GLsizei count);
+void swDrawElements(GLenum mode, GLsizei count, GLenum type, const GLvoid *indices);
+
+void swGenTextures(GLsizei n, GLuint *textures);
+void swDeleteTextures(GLsizei n, const GLuint *textures);
+void swBindTexture(GLenum target, GLuint texture);
+void swTexParameteri(GLenum target, GLenum pname, GLint param);
+void swTexParameterf(GLenum target, GLenum pname, GLfloat param);
+void swTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const GLvoid *pixels);
+void swTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid *pixels);
+void swGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, GLvoid *pixels);
+void swReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLvoid *pixels);
+
+#if defined(__cplusplus)
+}
+#endif
+
+// OpenGL names, so rlgl code paths for OpenGL 1.1 compile unchanged
+#define glEnable                swEnable
+#define glDisable               swDisable
+#define glEnableClientState     swEnableClientState
+#define glDisableClientState    swDisableClientState
+#define glHint                  swHint
+#define glShadeModel            swShadeModel
+#define glGetFloatv             swGetFloatv
+#define glGetIntegerv           swGetIntegerv
+#define glGetString             swGetString
+#define glGetError              swGetError
+#define glPixelStorei           swPixelStorei
+#define glClear                 swClear
+#define glClearColor            swClearColor
+#define glClearDepth            swClearDepth
+#define glViewport              swViewport
+#define glScissor               swScissor
+#define glBlendFunc             swBlendFunc
+#define glDepthFunc             swDepthFunc
+#define glDepthMask             swDepthMask
+#define glCullFace              swCullFace
+#define glFrontFace             swFrontFace
+#define glPolygonMode           swPolygonMode
+#define glLineWidth             swLineWidth
+#define glFlush                 swFlush
+#define glFinish                swFinish
+#define glMatrixMode            swMatrixMode
+#define glLoadIdentity          swLoadIdentity
+#define glLoadMatrixf           swLoadMatrixf
+#define glMultMatrixf           swMultMatrixf
+#define glPushMatrix            swPushMatrix
+#define glPopMatrix             swPopMatrix
+#define glOrtho                 swOrtho
+#define glFrustum               swFrustum
+#define glTranslatef            swTranslatef
+#define glRotatef               swRotatef
+#define glScalef                swScalef
+#define glBegin                 swBegin
+#define glEnd                   swEnd
+#define glVertex2i              swVertex2i
+#define glVertex2f              swVertex2f
+#define glVertex3f              swVertex3f
+#define glTexCoord2f            swTexCoord2f
+#define glNormal3f              swNormal3f
+#define glColor3f               swColor3f
+#define glColor4f               swColor4f
+#define glColor4ub              swColor4ub
+#define glVertexPointer         swVertexPointer
+#define glTexCoordPointer       swTexCoordPointer
+#define glNormalPointer         swNormalPointer
+#define glColorPointer          swColorPointer
+#define glDrawArrays            swDrawArrays
+#define glDrawElements          swDrawElements
+#define glGenTextures           swGenTextures
+#define glDeleteTextures        swDeleteTextures
+#define glBindTexture           swBindTexture
+#define glTexParameteri         swTexParameteri
+#define glTexParameterf         swTexParameterf
+#define glTexImage2D            swTexImage2D
+#define glTexSubImage2D         swTexSubImage2D
+#define glGetTexImage           swGetTexImage
+#define glReadPixels            swReadPixels
+
+#endif // RLSW_H
+
+
+/***********************************************************************************
+*
+*   RLSW IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(RLSW_IMPLEMENTATION)
+
+#include <stdlib.h>     // Required for: malloc(), calloc(), realloc(), free()
+#include <string.h>     // Required for: memcpy(), memset(), memcmp()
+#include <math.h>       // Required for: floorf(), ceilf(), sqrtf(), sinf(), cosf()
+
+#if !defined(RLSW_NO_THREADS)
+    #include <pthread.h>    // Required for: pthread_create(), pthread_mutex_*(), pthread_cond_*()
+    #include <unistd.h>     // Required for: sysconf()
+#endif
+
+#ifndef RLSW_MAX_THREADS
+    #define RLSW_MAX_THREADS            16
+#endif
+#ifndef RLSW_BAND_HEIGHT
+    #define RLSW_BAND_HEIGHT            16
+#endif
+#ifndef RLSW_MAX_COMMANDS
+    #define RLSW_MAX_COMMANDS        16384
+#endif
+#ifndef RLSW_MAX_MATRIX_STACK
+    #define RLSW_MAX_MATRIX_STACK       32
+#endif
+
+#define SW_MAX_POLYGON_VERTICES        16   // A quad clipped by the six clip planes
+#define SW_GUARD_BAND                16.0f  // Clip space x and y bound in multiples of w, keeps window coordinates in int range
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct {
+    unsigned char *pixels;          // RGBA8, bottom-up rows as uploaded
+    int width;
+    int height;
+    GLenum minFilter;
+    GLenum magFilter;
+    GLenum wrapS;
+    GLenum wrapT;
+} sw_texture;
+
+// Vertex after the modelview-projection transform
+typedef struct {
+    float position[4];              // Clip space
+    float texcoord[2];
+    float color[4];
+} sw_vertex;
+
+// Vertex after the perspective division and the viewport transform
+typedef struct {
+    float x, y, z;                  // Window position and depth
+    float invw;                     // 1/w, for perspective correct interpolation
+    float attribs[6];               // u, v, r, g, b, a
+} sw_window_vertex;
+
+// Render state a command is rasterized with
+typedef struct {
+    const sw_texture *texture;      // NULL when texturing is disabled
+    GLenum filter;                  // Texture filter picked at setup (magnification or minification)
+    bool blend;
+    GLenum srcFactor;
+    GLenum dstFactor;
+    bool depthTest;
+    bool depthMask;
+    GLenum depthFunc;
+} sw_state;
+
+typedef enum {
+    SW_COMMAND_TRIANGLE = 0,
+    SW_COMMAND_CLEAR
+} sw_command_type;
+
+// Attribute planes, a(x, y) = value + dx*(x - origin.x) + dy*(y - origin.y)
+enum { SW_PLANE_Z = 0, SW_PLANE_W, SW_PLANE_U, SW_PLANE_V, SW_PLANE_R, SW_PLANE_G, SW_PLANE_B, SW_PLANE_A, SW_PLANE_COUNT };
+
+typedef struct {
+    sw_command_type type;
+    int state;                      // Index in the recorded states
+    int x0, y0, x1, y1;             // Pixel bounds (x1, y1 exclusive), clipped to viewport, scissor and framebuffer
+    float edges[3][3];              // Edge functions A*x + B*y + C, positive inside
+    bool inclusive[3];              // Whether pixels exactly on the edge belong to the triangle
+    float origin[2];
+    float planes[SW_PLANE_COUNT][3];
+    bool perspective;               // Attribute planes hold a/w, divide by the interpolated 1/w
+    GLbitfield clearMask;           // SW_COMMAND_CLEAR: buffers to clear, value in planes[...][0]
+} sw_command;
+
+typedef struct {
+    float stack[RLSW_MAX_MATRIX_STACK][16];
+    int depth;
+} sw_matrix_stack;
+
+typedef struct {
+    GLint size;
+    GLenum type;
+    GLsizei stride;
+    const unsigned char *pointer;
+    bool enabled;
+} sw_array;
+
+#if !defined(RLSW_NO_THREADS)
+typedef struct {
+    pthread_t threads[RLSW_MAX_THREADS];
+    int count;                      // Worker threads, the caller of swFinish() works too
+    pthread_mutex_t mutex;
+    pthread_cond_t wake;
+    pthread_cond_t done;
+    unsigned int generation;        // Incremented for every flush the workers join
+    int nextBand;
+    int busy;
+    bool quit;
+} sw_thread_pool;
+#endif
+
+typedef struct {
+    // Framebuffer
+    int width;
+    int height;
+    unsigned char *colorBuffer;
+    float *depthBuffer;
+
+    // Recorded commands
+    sw_command *commands;
+    int commandCount;
+    int commandCapacity;
+    sw_state *states;
+    int stateCount;
+    int stateCapacity;
+    bool stateDirty;
+
+    // Render state
+    sw_state current;
+    bool texture2D;
+    bool cull;
+    GLenum cullFace;
+    GLenum frontFace;
+    GLenum polygonMode;
+    float lineWidth;
+    bool scissorTest;
+    int scissor[4];
+    int viewport[4];
+    float clearColor[4];
+    float clearDepth;
+    int unpackAlignment;
+    int packAlignment;
+
+    // Transform
+    sw_matrix_stack matrices[3];    // Modelview, projection, texture
+    int matrixMode;
+    float mvp[16];
+    bool mvpDirty;
+
+    // Immediate mode
+    GLenum mode;
+    bool inBegin;
+    float texcoord[2];
+    float color[4];
+    sw_vertex primitive[4];
+    int primitiveCount;
+    int stripCount;
+
+    // Vertex arrays
+    sw_array vertexArray;
+    sw_array texcoordArray;
+    sw_array colorArray;
+
+    // Textures, ids index this array (id 0 is no texture)
+    sw_texture **textures;
+    int textureCount;
+    GLuint boundTexture;
+
+#if !defined(RLSW_NO_THREADS)
+    sw_thread_pool pool;
+#endif
+} sw_context;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static sw_context SW = { 0 };
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static void sw_matrix_identity(float *m);
+static void sw_matrix_multiply(float *result, const float *a, const float *b);
+static void sw_matrix_apply(const float *m);
+static void sw_emit_vertex(float x, float y, float z);
+static void sw_submit_polygon(const sw_vertex *vertices, int count);
+static void sw_submit_line(const sw_vertex *a, const sw_vertex *b);
+static void sw_rasterize_band(int band);
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition: Commands recording
+//----------------------------------------------------------------------------------
+static float sw_clamp(float value, float min, float max)
+{
+    return (value < min)? min : ((value > max)? max : value);
+}
+
+static sw_texture *sw_get_texture(GLuint id)
+{
+    if ((id == 0) || ((int)id >= SW.textureCount)) return NULL;
+    return SW.textures[id];
+}
+
+// Record a command with the current state, flushing first if the list is full
+static void sw_push_command(const sw_command *command)
+{
+    if (SW.commandCount >= RLSW_MAX_COMMANDS) swFinish();
+
+    if (SW.commandCount == SW.commandCapacity)
+    {
+        SW.commandCapacity = (SW.commandCapacity == 0)? 1024 : SW.commandCapacity*2;
+        SW.commands = (sw_command *)realloc(SW.commands, SW.commandCapacity*sizeof(sw_command));
+    }
+
+    // Only record a new state when it changed since the last command
+    if (SW.stateDirty || (SW.stateCount == 0))
+    {
+        if ((SW.stateCount == 0) || (memcmp(&SW.states[SW.stateCount - 1], &SW.current, sizeof(sw_state)) != 0))
+        {
+            if (SW.stateCount == SW.stateCapacity)
+            {
+                SW.stateCapacity = (SW.stateCapacity == 0)? 64 : SW.stateCapacity*2;
+                SW.states = (sw_state *)realloc(SW.states, SW.stateCapacity*sizeof(sw_state));
+            }
+            SW.states[SW.stateCount++] = SW.current;
+        }
+        SW.stateDirty = false;
+    }
+
+    SW.commands[SW.commandCount] = *command;
+    SW.commands[SW.commandCount].state = SW.stateCount - 1;
+    SW.commandCount++;
+}
+
+// Intersect a rectangle with the framebuffer and the scissor box, returns false if empty
+static bool sw_clip_rect(int *x0, int *y0, int *x1, int *y1)
+{
+    if (*x0 < 0) *x0 = 0;
+    if (*y0 < 0) *y0 = 0;
+    if (*x1 > SW.width) *x1 = SW.width;
+    if (*y1 > SW.height) *y1 = SW.height;
+
+    if (SW.scissorTest)
+    {
+        if (*x0 < SW.scissor[0]) *x0 = SW.scissor[0];
+        if (*y0 < SW.scissor[1]) *y0 = SW.scissor[1];
+        if (*x1 > SW.scissor[0] + SW.scissor[2]) *x1 = SW.scissor[0] + SW.scissor[2];
+        if (*y1 > SW.scissor[1] + SW.scissor[3]) *y1 = SW.scissor[1] + SW.scissor[3];
+    }
+
+    return (*x0 < *x1) && (*y0 < *y1);
+}
+
+// Set up a window space triangle and record it, culling is done by the caller
+static void sw_setup_triangle(const sw_window_vertex *v0, const sw_window_vertex *v1, const sw_window_vertex *v2)
+{
+    // Orient the triangle so the inside is positive for every edge function
+    float area = (v1->x - v0->x)*(v2->y - v0->y) - (v1->y - v0->y)*(v2->x - v0->x);
+    if (area == 0.0f) return;
+    if (area < 0.0f)
+    {
+        const sw_window_vertex *tmp = v1;
+        v1 = v2;
+        v2 = tmp;
+        area = -area;
+    }
+
+    sw_command command = { 0 };
+    command.type = SW_COMMAND_TRIANGLE;
+    // NOTE: Bounds are clamped to the framebuffer before the int conversion, wide lines can go past the guard band
+    command.x0 = (int)floorf(fmaxf(fminf(v0->x, fminf(v1->x, v2->x)), -1.0f));
+    command.y0 = (int)floorf(fmaxf(fminf(v0->y, fminf(v1->y, v2->y)), -1.0f));
+    command.x1 = (int)ceilf(fminf(fmaxf(v0->x, fmaxf(v1->x, v2->x)), (float)SW.width)) + 1;
+    command.y1 = (int)ceilf(fminf(fmaxf(v0->y, fmaxf(v1->y, v2->y)), (float)SW.height)) + 1;
+    if (!sw_clip_rect(&command.x0, &command.y0, &command.x1, &command.y1)) return;
+
+    // Edge i is opposite to vertex i, so its value is the (scaled) barycentric weight of that vertex
+    // NOTE: C is computed from the products of both endpoints, a shared edge seen from the neighbour
+    // triangle gets exactly the negated coefficients and every pixel lands in exactly one of both
+    const sw_window_vertex *vertices[3] = { v0, v1, v2 };
+    for (int i = 0; i < 3; i++)
+    {
+        const sw_window_vertex *a = vertices[(i + 1)%3];
+        const sw_window_vertex *b = vertices[(i + 2)%3];
+        command.edges[i][0] = a->y - b->y;
+        command.edges[i][1] = b->x - a->x;
+        command.edges[i][2] = a->x*b->y - b->x*a->y;
+        command.inclusive[i] = (command.edges[i][0] > 0.0f) || ((command.edges[i][0] == 0.0f) && (command.edges[i][1] > 0.0f));
+    }
+
+    command.origin[0] = v0->x;
+    command.origin[1] = v0->y;
+    command.perspective = (v0->invw != v1->invw) || (v0->invw != v2->invw);
+
+    float values[SW_PLANE_COUNT][3];
+    for (int i = 0; i < 3; i++)
+    {
+        const sw_window_vertex *v = vertices[i];
+        float w = command.perspective? v->invw : 1.0f;
+        values[SW_PLANE_Z][i] = v->z;
+        values[SW_PLANE_W][i] = w;
+        for (int j = 0; j < 6; j++) values[SW_PLANE_U + j][i] = v->attribs[j]*w;
+    }
+
+    for (int p = 0; p < SW_PLANE_COUNT; p++)
+    {
+        command.planes[p][0] = values[p][0];
+        command.planes[p][1] = (command.edges[0][0]*values[p][0] + command.edges[1][0]*values[p][1] + command.edges[2][0]*values[p][2])/area;
+        command.planes[p][2] = (command.edges[0][1]*values[p][0] + command.edges[1][1]*values[p][1] + command.edges[2][1]*values[p][2])/area;
+    }
+
+    // Pick the texture filter from the texel to pixel ratio of the triangle
+    if (SW.current.texture != NULL)
+    {
+        const sw_texture *texture = SW.current.texture;
+        float du = fabsf(command.planes[SW_PLANE_U][1]) + fabsf(command.planes[SW_PLANE_U][2]);
+        float dv = fabsf(command.planes[SW_PLANE_V][1]) + fabsf(command.planes[SW_PLANE_V][2]);
+        if (command.perspective)
+        {
+            du /= command.planes[SW_PLANE_W][0];
+            dv /= command.planes[SW_PLANE_W][0];
+        }
+
+        bool minify = (du*texture->width > 1.0f) || (dv*texture->height > 1.0f);
+        GLenum filter = minify? texture->minFilter : texture->magFilter;
+        filter = ((filter == GL_NEAREST) || (filter == GL_NEAREST_MIPMAP_NEAREST) || (filter == GL_NEAREST_MIPMAP_LINEAR))? GL_NEAREST : GL_LINEAR;
+        if (filter != SW.current.filter)
+        {
+            SW.current.filter = filter;
+            SW.stateDirty = true;
+        }
+    }
+
+    sw_push_command(&command);
+}
+
+// Convert a clip space vertex to window space
+static void sw_project_vertex(const sw_vertex *in, sw_window_vertex *out)
+{
+    float invw = 1.0f/in->position[3];
+    out->x = SW.viewport[0] + (in->position[0]*invw + 1.0f)*0.5f*SW.viewport[2];
+    out->y = SW.viewport[1] + (in->position[1]*invw + 1.0f)*0.5f*SW.viewport[3];
+    out->z = sw_clamp((in->position[2]*invw + 1.0f)*0.5f, 0.0f, 1.0f);
+    out->invw = invw;
+    out->attribs[0] = in->texcoord[0];
+    out->attribs[1] = in->texcoord[1];
+    for (int i = 0; i < 4; i++) out->attribs[2 + i] = in->color[i];
+}
+
+static void sw_lerp_vertex(const sw_vertex *a, const sw_vertex *b, float t, sw_vertex *out)
+{
+    for (int i = 0; i < 4; i++) out->position[i] = a->position[i] + (b->position[i] - a->position[i])*t;
+    for (int i = 0; i < 2; i++) out->texcoord[i] = a->texcoord[i] + (b->texcoord[i] - a->texcoord[i])*t;
+    for (int i = 0; i < 4; i++) out->color[i] = a->color[i] + (b->color[i] - a->color[i])*t;
+}
+
+// Distance of a clip space position to a clip plane, positive inside
+// NOTE: Planes 0 and 1 are near (z >= -w) and far (z <= w), the rest are a guard band around the viewport
+// (|x|, |y| <= SW_GUARD_BAND*w): only huge triangles get clipped, and window coordinates always fit an int
+static float sw_clip_distance(const float *position, int plane)
+{
+    float w = position[3];
+    switch (plane)
+    {
+        case 0: return w + position[2];
+        case 1: return w - position[2];
+        case 2: return SW_GUARD_BAND*w + position[0];
+        case 3: return SW_GUARD_BAND*w - position[0];
+        case 4: return SW_GUARD_BAND*w + position[1];
+        default: return SW_GUARD_BAND*w - position[1];
+    }
+}
+
+// Clip a polygon against the near, far and guard band planes, returns the new amount of vertices
+static int sw_clip_polygon(sw_vertex *vertices, int count)
+{
+    sw_vertex input[SW_MAX_POLYGON_VERTICES];
+
+    for (int plane = 0; plane < 6; plane++)
+    {
+        int inputCount = count;
+        memcpy(input, vertices, count*sizeof(sw_vertex));
+        count = 0;
+
+        for (int i = 0; i < inputCount; i++)
+        {
+            const sw_vertex *a = &input[i];
+            const sw_vertex *b = &input[(i + 1)%inputCount];
+            float da = sw_clip_distance(a->position, plane);
+            float db = sw_clip_distance(b->position, plane);
+
+            if (da >= 0.0f) vertices[count++] = *a;
+            if ((da >= 0.0f) != (db >= 0.0f)) sw_lerp_vertex(a, b, da/(da - db), &vertices[count++]);
+        }
+
+        if (count < 2) return 0;
+    }
+
+    return count;
+}
+
+static void sw_submit_polygon(const sw_vertex *polygon, int count)
+{
+    sw_vertex vertices[SW_MAX_POLYGON_VERTICES];
+    memcpy(vertices, polygon, count*sizeof(sw_vertex));
+    count = sw_clip_polygon(vertices, count);
+    if (count < 3) return;
+
+    if (SW.polygonMode == GL_POINT) return;   // Points are not supported
+    if (SW.polygonMode == GL_LINE)
+    {
+        for (int i = 0; i < count; i++) sw_submit_line(&vertices[i], &vertices[(i + 1)%count]);
+        return;
+    }
+
+    sw_window_vertex projected[SW_MAX_POLYGON_VERTICES];
+    for (int i = 0; i < count; i++) sw_project_vertex(&vertices[i], &projected[i]);
+
+    if (SW.cull)
+    {
+        // Signed area of the whole polygon, positive when counter-clockwise in window space
+        float area = 0.0f;
+        for (int i = 0; i < count; i++)
+        {
+            const sw_window_vertex *a = &projected[i];
+            const sw_window_vertex *b = &projected[(i + 1)%count];
+            area += a->x*b->y - b->x*a->y;
+        }
+
+        bool front = (SW.frontFace == GL_CCW)? (area > 0.0f) : (area < 0.0f);
+        if (SW.cullFace == GL_FRONT_AND_BACK) return;
+        if ((SW.cullFace == GL_BACK) && !front) return;
+        if ((SW.cullFace == GL_FRONT) && front) return;
+    }
+
+    for (int i = 1; i < count - 1; i++) sw_setup_triangle(&projected[0], &projected[i], &projected[i + 1]);
+}
+
+static void sw_submit_line(const sw_vertex *a, const sw_vertex *b)
+{
+    sw_vertex vertices[SW_MAX_POLYGON_VERTICES] = { *a, *b };
+    if (sw_clip_polygon(vertices, 2) < 2) return;
+
+    sw_window_vertex p[4];
+    sw_project_vertex(&vertices[0], &p[0]);
+    sw_project_vertex(&vertices[1], &p[1]);
+
+    float dx = p[1].x - p[0].x;
+    float dy = p[1].y - p[0].y;
+    float length = sqrtf(dx*dx + dy*dy);
+    if (length == 0.0f) return;
+
+    // Expand the segment into a quad of the line width, perpendicular to its direction
+    float nx = -dy/length*SW.lineWidth*0.5f;
+    float ny = dx/length*SW.lineWidth*0.5f;
+    p[2] = p[1];
+    p[3] = p[0];
+    p[0].x += nx; p[0].y += ny;
+    p[1].x += nx; p[1].y += ny;
+    p[2].x -= nx; p[2].y -= ny;
+    p[3].x -= nx; p[3].y -= ny;
+
+    sw_setup_triangle(&p[0], &p[1], &p[2]);
+    sw_setup_triangle(&p[0], &p[2], &p[3]);
+}
+
+// Transform a vertex with the current attributes and assemble primitives of the current mode
+static void sw_emit_vertex(float x, float y, float z)
+{
+    if (SW.mvpDirty)
+    {
+        sw_matrix_multiply(SW.mvp, SW.matrices[1].stack[SW.matrices[1].depth], SW.matrices[0].stack[SW.matrices[0].depth]);
+        SW.mvpDirty = false;
+    }
+
+    sw_vertex *vertex = &SW.primitive[SW.primitiveCount++];
+    const float *m = SW.mvp;
+    for (int i = 0; i < 4; i++) vertex->position[i] = m[i]*x + m[4 + i]*y + m[8 + i]*z + m[12 + i];
+    vertex->texcoord[0] = SW.texcoord[0];
+    vertex->texcoord[1] = SW.texcoord[1];
+    memcpy(vertex->color, SW.color, sizeof(SW.color));
+
+    switch (SW.mode)
+    {
+        case GL_TRIANGLES:
+        {
+            if (SW.primitiveCount == 3)
+            {
+                sw_submit_polygon(SW.primitive, 3);
+                SW.primitiveCount = 0;
+            }
+        } break;
+        case GL_QUADS:
+        {
+            if (SW.primitiveCount == 4)
+            {
+                sw_submit_polygon(SW.primitive, 4);
+                SW.primitiveCount = 0;
+            }
+        } break;
+        case GL_LINES:
+        {
+            if (SW.primitiveCount == 2)
+            {
+                sw_submit_line(&SW.primitive[0], &SW.primitive[1]);
+                SW.primitiveCount = 0;
+            }
+        } break;
+        case GL_LINE_STRIP:
+        {
+            if (SW.primitiveCount == 2)
+            {
+                sw_submit_line(&SW.primitive[0], &SW.primitive[1]);
+                SW.primitive[0] = SW.primitive[1];
+                SW.primitiveCount = 1;
+            }
+        } break;
+        case GL_TRIANGLE_STRIP:
+        case GL_TRIANGLE_FAN:
+        {
+            if (SW.primitiveCount == 3)
+            {
+                // Keep the winding of strip triangles consistent
+                if ((SW.mode == GL_TRIANGLE_STRIP) && (SW.stripCount%2 == 1))
+                {
+                    sw_vertex triangle[3] = { SW.primitive[1], SW.primitive[0], SW.primitive[2] };
+                    sw_submit_polygon(triangle, 3);
+                }
+                else sw_submit_polygon(SW.primitive, 3);
+
+                if (SW.mode == GL_TRIANGLE_STRIP) SW.primitive[0] = SW.primitive[1];
+                SW.primitive[1] = SW.primitive[2];
+                SW.primitiveCount = 2;
+                SW.stripCount++;
+            }
+        } break;
+        default: SW.primitiveCount = 0; break;   // GL_POINTS and GL_LINE_LOOP are not supported
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition: Rasterization
+//----------------------------------------------------------------------------------
+static int sw_wrap(int coord, int size, GLenum wrap)
+{
+    switch (wrap)
+    {
+        case GL_REPEAT:
+        {
+            coord %= size;
+            return (coord < 0)? coord + size : coord;
+        }
+        case GL_MIRRORED_REPEAT:
+        {
+            int period = 2*size;
+            coord %= period;
+            if (coord < 0) coord += period;
+            return (coord < size)? coord : period - 1 - coord;
+        }
+        default: return (coord < 0)? 0 : ((coord >= size)? size - 1 : coord);
+    }
+}
+
+static void sw_texel(const sw_texture *texture, int x, int y, float *color)
+{
+    const unsigned char *texel = texture->pixels + 4*(y*texture->width + x);
+    for (int i = 0; i < 4; i++) color[i] = texel[i]*(1.0f/255.0f);
+}
+
+static void sw_sample(const sw_texture *texture, GLenum filter, float u, float v, float *color)
+{
+    float fx = u*texture->width;
+    float fy = v*texture->height;
+
+    if (filter == GL_NEAREST)
+    {
+        int x = sw_wrap((int)floorf(fx), texture->width, texture->wrapS);
+        int y = sw_wrap((int)floorf(fy), texture->height, texture->wrapT);
+        sw_texel(texture, x, y, color);
+        return;
+    }
+
+    fx -= 0.5f;
+    fy -= 0.5f;
+    float bx = floorf(fx);
+    float by = floorf(fy);
+    float tx = fx - bx;
+    float ty = fy - by;
+    int x0 = sw_wrap((int)bx, texture->width, texture->wrapS);
+    int x1 = sw_wrap((int)bx + 1, texture->width, texture->wrapS);
+    int y0 = sw_wrap((int)by, texture->height, texture->wrapT);
+    int y1 = sw_wrap((int)by + 1, texture->height, texture->wrapT);
+
+    float c00[4], c10[4], c01[4], c11[4];
+    sw_texel(texture, x0, y0, c00);
+    sw_texel(texture, x1, y0, c10);
+    sw_texel(texture, x0, y1, c01);
+    sw_texel(texture, x1, y1, c11);
+    for (int i = 0; i < 4; i++)
+    {
+        float top = c00[i] + (c10[i] - c00[i])*tx;
+        float bottom = c01[i] + (c11[i] - c01[i])*tx;
+        color[i] = top + (bottom - top)*ty;
+    }
+}
+
+static bool sw_depth_pass(GLenum func, float z, float depth)
+{
+    switch (func)
+    {
+        case GL_NEVER: return false;
+        case GL_LESS: return z < depth;
+        case GL_EQUAL: return z == depth;
+        case GL_LEQUAL: return z <= depth;
+        case GL_GREATER: return z > depth;
+        case GL_NOTEQUAL: return z != depth;
+        case GL_GEQUAL: return z >= depth;
+        default: return true;
+    }
+}
+
+static void sw_blend_factor(GLenum factor, const float *src, const float *dst, float *result)
+{
+    switch (factor)
+    {
+        case GL_ZERO: result[0] = result[1] = result[2] = result[3] = 0.0f; break;
+        case GL_SRC_COLOR: for (int i = 0; i < 4; i++) result[i] = src[i]; break;
+        case GL_ONE_MINUS_SRC_COLOR: for (int i = 0; i < 4; i++) result[i] = 1.0f - src[i]; break;
+        case GL_SRC_ALPHA: result[0] = result[1] = result[2] = result[3] = src[3]; break;
+        case GL_ONE_MINUS_SRC_ALPHA: result[0] = result[1] = result[2] = result[3] = 1.0f - src[3]; break;
+        case GL_DST_ALPHA: result[0] = result[1] = result[2] = result[3] = dst[3]; break;
+        case GL_ONE_MINUS_DST_ALPHA: result[0] = result[1] = result[2] = result[3] = 1.0f - dst[3]; break;
+        case GL_DST_COLOR: for (int i = 0; i < 4; i++) result[i] = dst[i]; break;
+        case GL_ONE_MINUS_DST_COLOR: for (int i = 0; i < 4; i++) result[i] = 1.0f - dst[i]; break;
+        case GL_SRC_ALPHA_SATURATE:
+        {
+            float f = fminf(src[3], 1.0f - dst[3]);
+            result[0] = result[1] = result[2] = f;
+            result[3] = 1.0f;
+        } break;
+        default: result[0] = result[1] = result[2] = result[3] = 1.0f; break;   // GL_ONE
+    }
+}
+
+static void sw_clear_rows(const sw_command *command, int y0, int y1)
+{
+    unsigned char color[4] = { 0 };
+    for (int i = 0; i < 4; i++) color[i] = (unsigned char)(sw_clamp(command->planes[SW_PLANE_R + i][0], 0.0f, 1.0f)*255.0f + 0.5f);
+    float depth = command->planes[SW_PLANE_Z][0];
+
+    for (int y = y0; y < y1; y++)
+    {
+        if (command->clearMask & GL_COLOR_BUFFER_BIT)
+        {
+            unsigned char *pixel = SW.colorBuffer + 4*(y*SW.width + command->x0);
+            for (int x = command->x0; x < command->x1; x++, pixel += 4) memcpy(pixel, color, 4);
+        }
+        if (command->clearMask & GL_DEPTH_BUFFER_BIT)
+        {
+            float *z = SW.depthBuffer + y*SW.width;
+            for (int x = command->x0; x < command->x1; x++) z[x] = depth;
+        }
+    }
+}
+
+static void sw_rasterize_rows(const sw_command *command, int y0, int y1)
+{
+    const sw_state *state = &SW.states[command->state];
+    const float (*edges)[3] = command->edges;
+    const float (*planes)[3] = command->planes;
+
+    for (int y = y0; y < y1; y++)
+    {
+        float py = y + 0.5f;
+
+        // Conservative span of the row inside all three edges, pixels are still tested exactly
+        // NOTE: Kept in float until clamped to the bounds, nearly horizontal edges cross the row far away
+        float spanMin = (float)command->x0;
+        float spanMax = (float)command->x1;
+        float rows[3];
+        bool empty = false;
+        for (int i = 0; i < 3; i++)
+        {
+            float a = edges[i][0];
+            rows[i] = edges[i][1]*py + edges[i][2];
+            if (a > 0.0f) spanMin = fmaxf(spanMin, floorf(-rows[i]/a - 0.5f) - 1.0f);
+            else if (a < 0.0f) spanMax = fminf(spanMax, ceilf(-rows[i]/a - 0.5f) + 2.0f);
+            else if ((rows[i] < 0.0f) || ((rows[i] == 0.0f) && !command->inclusive[i])) empty = true;
+        }
+        if (empty || !(spanMin < spanMax)) continue;
+
+        int xmin = (int)spanMin;
+        int xmax = (int)spanMax;
+
+        float dx = xmin + 0.5f - command->origin[0];
+        float dy = py - command->origin[1];
+        float values[SW_PLANE_COUNT];
+        for (int p = 0; p < SW_PLANE_COUNT; p++) values[p] = planes[p][0] + planes[p][1]*dx + planes[p][2]*dy;
+
+        unsigned char *pixel = SW.colorBuffer + 4*(y*SW.width + xmin);
+        float *depth = SW.depthBuffer + y*SW.width + xmin;
+
+        for (int x = xmin; x < xmax; x++, pixel += 4, depth++)
+        {
+            float px = x + 0.5f;
+            bool inside = true;
+            for (int i = 0; i < 3; i++)
+            {
+                float e = edges[i][0]*px + rows[i];
+                if ((e < 0.0f) || ((e == 0.0f) && !command->inclusive[i])) inside = false;
+            }
+
+            if (inside && (!state->depthTest || sw_depth_pass(state->depthFunc, values[SW_PLANE_Z], *depth)))
+            {
+                if (state->depthTest && state->depthMask) *depth = values[SW_PLANE_Z];
+
+                float w = command->perspective? 1.0f/values[SW_PLANE_W] : 1.0f;
+                float src[4];
+                for (int i = 0; i < 4; i++) src[i] = sw_clamp(values[SW_PLANE_R + i]*w, 0.0f, 1.0f);
+
+                if (state->texture != NULL)
+                {
+                    float texel[4];
+                    sw_sample(state->texture, state->filter, values[SW_PLANE_U]*w, values[SW_PLANE_V]*w, texel);
+                    for (int i = 0; i < 4; i++) src[i] *= texel[i];
+                }
+
+                if (state->blend)
+                {
+                    float dst[4], sf[4], df[4];
+                    for (int i = 0; i < 4; i++) dst[i] = pixel[i]*(1.0f/255.0f);
+                    sw_blend_factor(state->srcFactor, src, dst, sf);
+                    sw_blend_factor(state->dstFactor, src, dst, df);
+                    for (int i = 0; i < 4; i++) src[i] = sw_clamp(src[i]*sf[i] + dst[i]*df[i], 0.0f, 1.0f);
+                }
+
+                for (int i = 0; i < 4; i++) pixel[i] = (unsigned char)(src[i]*255.0f + 0.5f);
+            }
+
+            for (int p = 0; p < SW_PLANE_COUNT; p++) values[p] += planes[p][1];
+        }
+    }
+}
+
+// Replay every recorded command on the rows of one band
+static void sw_rasterize_band(int band)
+{
+    int by0 = band*RLSW_BAND_HEIGHT;
+    int by1 = by0 + RLSW_BAND_HEIGHT;
+    if (by1 > SW.height) by1 = SW.height;
+
+    for (int i = 0; i < SW.commandCount; i++)
+    {
+        const sw_command *command = &SW.commands[i];
+        int y0 = (command->y0 > by0)? command->y0 : by0;
+        int y1 = (command->y1 < by1)? command->y1 : by1;
+        if (y0 >= y1) continue;
+
+        if (command->type == SW_COMMAND_CLEAR) sw_clear_rows(command, y0, y1);
+        else sw_rasterize_rows(command, y0, y1);
+    }
+}
+
+static int sw_band_count(void)
+{
+    return (SW.height + RLSW_BAND_HEIGHT - 1)/RLSW_BAND_HEIGHT;
+}
+
+#if !defined(RLSW_NO_THREADS)
+// Take bands until none is left
+static void sw_work(void)
+{
+    int bandCount = sw_band_count();
+    for (;;)
+    {
+        pthread_mutex_lock(&SW.pool.mutex);
+        int band = SW.pool.nextBand++;
+        pthread_mutex_unlock(&SW.pool.mutex);
+
+        if (band >= bandCount) break;
+        sw_rasterize_band(band);
+    }
+}
+
+static void *sw_worker(void *arg)
+{
+    (void)arg;
+    unsigned int generation = 0;
+
+    pthread_mutex_lock(&SW.pool.mutex);
+    for (;;)
+    {
+        while (!SW.pool.quit && (SW.pool.generation == generation)) pthread_cond_wait(&SW.pool.wake, &SW.pool.mutex);
+        if (SW.pool.quit) break;
+        generation = SW.pool.generation;
+        pthread_mutex_unlock(&SW.pool.mutex);
+
+        sw_work();
+
+        pthread_mutex_lock(&SW.pool.mutex);
+        if (--SW.pool.busy == 0) pthread_cond_signal(&SW.pool.done);
+    }
+    pthread_mutex_unlock(&SW.pool.mutex);
+
+    return NULL;
+}
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition: Matrices
+//----------------------------------------------------------------------------------
+static void sw_matrix_identity(float *m)
+{
+    memset(m, 0, 16*sizeof(float));
+    m[0] = m[5] = m[10] = m[15] = 1.0f;
+}
+
+// Column-major product, result = a*b (result may alias neither)
+static void sw_matrix_multiply(float *result, const float *a, const float *b)
+{
+    for (int col = 0; col < 4; col++)
+    {
+        for (int row = 0; row < 4; row++)
+        {
+            result[col*4 + row] = a[row]*b[col*4] + a[4 + row]*b[col*4 + 1] + a[8 + row]*b[col*4 + 2] + a[12 + row]*b[col*4 + 3];
+        }
+    }
+}
+
+// Multiply the current matrix by m
+static void sw_matrix_apply(const float *m)
+{
+    sw_matrix_stack *stack = &SW.matrices[SW.matrixMode];
+    float result[16];
+    sw_matrix_multiply(result, stack->stack[stack->depth], m);
+    memcpy(stack->stack[stack->depth], result, sizeof(result));
+    SW.mvpDirty = true;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition: Pixel formats
+//----------------------------------------------------------------------------------
+static int sw_pixel_size(GLenum format, GLenum type)
+{
+    if ((type == GL_UNSIGNED_SHORT_5_6_5) || (type == GL_UNSIGNED_SHORT_5_5_5_1) || (type == GL_UNSIGNED_SHORT_4_4_4_4)) return 2;
+
+    switch (format)
+    {
+        case GL_ALPHA:
+        case GL_LUMINANCE: return 1;
+        case GL_LUMINANCE_ALPHA: return 2;
+        case GL_RGB: return 3;
+        case GL_RGBA: return 4;
+        default: return 0;
+    }
+}
+
+static int sw_row_size(int width, GLenum format, GLenum type, int alignment)
+{
+    int size = width*sw_pixel_size(format, type);
+    return (size + alignment - 1)/alignment*alignment;
+}
+
+static void sw_unpack_pixel(GLenum format, GLenum type, const unsigned char *src, unsigned char *dst)
+{
+    unsigned short value = 0;
+    if (sw_pixel_size(format, type) == 2) memcpy(&value, src, 2);
+
+    switch (type)
+    {
+        case GL_UNSIGNED_SHORT_5_6_5:
+        {
+            dst[0] = (unsigned char)(((value >> 11) & 0x1f)*255/31);
+            dst[1] = (unsigned char)(((value >> 5) & 0x3f)*255/63);
+            dst[2] = (unsigned char)((value & 0x1f)*255/31);
+            dst[3] = 255;
+        } return;
+        case GL_UNSIGNED_SHORT_5_5_5_1:
+        {
+            dst[0] = (unsigned char)(((value >> 11) & 0x1f)*255/31);
+            dst[1] = (unsigned char)(((value >> 6) & 0x1f)*255/31);
+            dst[2] = (unsigned char)(((value >> 1) & 0x1f)*255/31);
+            dst[3] = (value & 0x1)? 255 : 0;
+        } return;
+        case GL_UNSIGNED_SHORT_4_4_4_4:
+        {
+            dst[0] = (unsigned char)(((value >> 12) & 0xf)*17);
+            dst[1] = (unsigned char)(((value >> 8) & 0xf)*17);
+            dst[2] = (unsigned char)(((value >> 4) & 0xf)*17);
+            dst[3] = (unsigned char)((value & 0xf)*17);
+        } return;
+        default: break;
+    }
+
+    switch (format)
+    {
+        case GL_ALPHA: dst[0] = dst[1] = dst[2] = 255; dst[3] = src[0]; break;
+        case GL_LUMINANCE: dst[0] = dst[1] = dst[2] = src[0]; dst[3] = 255; break;
+        case GL_LUMINANCE_ALPHA: dst[0] = dst[1] = dst[2] = src[0]; dst[3] = src[1]; break;
+        case GL_RGB: dst[0] = src[0]; dst[1] = src[1]; dst[2] = src[2]; dst[3] = 255; break;
+        default: memcpy(dst, src, 4); break;
+    }
+}
+
+static void sw_pack_pixel(GLenum format, GLenum type, const unsigned char *src, unsigned char *dst)
+{
+    unsigned short value = 0;
+
+    switch (type)
+    {
+        case GL_UNSIGNED_SHORT_5_6_5: value = (unsigned short)(((src[0]*31/255) << 11) | ((src[1]*63/255) << 5) | (src[2]*31/255)); break;
+        case GL_UNSIGNED_SHORT_5_5_5_1: value = (unsigned short)(((src[0]*31/255) << 11) | ((src[1]*31/255) << 6) | ((src[2]*31/255) << 1) | (src[3] >= 128)); break;
+        case GL_UNSIGNED_SHORT_4_4_4_4: value = (unsigned short)(((src[0]/17) << 12) | ((src[1]/17) << 8) | ((src[2]/17) << 4) | (src[3]/17)); break;
+        default:
+        {
+            switch (format)
+            {
+                case GL_ALPHA: dst[0] = src[3]; break;
+                case GL_LUMINANCE: dst[0] = src[0]; break;
+                case GL_LUMINANCE_ALPHA: dst[0] = src[0]; dst[1] = src[3]; break;
+                case GL_RGB: memcpy(dst, src, 3); break;
+                default: memcpy(dst, src, 4); break;
+            }
+        } return;
+    }
+
+    memcpy(dst, &value, 2);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Framebuffer management
+//----------------------------------------------------------------------------------
+bool swInit(int width, int height)
+{
+    memset(&SW, 0, sizeof(SW));
+
+    SW.current.srcFactor = GL_ONE;
+    SW.current.dstFactor = GL_ZERO;
+    SW.current.depthFunc = GL_LESS;
+    SW.current.depthMask = true;
+    SW.current.filter = GL_NEAREST;
+    SW.cullFace = GL_BACK;
+    SW.frontFace = GL_CCW;
+    SW.polygonMode = GL_FILL;
+    SW.lineWidth = 1.0f;
+    SW.clearDepth = 1.0f;
+    SW.unpackAlignment = 4;
+    SW.packAlignment = 4;
+    SW.color[0] = SW.color[1] = SW.color[2] = SW.color[3] = 1.0f;
+    for (int i = 0; i < 3; i++) sw_matrix_identity(SW.matrices[i].stack[0]);
+    SW.mvpDirty = true;
+
+    // Texture id 0 is reserved for no texture
+    SW.textureCount = 1;
+    SW.textures = (sw_texture **)calloc(1, sizeof(sw_texture *));
+
+    if (!swResize(width, height)) return false;
+
+#if !defined(RLSW_NO_THREADS)
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    int threads = (cpus < 1)? 1 : ((cpus > RLSW_MAX_THREADS)? RLSW_MAX_THREADS : (int)cpus);
+
+    pthread_mutex_init(&SW.pool.mutex, NULL);
+    pthread_cond_init(&SW.pool.wake, NULL);
+    pthread_cond_init(&SW.pool.done, NULL);
+    for (int i = 0; i < threads - 1; i++)
+    {
+        if (pthread_create(&SW.pool.threads[SW.pool.count], NULL, sw_worker, NULL) != 0) break;
+        SW.pool.count++;
+    }
+#endif
+
+    return true;
+}
+
+void swClose(void)
+{
+#if !defined(RLSW_NO_THREADS)
+    pthread_mutex_lock(&SW.pool.mutex);
+    SW.pool.quit = true;
+    pthread_cond_broadcast(&SW.pool.wake);
+    pthread_mutex_unlock(&SW.pool.mutex);
+    for (int i = 0; i < SW.pool.count; i++) pthread_join(SW.pool.threads[i], NULL);
+
+    pthread_mutex_destroy(&SW.pool.mutex);
+    pthread_cond_destroy(&SW.pool.wake);
+    pthread_cond_destroy(&SW.pool.done);
+#endif
+
+    for (int i = 0; i < SW.textureCount; i++)
+    {
+        if (SW.textures[i] != NULL) free(SW.textures[i]->pixels);
+        free(SW.textures[i]);
+    }
+    free(SW.textures);
+    free(SW.commands);
+    free(SW.states);
+    free(SW.colorBuffer);
+    free(SW.depthBuffer);
+
+    memset(&SW, 0, sizeof(SW));
+}
+
+bool swResize(int width, int height)
+{
+    if ((width <= 0) || (height <= 0)) return false;
+
+    swFinish();
+
+    unsigned char *color = (unsigned char *)calloc((size_t)width*height, 4);
+    float *depth = (float *)malloc((size_t)width*height*sizeof(float));
+    if ((color == NULL) || (depth == NULL))
+    {
+        free(color);
+        free(depth);
+        return false;
+    }
+    for (int i = 0; i < width*height; i++) depth[i] = 1.0f;
+
+    free(SW.colorBuffer);
+    free(SW.depthBuffer);
+    SW.colorBuffer = color;
+    SW.depthBuffer = depth;
+    SW.width = width;
+    SW.height = height;
+    SW.viewport[2] = SW.scissor[2] = width;
+    SW.viewport[3] = SW.scissor[3] = height;
+
+    return true;
+}
+
+void swFinish(void)
+{
+    if (SW.commandCount == 0) return;
+
+#if !defined(RLSW_NO_THREADS)
+    if (SW.pool.count > 0)
+    {
+        pthread_mutex_lock(&SW.pool.mutex);
+        SW.pool.nextBand = 0;
+        SW.pool.busy = SW.pool.count;
+        SW.pool.generation++;
+        pthread_cond_broadcast(&SW.pool.wake);
+        pthread_mutex_unlock(&SW.pool.mutex);
+
+        sw_work();
+
+        pthread_mutex_lock(&SW.pool.mutex);
+        while (SW.pool.busy > 0) pthread_cond_wait(&SW.pool.done, &SW.pool.mutex);
+        pthread_mutex_unlock(&SW.pool.mutex);
+    }
+    else
+#endif
+    {
+        for (int band = 0; band < sw_band_count(); band++) sw_rasterize_band(band);
+    }
+
+    SW.commandCount = 0;
+    SW.stateCount = 0;
+    SW.stateDirty = true;
+}
+
+unsigned char *swGetColorBuffer(int *width, int *height)
+{
+    swFinish();
+    if (width != NULL) *width = SW.width;
+    if (height != NULL) *height = SW.height;
+    return SW.colorBuffer;
+}
+
+int swGetThreadCount(void)
+{
+#if !defined(RLSW_NO_THREADS)
+    return SW.pool.count + 1;
+#else
+    return 1;
+#endif
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: OpenGL 1.1 state
+//----------------------------------------------------------------------------------
+static void sw_set_capability(GLenum cap, bool enabled)
+{
+    switch (cap)
+    {
+        case GL_BLEND: SW.current.blend = enabled; break;
+        case GL_DEPTH_TEST: SW.current.depthTest = enabled; break;
+        case GL_CULL_FACE: SW.cull = enabled; break;
+        case GL_SCISSOR_TEST: SW.scissorTest = enabled; break;
+        case GL_TEXTURE_2D:
+        {
+            SW.texture2D = enabled;
+            SW.current.texture = enabled? sw_get_texture(SW.boundTexture) : NULL;
+        } break;
+        default: break;
+    }
+    SW.stateDirty = true;
+}
+
+static sw_array *sw_get_array(GLenum array)
+{
+    switch (array)
+    {
+        case GL_VERTEX_ARRAY: return &SW.vertexArray;
+        case GL_TEXTURE_COORD_ARRAY: return &SW.texcoordArray;
+        case GL_COLOR_ARRAY: return &SW.colorArray;
+        default: return NULL;   // Normals are accepted and ignored, there is no lighting
+    }
+}
+
+void swEnable(GLenum cap) { sw_set_capability(cap, true); }
+void swDisable(GLenum cap) { sw_set_capability(cap, false); }
+
+void swEnableClientState(GLenum array)
+{
+    sw_array *state = sw_get_array(array);
+    if (state != NULL) state->enabled = true;
+}
+
+void swDisableClientState(GLenum array)
+{
+    sw_array *state = sw_get_array(array);
+    if (state != NULL) state->enabled = false;
+}
+
+void swHint(GLenum target, GLenum mode) { (void)target; (void)mode; }
+void swShadeModel(GLenum mode) { (void)mode; }
+GLenum swGetError(void) { return GL_NO_ERROR; }
+
+void swGetFloatv(GLenum pname, GLfloat *params)
+{
+    switch (pname)
+    {
+        case GL_MODELVIEW_MATRIX: memcpy(params, SW.matrices[0].stack[SW.matrices[0].depth], 16*sizeof(float)); break;
+        case GL_PROJECTION_MATRIX: memcpy(params, SW.matrices[1].stack[SW.matrices[1].depth], 16*sizeof(float)); break;
+        case GL_TEXTURE_MATRIX: memcpy(params, SW.matrices[2].stack[SW.matrices[2].depth], 16*sizeof(float)); break;
+        case GL_VIEWPORT: for (int i = 0; i < 4; i++) params[i] = (float)SW.viewport[i]; break;
+        case GL_LINE_WIDTH: params[0] = SW.lineWidth; break;
+        default: break;
+    }
+}
+
+void swGetIntegerv(GLenum pname, GLint *params)
+{
+    switch (pname)
+    {
+        case GL_VIEWPORT: memcpy(params, SW.viewport, 4*sizeof(int)); break;
+        case GL_MAX_TEXTURE_SIZE: params[0] = 16384; break;
+        default: break;
+    }
+}
+
+const GLubyte *swGetString(GLenum name)
+{
+    switch (name)
+    {
+        case GL_VENDOR: return (const GLubyte *)"raylib";
+        case GL_RENDERER: return (const GLubyte *)"rlsw software rasterizer";
+        case GL_VERSION: return (const GLubyte *)"1.1 rlsw 1.0";
+        default: return (const GLubyte *)"";
+    }
+}
+
+void swPixelStorei(GLenum pname, GLint param)
+{
+    if (pname == GL_UNPACK_ALIGNMENT) SW.unpackAlignment = param;
+    else if (pname == GL_PACK_ALIGNMENT) SW.packAlignment = param;
+}
+
+void swClear(GLbitfield mask)
+{
+    mask &= (GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    if (mask == 0) return;
+
+    int x0 = 0, y0 = 0, x1 = SW.width, y1 = SW.height;
+    if (!sw_clip_rect(&x0, &y0, &x1, &y1)) return;
+
+    // Clearing everything makes every previous command invisible
+    if ((mask == (GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT)) && (x0 == 0) && (y0 == 0) && (x1 == SW.width) && (y1 == SW.height))
+    {
+        SW.commandCount = 0;
+        SW.stateCount = 0;
+        SW.stateDirty = true;
+    }
+
+    sw_command command = { 0 };
+    command.type = SW_COMMAND_CLEAR;
+    command.clearMask = mask;
+    command.x0 = x0;
+    command.y0 = y0;
+    command.x1 = x1;
+    command.y1 = y1;
+    command.planes[SW_PLANE_Z][0] = SW.clearDepth;
+    for (int i = 0; i < 4; i++) command.planes[SW_PLANE_R + i][0] = SW.clearColor[i];
+    sw_push_command(&command);
+}
+
+void swClearColor(GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha)
+{
+    SW.clearColor[0] = red;
+    SW.clearColor[1] = green;
+    SW.clearColor[2] = blue;
+    SW.clearColor[3] = alpha;
+}
+
+void swClearDepth(GLclampd depth) { SW.clearDepth = sw_clamp((float)depth, 0.0f, 1.0f); }
+
+void swViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    SW.viewport[0] = x;
+    SW.viewport[1] = y;
+    SW.viewport[2] = width;
+    SW.viewport[3] = height;
+}
+
+void swScissor(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    SW.scissor[0] = x;
+    SW.scissor[1] = y;
+    SW.scissor[2] = width;
+    SW.scissor[3] = height;
+}
+
+void swBlendFunc(GLenum sfactor, GLenum dfactor)
+{
+    SW.current.srcFactor = sfactor;
+    SW.current.dstFactor = dfactor;
+    SW.stateDirty = true;
+}
+
+void swDepthFunc(GLenum func)
+{
+    SW.current.depthFunc = func;
+    SW.stateDirty = true;
+}
+
+void swDepthMask(GLboolean flag)
+{
+    SW.current.depthMask = (flag != GL_FALSE);
+    SW.stateDirty = true;
+}
+
+void swCullFace(GLenum mode) { SW.cullFace = mode; }
+void swFrontFace(GLenum mode) { SW.frontFace = mode; }
+void swPolygonMode(GLenum face, GLenum mode) { (void)face; SW.polygonMode = mode; }
+void swLineWidth(GLfloat width) { SW.lineWidth = (width > 0.0f)? width : 1.0f; }
+void swFlush(void) { swFinish(); }
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: OpenGL 1.1 matrices
+//----------------------------------------------------------------------------------
+void swMatrixMode(GLenum mode)
+{
+    switch (mode)
+    {
+        case GL_PROJECTION: SW.matrixMode = 1; break;
+        case GL_TEXTURE: SW.matrixMode = 2; break;
+        default: SW.matrixMode = 0; break;
+    }
+}
+
+void swLoadIdentity(void)
+{
+    sw_matrix_stack *stack = &SW.matrices[SW.matrixMode];
+    sw_matrix_identity(stack->stack[stack->depth]);
+    SW.mvpDirty = true;
+}
+
+void swLoadMatrixf(const GLfloat *m)
+{
+    sw_matrix_stack *stack = &SW.matrices[SW.matrixMode];
+    memcpy(stack->stack[stack->depth], m, 16*sizeof(float));
+    SW.mvpDirty = true;
+}
+
+void swMultMatrixf(const GLfloat *m) { sw_matrix_apply(m); }
+
+void swPushMatrix(void)
+{
+    sw_matrix_stack *stack = &SW.matrices[SW.matrixMode];
+    if (stack->depth < RLSW_MAX_MATRIX_STACK - 1)
+    {
+        memcpy(stack->stack[stack->depth + 1], stack->stack[stack->depth], 16*sizeof(float));
+        stack->depth++;
+    }
+}
+
+void swPopMatrix(void)
+{
+    sw_matrix_stack *stack = &SW.matrices[SW.matrixMode];
+    if (stack->depth > 0)
+    {
+        stack->depth--;
+        SW.mvpDirty = true;
+    }
+}
+
+void swOrtho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar)
+{
+    float m[16] = { 0 };
+    m[0] = (float)(2.0/(right - left));
+    m[5] = (float)(2.0/(top - bottom));
+    m[10] = (float)(-2.0/(zFar - zNear));
+    m[12] = (float)(-(right + left)/(right - left));
+    m[13] = (float)(-(top + bottom)/(top - bottom));
+    m[14] = (float)(-(zFar + zNear)/(zFar - zNear));
+    m[15] = 1.0f;
+    sw_matrix_apply(m);
+}
+
+void swFrustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar)
+{
+    float m[16] = { 0 };
+    m[0] = (float)(2.0*zNear/(right - left));
+    m[5] = (float)(2.0*zNear/(top - bottom));
+    m[8] = (float)((right + left)/(right - left));
+    m[9] = (float)((top + bottom)/(top - bottom));
+    m[10] = (float)(-(zFar + zNear)/(zFar - zNear));
+    m[11] = -1.0f;
+    m[14] = (float)(-2.0*zFar*zNear/(zFar - zNear));
+    sw_matrix_apply(m);
+}
+
+void swTranslatef(GLfloat x, GLfloat y, GLfloat z)
+{
+    float m[16];
+    sw_matrix_identity(m);
+    m[12] = x;
+    m[13] = y;
+    m[14] = z;
+    sw_matrix_apply(m);
+}
+
+void swRotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z)
+{
+    float length = sqrtf(x*x + y*y + z*z);
+    if (length == 0.0f) return;
+    x /= length;
+    y /= length;
+    z /= length;
+
+    float radians = angle*3.14159265358979323846f/180.0f;
+    float s = sinf(radians);
+    float c = cosf(radians);
+    float t = 1.0f - c;
+
+    float m[16] = { 0 };
+    m[0] = x*x*t + c;   m[4] = x*y*t - z*s; m[8] = x*z*t + y*s;
+    m[1] = y*x*t + z*s; m[5] = y*y*t + c;   m[9] = y*z*t - x*s;
+    m[2] = z*x*t - y*s; m[6] = z*y*t + x*s; m[10] = z*z*t + c;
+    m[15] = 1.0f;
+    sw_matrix_apply(m);
+}
+
+void swScalef(GLfloat x, GLfloat y, GLfloat z)
+{
+    float m[16] = { 0 };
+    m[0] = x;
+    m[5] = y;
+    m[10] = z;
+    m[15] = 1.0f;
+    sw_matrix_apply(m);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: OpenGL 1.1 vertex submission
+//----------------------------------------------------------------------------------
+void swBegin(GLenum mode)
+{
+    SW.mode = mode;
+    SW.inBegin = true;
+    SW.primitiveCount = 0;
+    SW.stripCount = 0;
+}
+
+void swEnd(void)
+{
+    SW.inBegin = false;
+    SW.primitiveCount = 0;
+}
+
+void swVertex2i(GLint x, GLint y) { sw_emit_vertex((float)x, (float)y, 0.0f); }
+void swVertex2f(GLfloat x, GLfloat y) { sw_emit_vertex(x, y, 0.0f); }
+void swVertex3f(GLfloat x, GLfloat y, GLfloat z) { sw_emit_vertex(x, y, z); }
+
+void swTexCoord2f(GLfloat s, GLfloat t)
+{
+    SW.texcoord[0] = s;
+    SW.texcoord[1] = t;
+}
+
+void swNormal3f(GLfloat nx, GLfloat ny, GLfloat nz) { (void)nx; (void)ny; (void)nz; }
+
+void swColor3f(GLfloat red, GLfloat green, GLfloat blue) { swColor4f(red, green, blue, 1.0f); }
+
+void swColor4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    SW.color[0] = red;
+    SW.color[1] = green;
+    SW.color[2] = blue;
+    SW.color[3] = alpha;
+}
+
+void swColor4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha)
+{
+    swColor4f(red/255.0f, green/255.0f, blue/255.0f, alpha/255.0f);
+}
+
+static void sw_set_array(sw_array *array, GLint size, GLenum type, GLsizei stride, const GLvoid *pointer)
+{
+    array->size = size;
+    array->type = type;
+    array->stride = stride;
+    array->pointer = (const unsigned char *)pointer;
+}
+
+void swVertexPointer(GLint size, GLenum type, GLsizei stride, const GLvoid *pointer) { sw_set_array(&SW.vertexArray, size, type, stride, pointer); }
+void swTexCoordPointer(GLint size, GLenum type, GLsizei stride, const GLvoid *pointer) { sw_set_array(&SW.texcoordArray, size, type, stride, pointer); }
+void swColorPointer(GLint size, GLenum type, GLsizei stride, const GLvoid *pointer) { sw_set_array(&SW.colorArray, size, type, stride, pointer); }
+void swNormalPointer(GLenum type, GLsizei stride, const GLvoid *pointer) { (void)type; (void)stride; (void)pointer; }
+
+// Read element index of an array as floats, normalizing unsigned bytes (colors)
+static void sw_fetch(const sw_array *array, int index, float *out)
+{
+    int componentSize = (array->type == GL_UNSIGNED_BYTE)? 1 : ((array->type == GL_DOUBLE)? 8 : 4);
+    int stride = (array->stride != 0)? array->stride : array->size*componentSize;
+    const unsigned char *element = array->pointer + (size_t)index*stride;
+
+    for (int i = 0; i < array->size; i++)
+    {
+        switch (array->type)
+        {
+            case GL_UNSIGNED_BYTE: out[i] = element[i]/255.0f; break;
+            case GL_DOUBLE: { double value; memcpy(&value, element + i*8, 8); out[i] = (float)value; } break;
+            case GL_INT: { int value; memcpy(&value, element + i*4, 4); out[i] = (float)value; } break;
+            default: memcpy(&out[i], element + i*4, 4); break;
+        }
+    }
+}
+
+static void sw_array_element(int index)
+{
+    if (SW.texcoordArray.enabled && (SW.texcoordArray.pointer != NULL)) sw_fetch(&SW.texcoordArray, index, SW.texcoord);
+    if (SW.colorArray.enabled && (SW.colorArray.pointer != NULL))
+    {
+        float color[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+        sw_fetch(&SW.colorArray, index, color);
+        memcpy(SW.color, color, sizeof(color));
+    }
+
+    float position[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+    sw_fetch(&SW.vertexArray, index, position);
+    sw_emit_vertex(position[0], position[1], position[2]);
+}
+
+void swDrawArrays(GLenum mode, GLint first, GLsizei count)
+{
+    if (!SW.vertexArray.enabled || (SW.vertexArray.pointer == NULL)) return;
+
+    swBegin(mode);
+    for (int i = 0; i < count; i++) sw_array_element(first + i);
+    swEnd();
+}
+
+void swDrawElements(GLenum mode, GLsizei count, GLenum type, const GLvoid *indices)
+{
+    if (!SW.vertexArray.enabled || (SW.vertexArray.pointer == NULL)) return;
+
+    swBegin(mode);
+    for (int i = 0; i < count; i++)
+    {
+        int index = 0;
+        switch (type)
+        {
+            case GL_UNSIGNED_BYTE: index = ((const unsigned char *)indices)[i]; break;
+            case GL_UNSIGNED_SHORT: index = ((const unsigned short *)indices)[i]; break;
+            default: index = (int)((const unsigned int *)indices)[i]; break;
+        }
+        sw_array_element(index);
+    }
+    swEnd();
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: OpenGL 1.1 textures
+//----------------------------------------------------------------------------------
+// NOTE: Recorded commands reference texture objects, so every texture change finishes them first
+
+void swGenTextures(GLsizei n, GLuint *textures)
+{
+    for (int i = 0; i < n; i++)
+    {
+        GLuint id = 0;
+        for (int j = 1; j < SW.textureCount; j++)
+        {
+            if (SW.textures[j] == NULL) { id = j; break; }
+        }
+        if (id == 0)
+        {
+            id = SW.textureCount++;
+            SW.textures = (sw_texture **)realloc(SW.textures, SW.textureCount*sizeof(sw_texture *));
+        }
+
+        SW.textures[id] = (sw_texture *)calloc(1, sizeof(sw_texture));
+        SW.textures[id]->minFilter = GL_NEAREST_MIPMAP_LINEAR;
+        SW.textures[id]->magFilter = GL_LINEAR;
+        SW.textures[id]->wrapS = GL_REPEAT;
+        SW.textures[id]->wrapT = GL_REPEAT;
+        textures[i] = id;
+    }
+}
+
+void swDeleteTextures(GLsizei n, const GLuint *textures)
+{
+    swFinish();
+
+    for (int i = 0; i < n; i++)
+    {
+        sw_texture *texture = sw_get_texture(textures[i]);
+        if (texture == NULL) continue;
+
+        free(texture->pixels);
+        free(texture);
+        SW.textures[textures[i]] = NULL;
+        if (SW.boundTexture == textures[i]) swBindTexture(GL_TEXTURE_2D, 0);
+    }
+}
+
+void swBindTexture(GLenum target, GLuint texture)
+{
+    (void)target;
+    SW.boundTexture = texture;
+    SW.current.texture = SW.texture2D? sw_get_texture(texture) : NULL;
+    SW.stateDirty = true;
+}
+
+void swTexParameteri(GLenum target, GLenum pname, GLint param)
+{
+    (void)target;
+    sw_texture *texture = sw_get_texture(SW.boundTexture);
+    if (texture == NULL) return;
+
+    swFinish();
+    switch (pname)
+    {
+        case GL_TEXTURE_MIN_FILTER: texture->minFilter = param; break;
+        case GL_TEXTURE_MAG_FILTER: texture->magFilter = param; break;
+        case GL_TEXTURE_WRAP_S: texture->wrapS = param; break;
+        case GL_TEXTURE_WRAP_T: texture->wrapT = param; break;
+        default: break;
+    }
+}
+
+void swTexParameterf(GLenum target, GLenum pname, GLfloat param) { swTexParameteri(target, pname, (GLint)param); }
+
+void swTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const GLvoid *pixels)
+{
+    (void)target; (void)internalformat; (void)border;
+    sw_texture *texture = sw_get_texture(SW.boundTexture);
+    if ((texture == NULL) || (level != 0) || (width <= 0) || (height <= 0) || (sw_pixel_size(format, type) == 0)) return;
+
+    swFinish();
+    free(texture->pixels);
+    texture->pixels = (unsigned char *)calloc((size_t)width*height, 4);
+    texture->width = width;
+    texture->height = height;
+
+    if (pixels != NULL) swTexSubImage2D(target, 0, 0, 0, width, height, format, type, pixels);
+}
+
+void swTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid *pixels)
+{
+    (void)target;
+    sw_texture *texture = sw_get_texture(SW.boundTexture);
+    if ((texture == NULL) || (texture->pixels == NULL) || (level != 0) || (pixels == NULL)) return;
+    if ((xoffset < 0) || (yoffset < 0) || (xoffset + width > texture->width) || (yoffset + height > texture->height)) return;
+
+    swFinish();
+    int pixelSize = sw_pixel_size(format, type);
+    int rowSize = sw_row_size(width, format, type, SW.unpackAlignment);
+    for (int y = 0; y < height; y++)
+    {
+        const unsigned char *src = (const unsigned char *)pixels + (size_t)y*rowSize;
+        unsigned char *dst = texture->pixels + 4*((size_t)(yoffset + y)*texture->width + xoffset);
+        if ((format == GL_RGBA) && (type == GL_UNSIGNED_BYTE)) memcpy(dst, src, 4*width);
+        else for (int x = 0; x < width; x++) sw_unpack_pixel(format, type, src + x*pixelSize, dst + 4*x);
+    }
+}
+
+void swGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, GLvoid *pixels)
+{
+    (void)target;
+    const sw_texture *texture = sw_get_texture(SW.boundTexture);
+    if ((texture == NULL) || (texture->pixels == NULL) || (level != 0) || (sw_pixel_size(format, type) == 0)) return;
+
+    swFinish();
+    int pixelSize = sw_pixel_size(format, type);
+    int rowSize = sw_row_size(texture->width, format, type, SW.packAlignment);
+    for (int y = 0; y < texture->height; y++)
+    {
+        const unsigned char *src = texture->pixels + 4*(size_t)y*texture->width;
+        unsigned char *dst = (unsigned char *)pixels + (size_t)y*rowSize;
+        for (int x = 0; x < texture->width; x++) sw_pack_pixel(format, type, src + 4*x, dst + x*pixelSize);
+    }
+}
+
+void swReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLvoid *pixels)
+{
+    swFinish();
+
+    int pixelSize = sw_pixel_size(format, type);
+    if (pixelSize == 0) return;
+    int rowSize = sw_row_size(width, format, type, SW.packAlignment);
+
+    for (int row = 0; row < height; row++)
+    {
+        unsigned char *dst = (unsigned char *)pixels + (size_t)row*rowSize;
+        int sy = y + row;
+        for (int col = 0; col < width; col++)
+        {
+            int sx = x + col;
+            static const unsigned char outside[4] = { 0 };
+            const unsigned char *src = ((sx >= 0) && (sx < SW.width) && (sy >= 0) && (sy < SW.height))? SW.colorBuffer + 4*((size_t)sy*SW.width + sx) : outside;
+            sw_pack_pixel(format, type, src, dst + col*pixelSize);
+        }
+    }
+}
+
+#endif // RLSW_IMPLEMENTATION
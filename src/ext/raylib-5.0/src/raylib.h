@@ -257,6 +257,14 @@ typedef struct Image {
     int format;             // Data format (PixelFormat type)
 } Image;
 
+// ImageColorOp, image color operation applied by ImageColorOps()
+typedef struct ImageColorOp {
+    int type;               // Operation type (ImageColorOpType)
+    float value;            // Operation value: contrast (-100 to 100), brightness (-255 to 255)
+    Color color;            // Operation color: tint color, color to replace
+    Color replace;          // Replacement color
+} ImageColorOp;
+
 // Texture, tex data stored in GPU memory (VRAM)
 typedef struct Texture {
     unsigned int id;        // OpenGL texture id
@@ -292,6 +300,15 @@ typedef struct NPatchInfo {
     int layout;             // Layout of the n-patch: 3x3, 1x3 or 3x1
 } NPatchInfo;
 
+// SpriteInstance, packed sprite data for instanced drawing (32 bytes)
+typedef struct SpriteInstance {
+    Vector2 position;       // Sprite center position
+    float rotation;         // Sprite rotation in degrees
+    Vector2 scale;          // Sprite scale, applied to source rectangle size
+    unsigned short source[4]; // Source rectangle in texture in pixels: x, y, width, height
+    Color color;            // Sprite tint color
+} SpriteInstance;
+
 // GlyphInfo, font characters glyphs info
 typedef struct GlyphInfo {
     int value;              // Character value (Unicode)
@@ -361,6 +378,14 @@ typedef struct Shader {
     int *locs;              // Shader locations array (RL_MAX_SHADER_LOCATIONS)
 } Shader;
 
+// ShaderCacheStats, shader program binaries cache statistics
+typedef struct ShaderCacheStats {
+    int hits;               // Programs loaded from cached binaries
+    int misses;             // Programs compiled from code (binary missing, stale or rejected by driver)
+    int stored;             // Program binaries stored into cache
+    float timeSaved;        // Compile time saved by cache hits, in milliseconds (compile time stored minus load time)
+} ShaderCacheStats;
+
 // MaterialMap
 typedef struct MaterialMap {
     Texture2D texture;      // Material map texture
@@ -413,6 +438,22 @@ typedef struct ModelAnimation {
     char name[32];          // Animation name
 } ModelAnimation;
 
+// StaticBatchRange, elements of a mesh merged into a static batch
+typedef struct StaticBatchRange {
+    int mesh;               // Merged mesh index
+    int offset;             // First index in merged mesh
+    int count;              // Number of indices (0 if mesh was skipped)
+} StaticBatchRange;
+
+// StaticBatch, meshes sharing a material merged into few large meshes
+typedef struct StaticBatch {
+    int meshCount;          // Number of merged meshes
+    Mesh *meshes;           // Merged meshes array
+    Material material;      // Material shared by all meshes
+    int rangeCount;         // Number of source meshes
+    StaticBatchRange *ranges;   // Source meshes ranges, by loading order
+} StaticBatch;
+
 // Ray, ray for raycasting
 typedef struct Ray {
     Vector3 position;       // Ray position (origin)
@@ -842,6 +883,17 @@ typedef enum {
     PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA    // 2 bpp
 } PixelFormat;
 
+// Image color operations
+// NOTE: Used by ImageColorOps(), operations are applied in place keeping image pixel format
+typedef enum {
+    IMAGE_COLOR_TINT = 0,           // Multiply pixels by color (ImageColorTint())
+    IMAGE_COLOR_INVERT,             // Invert color channels (ImageColorInvert())
+    IMAGE_COLOR_GRAYSCALE,          // Set color channels to luminance, keeping alpha
+    IMAGE_COLOR_CONTRAST,           // Adjust contrast by value (ImageColorContrast())
+    IMAGE_COLOR_BRIGHTNESS,         // Adjust brightness by value (ImageColorBrightness())
+    IMAGE_COLOR_REPLACE             // Replace pixels equal to color (ImageColorReplace())
+} ImageColorOpType;
+
 // Texture parameters: filter mode
 // NOTE 1: Filtering considers mipmaps if available in the texture
 // NOTE 2: Filter is accordingly set for minification and magnification
@@ -1022,6 +1074,9 @@ RLAPI void BeginShaderMode(Shader shader);                        // Begin custo
 RLAPI void EndShaderMode(void);                                   // End custom shader drawing (use default shader)
 RLAPI void BeginBlendMode(int mode);                              // Begin blending mode (alpha, additive, multiplied, subtract, custom)
 RLAPI void EndBlendMode(void);                                    // End blending mode (reset to default: alpha blending)
+RLAPI void BeginDeferredMode(void);                               // Begin deferred mode (record 2d draw commands, sorted on replay)
+RLAPI void EndDeferredMode(void);                                 // End deferred mode (replay recorded draw commands)
+RLAPI void SetDrawLayer(int layer);                               // Set draw layer for deferred mode (lower layers drawn first)
 RLAPI void BeginScissorMode(int x, int y, int width, int height); // Begin scissor mode (define screen area for following drawing)
 RLAPI void EndScissorMode(void);                                  // End scissor mode
 RLAPI void BeginVrStereoMode(VrStereoConfig config);              // Begin stereo rendering (requires VR simulator)
@@ -1043,6 +1098,8 @@ RLAPI void SetShaderValueV(Shader shader, int locIndex, const void *value, int u
 RLAPI void SetShaderValueMatrix(Shader shader, int locIndex, Matrix mat);         // Set shader uniform value (matrix 4x4)
 RLAPI void SetShaderValueTexture(Shader shader, int locIndex, Texture2D texture); // Set shader uniform value for texture (sampler2d)
 RLAPI void UnloadShader(Shader shader);                                    // Unload shader from GPU memory (VRAM)
+RLAPI void SetShaderCacheDirectory(const char *dirPath);                   // Set directory for shader program binaries cache, NULL disables it
+RLAPI ShaderCacheStats GetShaderCacheStats(void);                          // Get shader program binaries cache statistics
 
 // Screen-space-related functions
 RLAPI Ray GetMouseRay(Vector2 mousePosition, Camera camera);      // Get a ray trace from mouse position
@@ -1301,6 +1358,8 @@ RLAPI Image LoadImageFromTexture(Texture2D texture);
 RLAPI Image LoadImageFromScreen(void);                                                                   // Load image from screen buffer and (screenshot)
 RLAPI bool IsImageReady(Image image);                                                                    // Check if an image is ready
 RLAPI void UnloadImage(Image image);                                                                     // Unload image from CPU memory (RAM)
+RLAPI void SetImageThreadCount(int count);                                                               // Set threads processing large images (0: one per CPU core, 1: calling thread only)
+RLAPI int GetImageThreadCount(void);                                                                     // Get threads processing large images
 RLAPI bool ExportImage(Image image, const char *fileName);                                               // Export image data to file, returns true on success
 RLAPI unsigned char *ExportImageToMemory(Image image, const char *fileType, int *fileSize);              // Export image to memory buffer
 RLAPI bool ExportImageAsCode(Image image, const char *fileName);                                         // Export image as code file defining an array of bytes, returns true on success
@@ -1314,6 +1373,9 @@ RLAPI Image GenImageChecked(int width, int height, int checksX, int checksY, Col
 RLAPI Image GenImageWhiteNoise(int width, int height, float factor);                                     // Generate image: white noise
 RLAPI Image GenImagePerlinNoise(int width, int height, int offsetX, int offsetY, float scale);           // Generate image: perlin noise
 RLAPI Image GenImageCellular(int width, int height, int tileSize);                                       // Generate image: cellular algorithm, bigger tileSize means bigger cells
+RLAPI Image GenImageWhiteNoiseRec(int width, int height, Rectangle rec, float factor, unsigned int seed);  // Generate image: white noise, region of a width x height image (for tiled generation)
+RLAPI Image GenImagePerlinNoiseRec(int width, int height, Rectangle rec, int offsetX, int offsetY, float scale); // Generate image: perlin noise, region of a width x height image (for tiled generation)
+RLAPI Image GenImageCellularRec(int width, int height, Rectangle rec, int tileSize, unsigned int seed);    // Generate image: cellular algorithm, region of a width x height image (for tiled generation)
 RLAPI Image GenImageText(int width, int height, const char *text);                                       // Generate image: grayscale image from text data
 
 // Image manipulation functions
@@ -1345,6 +1407,7 @@ RLAPI void ImageColorGrayscale(Image *image);
 RLAPI void ImageColorContrast(Image *image, float contrast);                                             // Modify image color: contrast (-100 to 100)
 RLAPI void ImageColorBrightness(Image *image, int brightness);                                           // Modify image color: brightness (-255 to 255)
 RLAPI void ImageColorReplace(Image *image, Color color, Color replace);                                  // Modify image color: replace color
+RLAPI void ImageColorOps(Image *image, const ImageColorOp *ops, int opCount);                           // Modify image color: apply operations in order, fused in one pass over pixels
 RLAPI Color *LoadImageColors(Image image);                                                               // Load color data from image as a Color array (RGBA - 32bit)
 RLAPI Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorCount);                         // Load colors palette from image as a Color array (RGBA - 32bit)
 RLAPI void UnloadImageColors(Color *colors);                                                             // Unload color data loaded with LoadImageColors()
@@ -1368,6 +1431,7 @@ RLAPI void ImageDrawRectangleV(Image *dst, Vector2 position, Vector2 size, Color
 RLAPI void ImageDrawRectangleRec(Image *dst, Rectangle rec, Color color);                                // Draw rectangle within an image
 RLAPI void ImageDrawRectangleLines(Image *dst, Rectangle rec, int thick, Color color);                   // Draw rectangle lines within an image
 RLAPI void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint);             // Draw a source image within a destination image (tint applied to source)
+RLAPI void ImageDrawBlend(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint, int blendMode); // Draw a source image within a destination image with blend mode (BLEND_ALPHA, BLEND_ALPHA_PREMULTIPLY)
 RLAPI void ImageDrawText(Image *dst, const char *text, int posX, int posY, int fontSize, Color color);   // Draw text (using default font) within an image (destination)
 RLAPI void ImageDrawTextEx(Image *dst, Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint); // Draw text (custom sprite font) within an image (destination)
 
@@ -1396,6 +1460,7 @@ RLAPI void DrawTextureEx(Texture2D texture, Vector2 position, float rotation, fl
 RLAPI void DrawTextureRec(Texture2D texture, Rectangle source, Vector2 position, Color tint);            // Draw a part of a texture defined by a rectangle
 RLAPI void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint); // Draw a part of a texture defined by a rectangle with 'pro' parameters
 RLAPI void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest, Vector2 origin, float rotation, Color tint); // Draws a texture (or part of it) that stretches or shrinks nicely
+RLAPI void DrawSpriteInstances(Texture2D texture, const SpriteInstance *sprites, int count);             // Draw sprites from a texture (atlas) with GPU instancing, i.e. particles
 
 // Color/pixel related functions
 RLAPI Color Fade(Color color, float alpha);                                 // Get color with alpha applied, alpha goes from 0.0f to 1.0f
@@ -1433,6 +1498,7 @@ RLAPI bool ExportFontAsCode(Font font, const char *fileName);
 
 // Text drawing functions
 RLAPI void DrawFPS(int posX, int posY);                                                     // Draw current FPS
+RLAPI void DrawFrameStats(int posX, int posY);                                              // Draw last frame statistics (draw calls, vertices, binds, CPU/GPU time)
 RLAPI void DrawText(const char *text, int posX, int posY, int fontSize, Color color);       // Draw text (using default font)
 RLAPI void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint); // Draw text using font and additional parameters
 RLAPI void DrawTextPro(Font font, const char *text, Vector2 position, Vector2 origin, float rotation, float fontSize, float spacing, Color tint); // Draw text using Font and pro parameters (rotation)
@@ -1530,6 +1596,13 @@ RLAPI void UpdateMeshBuffer(Mesh mesh, int index, const void *data, int dataSize
 RLAPI void UnloadMesh(Mesh mesh);                                                           // Unload mesh data from CPU and GPU
 RLAPI void DrawMesh(Mesh mesh, Material material, Matrix transform);                        // Draw a 3d mesh with material and transform
 RLAPI void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, int instances); // Draw multiple mesh instances with material and different transforms
+RLAPI void EnableMeshCulling(void);                                                         // Enable frustum culling, DrawMesh() skips meshes outside of view frustum
+RLAPI void DisableMeshCulling(void);                                                        // Disable frustum culling
+RLAPI bool IsMeshCullingEnabled(void);                                                      // Check if frustum culling is enabled
+RLAPI StaticBatch LoadStaticBatch(const Mesh *meshes, const Matrix *transforms, int count, Material material); // Load static batch, meshes are merged with their transforms applied
+RLAPI void UnloadStaticBatch(StaticBatch batch);                                            // Unload static batch merged meshes (material is not unloaded)
+RLAPI void DrawStaticBatch(StaticBatch batch, Matrix transform);                            // Draw static batch, one draw call per merged mesh
+RLAPI void DrawStaticBatchRange(StaticBatch batch, int first, int count, Matrix transform);  // Draw a range of the meshes merged into static batch
 RLAPI bool ExportMesh(Mesh mesh, const char *fileName);                                     // Export mesh data to file, returns true on success
 RLAPI BoundingBox GetMeshBoundingBox(Mesh mesh);                                            // Compute mesh bounding box limits
 RLAPI void GenMeshTangents(Mesh *mesh);                                                     // Compute mesh tangents
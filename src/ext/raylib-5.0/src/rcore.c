@@ -19,6 +19,8 @@
 *           - Linux DRM subsystem (KMS mode)
 *       > PLATFORM_ANDROID:
 *           - Android (ARM, ARM64)
+*       > PLATFORM_HEADLESS (software rendering, requires GRAPHICS_API_OPENGL_11_SOFTWARE):
+*           - Linux, FreeBSD and other POSIX systems, no display or GPU required
 *
 *   CONFIGURATION:
 *       #define SUPPORT_DEFAULT_FONT (default)
@@ -359,6 +361,21 @@ bool gifRecording = false;           // GIF recording state
 MsfGifState gifState = { 0 };        // MSGIF context state
 #endif
 
+#if defined(SUPPORT_SHADER_CACHE)
+// Shader program binary cache file header, program binary follows
+// NOTE: File name is the hash of shaders code and driver, checked again on loading
+typedef struct ShaderCacheHeader {
+    unsigned int signature;             // File signature: "rSPB"
+    unsigned int format;                // Program binary format (driver specific)
+    unsigned long long int hash;        // Shaders code and driver hash (FNV-1a 64bit)
+    float compileTime;                  // Time to compile and link program from code (milliseconds)
+    int dataSize;                       // Program binary size in bytes
+} ShaderCacheHeader;
+
+static char shaderCacheDirectory[MAX_FILEPATH_LENGTH] = { 0 };  // Shader program binaries cache directory, empty if disabled
+static ShaderCacheStats shaderCacheStats = { 0 };               // Shader program binaries cache statistics
+#endif
+
 #if defined(SUPPORT_AUTOMATION_EVENTS)
 // Automation events type
 typedef enum AutomationEventType {
@@ -471,6 +488,10 @@ static void ScanDirectoryFilesRecursively(const char *basePath, FilePathList *li
 static void RecordAutomationEvent(void); // Record frame events (to internal events array)
 #endif
 
+#if defined(SUPPORT_SHADER_CACHE)
+static unsigned int LoadShaderCodeCached(const char *vsCode, const char *fsCode);  // Load shader program from binaries cache, compiled from code and cached on miss
+#endif
+
 #if defined(_WIN32)
 // NOTE: We declare Sleep() function symbol to avoid including windows.h (kernel32.lib linkage required)
 void __stdcall Sleep(unsigned long msTimeout);              // Required for: WaitTime()
@@ -491,6 +512,8 @@ const char *TextFormat(const char *text, ...);              // Formatting of tex
     #include "platforms/rcore_drm.c"
 #elif defined(PLATFORM_ANDROID)
     #include "platforms/rcore_android.c"
+#elif defined(PLATFORM_HEADLESS)
+    #include "platforms/rcore_headless.c"
 #else
     // TODO: Include your custom platform backend!
     // i.e software rendering backend or console backend!
@@ -559,6 +582,8 @@ void InitWindow(int width, int height, const char *title)
     TRACELOG(LOG_INFO, "Platform backend: NATIVE DRM");
 #elif defined(PLATFORM_ANDROID)
     TRACELOG(LOG_INFO, "Platform backend: ANDROID");
+#elif defined(PLATFORM_HEADLESS)
+    TRACELOG(LOG_INFO, "Platform backend: HEADLESS (software rendering)");
 #else
     // TODO: Include your custom platform backend!
     // i.e software rendering backend or console backend!
@@ -865,6 +890,9 @@ void EndDrawing(void)
     }
 #endif
 
+    // Finish frame statistics before swapping, CPU time of update and draw so far
+    rlUpdateFrameStats((float)((CORE.Time.update + GetTime() - CORE.Time.previous)*1000.0));
+
 #if defined(SUPPORT_AUTOMATION_EVENTS)
     if (automationEventRecording) RecordAutomationEvent();    // Event recording
 #endif
@@ -947,11 +975,15 @@ void BeginMode2D(Camera2D camera)
 
     // Apply screen scaling if required
     rlMultMatrixf(MatrixToFloat(CORE.Window.screenScale));
+
+    rlPushGpuTimer("Mode2D");
 }
 
 // Ends 2D mode with custom camera
 void EndMode2D(void)
 {
+    rlPopGpuTimer();
+
     rlDrawRenderBatchActive();      // Update and draw internal render batch
 
     rlLoadIdentity();               // Reset current matrix (modelview)
@@ -995,11 +1027,15 @@ void BeginMode3D(Camera camera)
     rlMultMatrixf(MatrixToFloat(matView));      // Multiply modelview matrix by view matrix (camera)
 
     rlEnableDepthTest();            // Enable DEPTH_TEST for 3D
+
+    rlPushGpuTimer("Mode3D");
 }
 
 // Ends 3D mode and returns to default 2D orthographic mode
 void EndMode3D(void)
 {
+    rlPopGpuTimer();
+
     rlDrawRenderBatchActive();      // Update and draw internal render batch
 
     rlMatrixMode(RL_PROJECTION);    // Switch to projection matrix
@@ -1042,11 +1078,15 @@ void BeginTextureMode(RenderTexture2D target)
     CORE.Window.currentFbo.width = target.texture.width;
     CORE.Window.currentFbo.height = target.texture.height;
     CORE.Window.usingFbo = true;
+
+    rlPushGpuTimer("TextureMode");
 }
 
 // Ends drawing to render texture
 void EndTextureMode(void)
 {
+    rlPopGpuTimer();
+
     rlDrawRenderBatchActive();      // Update and draw internal render batch
 
     rlDisableFramebuffer();         // Disable render target (fbo)
@@ -1064,11 +1104,15 @@ void EndTextureMode(void)
 void BeginShaderMode(Shader shader)
 {
     rlSetShader(shader.id, shader.locs);
+
+    rlPushGpuTimer("ShaderMode");
 }
 
 // End custom shader mode (returns to default shader)
 void EndShaderMode(void)
 {
+    rlPopGpuTimer();
+
     rlSetShader(rlGetShaderIdDefault(), rlGetShaderLocsDefault());
 }
 
@@ -1077,14 +1121,39 @@ void EndShaderMode(void)
 void BeginBlendMode(int mode)
 {
     rlSetBlendMode(mode);
+
+    rlPushGpuTimer("BlendMode");
 }
 
 // End blending mode (reset to default: alpha blending)
 void EndBlendMode(void)
 {
+    rlPopGpuTimer();
+
     rlSetBlendMode(BLEND_ALPHA);
 }
 
+// Begin deferred mode (record 2d draw commands, sorted by layer and state on replay)
+// NOTE: Commands are replayed on EndDeferredMode() and on any internal render batch draw
+// (EndMode2D(), BeginScissorMode(), EndDrawing()...), shader uniforms set in between
+// apply to all replayed commands
+void BeginDeferredMode(void)
+{
+    rlEnableDeferredDraw();
+}
+
+// End deferred mode (replay recorded draw commands)
+void EndDeferredMode(void)
+{
+    rlDisableDeferredDraw();
+}
+
+// Set draw layer for following drawing in deferred mode (lower layers drawn first)
+void SetDrawLayer(int layer)
+{
+    rlSetDrawLayer(layer);
+}
+
 // Begin scissor mode (define screen area for following drawing)
 // NOTE: Scissor rec refers to bottom-left corner, we change it to upper-left
 void BeginScissorMode(int x, int y, int width, int height)
@@ -1110,11 +1179,15 @@ void BeginScissorMode(int x, int y, int width, int height)
     {
         rlScissor(x, CORE.Window.currentFbo.height - (y + height), width, height);
     }
+
+    rlPushGpuTimer("ScissorMode");
 }
 
 // End scissor mode
 void EndScissorMode(void)
 {
+    rlPopGpuTimer();
+
     rlDrawRenderBatchActive();      // Update and draw internal render batch
     rlDisableScissorTest();
 }
@@ -1248,7 +1321,11 @@ Shader LoadShaderFromMemory(const char *vsCode, const char *fsCode)
 {
     Shader shader = { 0 };
 
+#if defined(SUPPORT_SHADER_CACHE)
+    shader.id = LoadShaderCodeCached(vsCode, fsCode);
+#else
     shader.id = rlLoadShaderCode(vsCode, fsCode);
+#endif
 
     // After shader loading, we TRY to set default location names
     if (shader.id > 0)
@@ -1337,6 +1414,35 @@ void UnloadShader(Shader shader)
     }
 }
 
+// Set directory for shader program binaries cache, NULL disables it
+// NOTE: Directory must exist, binaries are stored by hash of shaders code and driver,
+// programs are compiled from code if binaries are missing, stale or rejected by driver
+void SetShaderCacheDirectory(const char *dirPath)
+{
+#if defined(SUPPORT_SHADER_CACHE)
+    if (dirPath == NULL) shaderCacheDirectory[0] = '\0';
+    else
+    {
+        strncpy(shaderCacheDirectory, dirPath, MAX_FILEPATH_LENGTH - 1);
+        shaderCacheDirectory[MAX_FILEPATH_LENGTH - 1] = '\0';
+
+        if (!DirectoryExists(shaderCacheDirectory)) TRACELOG(LOG_WARNING, "SHADER: Cache directory does not exist (%s)", shaderCacheDirectory);
+    }
+#else
+    TRACELOG(LOG_WARNING, "SHADER: Program binaries cache not supported, SUPPORT_SHADER_CACHE not defined");
+#endif
+}
+
+// Get shader program binaries cache statistics, since program start
+ShaderCacheStats GetShaderCacheStats(void)
+{
+#if defined(SUPPORT_SHADER_CACHE)
+    return shaderCacheStats;
+#else
+    return (ShaderCacheStats){ 0 };
+#endif
+}
+
 // Get shader uniform location
 int GetShaderLocation(Shader shader, const char *uniformName)
 {
@@ -3537,6 +3643,90 @@ static void RecordAutomationEvent(void)
 }
 #endif
 
+#if defined(SUPPORT_SHADER_CACHE)
+// Load shader program from binaries cache, compiled from code and cached on miss
+// NOTE: Programs failing to compile (default shader returned) are not cached
+static unsigned int LoadShaderCodeCached(const char *vsCode, const char *fsCode)
+{
+    #define SHADER_CACHE_SIGNATURE  0x42505372      // "rSPB" (little endian)
+
+    const char *driver = rlGetShaderBinaryDriver();
+    if ((shaderCacheDirectory[0] == '\0') || (driver[0] == '\0')) return rlLoadShaderCode(vsCode, fsCode);
+
+    // Hash shaders code and driver identification, strings are hashed with their terminator
+    // so a code moved from one shader to the other changes the hash
+    const char *keys[3] = { (vsCode != NULL)? vsCode : "", (fsCode != NULL)? fsCode : "", driver };
+    unsigned long long int hash = 14695981039346656037ULL;
+    for (int k = 0; k < 3; k++)
+    {
+        const unsigned char *c = (const unsigned char *)keys[k];
+        do { hash ^= *c; hash *= 1099511628211ULL; } while (*c++ != '\0');
+    }
+
+    const char *fileName = TextFormat("%s/%016llx.spb", shaderCacheDirectory, hash);
+    unsigned int id = 0;
+    double startTime = GetTime();
+
+    if (FileExists(fileName))
+    {
+        int fileSize = 0;
+        unsigned char *fileData = LoadFileData(fileName, &fileSize);
+        ShaderCacheHeader header = { 0 };
+        if (fileSize >= (int)sizeof(ShaderCacheHeader)) memcpy(&header, fileData, sizeof(ShaderCacheHeader));
+
+        if ((header.signature == SHADER_CACHE_SIGNATURE) && (header.hash == hash) &&
+            (header.dataSize == fileSize - (int)sizeof(ShaderCacheHeader)))
+        {
+            id = rlLoadShaderProgramBinary(fileData + sizeof(ShaderCacheHeader), header.dataSize, header.format);
+        }
+
+        UnloadFileData(fileData);
+
+        if (id > 0)
+        {
+            float loadTime = (float)((GetTime() - startTime)*1000.0);
+            shaderCacheStats.hits++;
+            shaderCacheStats.timeSaved += header.compileTime - loadTime;
+            TRACELOG(LOG_INFO, "SHADER: [ID %i] Program loaded from cache in %.2f ms (compiled in %.2f ms)", id, loadTime, header.compileTime);
+            return id;
+        }
+
+        TRACELOG(LOG_INFO, "SHADER: Cached program binary is stale, compiling from code (%s)", fileName);
+    }
+
+    // Cache miss, compile program from code and store its binary
+    // NOTE: Compile time is measured from here, reading a stale cached binary is not part of it
+    startTime = GetTime();
+    id = rlLoadShaderCode(vsCode, fsCode);
+    float compileTime = (float)((GetTime() - startTime)*1000.0);
+    shaderCacheStats.misses++;
+
+    if ((id > 0) && (id != rlGetShaderIdDefault()))
+    {
+        ShaderCacheHeader header = { SHADER_CACHE_SIGNATURE, 0, hash, compileTime, 0 };
+        int format = 0;
+        unsigned char *binary = rlGetShaderProgramBinary(id, &header.dataSize, &format);
+
+        if (binary != NULL)
+        {
+            header.format = (unsigned int)format;
+
+            int fileSize = (int)sizeof(ShaderCacheHeader) + header.dataSize;
+            unsigned char *fileData = (unsigned char *)RL_MALLOC(fileSize);
+            memcpy(fileData, &header, sizeof(ShaderCacheHeader));
+            memcpy(fileData + sizeof(ShaderCacheHeader), binary, header.dataSize);
+
+            if (SaveFileData(fileName, fileData, fileSize)) shaderCacheStats.stored++;
+
+            RL_FREE(fileData);
+            RL_FREE(binary);
+        }
+    }
+
+    return id;
+}
+#endif  // SUPPORT_SHADER_CACHE
+
 #if !defined(SUPPORT_MODULE_RTEXT)
 // Formatting of text with variables to 'embed'
 // WARNING: String returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times
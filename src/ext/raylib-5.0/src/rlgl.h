@@ -27,7 +27,10 @@
 *       #define GRAPHICS_API_OPENGL_43
 *       #define GRAPHICS_API_OPENGL_ES2
 *       #define GRAPHICS_API_OPENGL_ES3
+*       #define GRAPHICS_API_OPENGL_11_SOFTWARE
 *           Use selected OpenGL graphics backend, should be supported by platform
+*           GRAPHICS_API_OPENGL_11_SOFTWARE renders the OpenGL 1.1 path with the software
+*           rasterizer in external/rlsw.h, into a framebuffer in memory
 *           Those preprocessor defines are only used on rlgl module, if OpenGL version is
 *           required by any other module, use rlGetVersion() to check it
 *
@@ -46,16 +49,33 @@
 *       #define RLGL_ENABLE_OPENGL_DEBUG_CONTEXT
 *           Enable debug context (only available on OpenGL 4.3)
 *
+*       #define RLGL_INTERLEAVED_BATCH
+*           Store render batch vertices interleaved (position + texcoord + color, 24 bytes) in a single
+*           buffer per batch, uploaded with one call per draw. On OpenGL 3.3 with GL_ARB_buffer_storage
+*           the buffers are persistently mapped and written directly by rlVertex3f(), otherwise they
+*           are updated with unsynchronized mapping. Batch buffers are used as a fenced ring
+*           (RL_DEFAULT_BATCH_BUFFERS defaults to 3)
+*
+*       #define RLGL_MULTI_TEXTURE_BATCH
+*           Bind up to RL_DEFAULT_BATCH_TEXTURES textures per batch draw call, the default shader selects
+*           the texture from an index stored per vertex, so texture switches (i.e. drawing sprites from
+*           several atlases) do not split draw calls. Custom shaders keep one texture per draw call.
+*           Implies RLGL_INTERLEAVED_BATCH
+*
 *       rlgl capabilities could be customized just defining some internal
 *       values before library inclusion (default values listed):
 *
 *       #define RL_DEFAULT_BATCH_BUFFER_ELEMENTS   8192    // Default internal render batch elements limits
-*       #define RL_DEFAULT_BATCH_BUFFERS              1    // Default number of batch buffers (multi-buffering)
+*       #define RL_DEFAULT_BATCH_BUFFERS              1    // Default number of batch buffers (multi-buffering, 3 with RLGL_INTERLEAVED_BATCH)
 *       #define RL_DEFAULT_BATCH_DRAWCALLS          256    // Default number of batch draw calls (by state changes: mode, texture)
 *       #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS    4    // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
+*       #define RL_DEFAULT_BATCH_TEXTURES             8    // Maximum number of textures per batch draw call (RLGL_MULTI_TEXTURE_BATCH)
+*       #define RL_DEFAULT_SPRITE_INSTANCES       65536    // Initial sprite instances per frame (grown when a frame draws more)
+*       #define RL_DEFAULT_SPRITE_BUFFERS             3    // Number of frames in flight in the sprite instances ring (one fence per frame)
 *
 *       #define RL_MAX_MATRIX_STACK_SIZE             32    // Maximum size of internal Matrix stack
 *       #define RL_MAX_SHADER_LOCATIONS              32    // Maximum number of shader locations supported
+*       #define RL_MAX_GPU_TIMER_SCOPES              16    // Maximum number of GPU timer scopes measured per frame
 *       #define RL_CULL_DISTANCE_NEAR              0.01    // Default projection matrix near cull distance
 *       #define RL_CULL_DISTANCE_FAR             1000.0    // Default projection matrix far cull distance
 *
@@ -68,6 +88,7 @@
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR        "vertexColor"       // Bound by default to shader location: 3
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT      "vertexTangent"     // Bound by default to shader location: 4
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2    "vertexTexCoord2"   // Bound by default to shader location: 5
+*       #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXINDEX     "vertexTexIndex"    // Bound by default to shader location: 6 (RLGL_MULTI_TEXTURE_BATCH)
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW        "matView"           // view matrix
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_PROJECTION  "matProjection"     // projection matrix
@@ -144,6 +165,11 @@
     #define RL_FREE(p)        free(p)
 #endif
 
+// OpenGL 1.1 software rasterizer (external/rlsw.h) uses the OpenGL 1.1 code path
+#if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+    #define GRAPHICS_API_OPENGL_11
+#endif
+
 // Security check in case no GRAPHICS_API_OPENGL_* defined
 #if !defined(GRAPHICS_API_OPENGL_11) && \
     !defined(GRAPHICS_API_OPENGL_21) && \
@@ -208,8 +234,16 @@
         #define RL_DEFAULT_BATCH_BUFFER_ELEMENTS  2048
     #endif
 #endif
+// Multi-texture batching stores the texture index in the interleaved vertex
+#if defined(RLGL_MULTI_TEXTURE_BATCH) && !defined(RLGL_INTERLEAVED_BATCH)
+    #define RLGL_INTERLEAVED_BATCH
+#endif
 #ifndef RL_DEFAULT_BATCH_BUFFERS
-    #define RL_DEFAULT_BATCH_BUFFERS                 1      // Default number of batch buffers (multi-buffering)
+    #if defined(RLGL_INTERLEAVED_BATCH)
+        #define RL_DEFAULT_BATCH_BUFFERS             3      // Default number of batch buffers (ring of fenced buffers)
+    #else
+        #define RL_DEFAULT_BATCH_BUFFERS             1      // Default number of batch buffers (multi-buffering)
+    #endif
 #endif
 #ifndef RL_DEFAULT_BATCH_DRAWCALLS
     #define RL_DEFAULT_BATCH_DRAWCALLS             256      // Default number of batch draw calls (by state changes: mode, texture)
@@ -217,6 +251,15 @@
 #ifndef RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS
     #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS       4      // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
 #endif
+#ifndef RL_DEFAULT_BATCH_TEXTURES
+    #define RL_DEFAULT_BATCH_TEXTURES                8      // Maximum number of textures per batch draw call (RLGL_MULTI_TEXTURE_BATCH)
+#endif
+#ifndef RL_DEFAULT_SPRITE_INSTANCES
+    #define RL_DEFAULT_SPRITE_INSTANCES          65536      // Initial sprite instances per frame (grown when a frame draws more)
+#endif
+#ifndef RL_DEFAULT_SPRITE_BUFFERS
+    #define RL_DEFAULT_SPRITE_BUFFERS                3      // Number of frames in flight in the sprite instances ring (one fence per frame)
+#endif
 
 // Internal Matrix stack
 #ifndef RL_MAX_MATRIX_STACK_SIZE
@@ -228,6 +271,11 @@
     #define RL_MAX_SHADER_LOCATIONS                 32      // Maximum number of shader locations supported
 #endif
 
+// Frame statistics
+#ifndef RL_MAX_GPU_TIMER_SCOPES
+    #define RL_MAX_GPU_TIMER_SCOPES                 16      // Maximum number of GPU timer scopes measured per frame
+#endif
+
 // Projection matrix culling
 #ifndef RL_CULL_DISTANCE_NEAR
     #define RL_CULL_DISTANCE_NEAR                 0.01      // Default near cull distance
@@ -340,13 +388,32 @@ typedef struct Matrix {
 #define RL_MATRIX_TYPE
 #endif
 
+#if defined(RLGL_INTERLEAVED_BATCH)
+// Interleaved batch vertex (24 bytes, 28 bytes with RLGL_MULTI_TEXTURE_BATCH)
+typedef struct rlBatchVertex {
+    float x, y, z;              // Vertex position (shader-location = 0)
+    float u, v;                 // Vertex texture coordinates (shader-location = 1)
+    unsigned char r, g, b, a;   // Vertex color (shader-location = 3)
+#if defined(RLGL_MULTI_TEXTURE_BATCH)
+    unsigned char texIndex;     // Vertex texture index into draw call textureIds (shader-location = 6)
+    unsigned char padding[3];
+#endif
+} rlBatchVertex;
+#endif
+
 // Dynamic vertex buffers (position + texcoords + colors + indices arrays)
 typedef struct rlVertexBuffer {
     int elementCount;           // Number of elements in the buffer (QUADS)
 
+#if defined(RLGL_INTERLEAVED_BATCH)
+    rlBatchVertex *data;        // Interleaved vertex data, points into mapped GPU memory when persistent
+    bool persistent;            // Vertex data is persistently mapped (no upload required on draw)
+    void *fence;                // Sync object signaled when GPU finished reading this buffer (GLsync)
+#else
     float *vertices;            // Vertex position (XYZ - 3 components per vertex) (shader-location = 0)
     float *texcoords;           // Vertex texture coordinates (UV - 2 components per vertex) (shader-location = 1)
     unsigned char *colors;      // Vertex colors (RGBA - 4 components per vertex) (shader-location = 3)
+#endif
 #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
     unsigned int *indices;      // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
 #endif
@@ -354,7 +421,7 @@ typedef struct rlVertexBuffer {
     unsigned short *indices;    // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
 #endif
     unsigned int vaoId;         // OpenGL Vertex Array Object id
-    unsigned int vboId[4];      // OpenGL Vertex Buffer Objects id (4 types of vertex data)
+    unsigned int vboId[4];      // OpenGL Vertex Buffer Objects id (4 types of vertex data, only [0] and [3] used if interleaved)
 } rlVertexBuffer;
 
 // Draw call type
@@ -368,6 +435,10 @@ typedef struct rlDrawCall {
     //unsigned int vaoId;       // Vertex array id to be used on the draw -> Using RLGL.currentBatch->vertexBuffer.vaoId
     //unsigned int shaderId;    // Shader id to be used on the draw -> Using RLGL.currentShaderId
     unsigned int textureId;     // Texture id to be used on the draw -> Use to create new draw call if changes
+#if defined(RLGL_MULTI_TEXTURE_BATCH)
+    unsigned int textureIds[RL_DEFAULT_BATCH_TEXTURES]; // Textures bound for the draw, selected by vertex texIndex (textureIds[0] == textureId)
+    int textureCount;           // Number of textures used by the draw
+#endif
 
     //Matrix projection;        // Projection matrix for this draw -> Using RLGL.projection by default
     //Matrix modelview;         // Modelview matrix for this draw -> Using RLGL.modelview by default
@@ -384,6 +455,49 @@ typedef struct rlRenderBatch {
     float currentDepth;         // Current depth value for next draw
 } rlRenderBatch;
 
+// Command list, draw commands recorded on any thread (opaque)
+typedef struct rlCommandList rlCommandList;
+
+// Sprite instance, packed per-instance data for instanced sprite drawing (32 bytes)
+typedef struct rlSpriteInstance {
+    float x, y;                 // Sprite center position
+    float rotation;             // Sprite rotation in degrees
+    float scalex, scaley;       // Sprite scale, applied to source rectangle size
+    unsigned short sourcex, sourcey, sourcewidth, sourceheight; // Source rectangle in texture, in pixels
+    unsigned char r, g, b, a;   // Sprite tint color
+} rlSpriteInstance;
+
+// Deferred drawing statistics, accumulated since deferred drawing was enabled
+typedef struct rlDeferredStats {
+    int commandCount;           // Draw commands replayed (rlBegin()/rlEnd() blocks)
+    int vertexCount;            // Vertices replayed
+    int drawCallsRecorded;      // State changes (mode, texture, shader, blend) in recording order, as drawn immediately
+    int drawCallsSorted;        // State changes after sorting, as replayed
+} rlDeferredStats;
+
+// GPU timer scope, measured with timestamp queries
+typedef struct rlGpuTimerScope {
+    const char *name;           // Scope name (not copied, it must outlive the frame)
+    int depth;                  // Nesting depth of the scope
+    float time;                 // GPU time in milliseconds
+} rlGpuTimerScope;
+
+// Frame statistics, counted by rlgl during the frame
+// NOTE: GPU times are read back a few frames later to avoid stalls, they lag behind the counters
+typedef struct rlFrameStats {
+    int drawCalls;              // Draw calls issued (render batch draw calls and vertex arrays, i.e. DrawMesh())
+    int vertexCount;            // Vertices drawn (instanced draws count every instance)
+    int batchFlushes;           // Render batch draws with vertices (state changes, full buffers, Begin*Mode())
+    int textureBinds;           // Textures bound for drawing
+    int shaderSwitches;         // Shader program changes, counted where programs are enabled for drawing (rlEnableShader())
+    int cullTests;              // Bounding boxes checked against view frustum (rlCheckBoxInFrustum(), i.e. DrawMesh())
+    int culledCount;            // Bounding boxes found outside of view frustum, not drawn
+    float cpuTime;              // CPU frame time in milliseconds, as provided to rlUpdateFrameStats()
+    float gpuTime;              // GPU frame time in milliseconds, 0 if GPU timing is not enabled
+    int gpuScopeCount;          // GPU timer scopes measured
+    rlGpuTimerScope gpuScopes[RL_MAX_GPU_TIMER_SCOPES]; // GPU timer scopes, in order of begin
+} rlFrameStats;
+
 // OpenGL version
 typedef enum {
     RL_OPENGL_11 = 1,           // OpenGL 1.1
@@ -680,6 +794,37 @@ RLAPI bool rlCheckRenderBatchLimit(int vCount);                             // C
 
 RLAPI void rlSetTexture(unsigned int id);               // Set current texture for render batch and check buffers limits
 
+// Deferred drawing: draw commands are recorded and replayed into the render batch on next batch draw,
+// stable sorted by layer, shader, blend mode and texture
+RLAPI void rlEnableDeferredDraw(void);                  // Enable deferred drawing, following draw commands are recorded
+RLAPI void rlDisableDeferredDraw(void);                 // Disable deferred drawing, recorded draw commands are replayed
+RLAPI bool rlIsDeferredDrawEnabled(void);               // Check if deferred drawing is enabled
+RLAPI void rlSetDrawLayer(int layer);                   // Set layer of following deferred draw commands (lower layers drawn first)
+RLAPI rlDeferredStats rlGetDeferredStats(void);         // Get deferred drawing statistics
+
+// Command lists: draw commands recorded on any thread, submitted into the render batch on the OpenGL context thread
+RLAPI rlCommandList *rlLoadCommandList(void);           // Load a command list
+RLAPI void rlUnloadCommandList(rlCommandList *list);    // Unload a command list
+RLAPI void rlBeginCommandList(rlCommandList *list);     // Begin recording draw commands into a command list on calling thread
+RLAPI void rlEndCommandList(void);                      // End recording draw commands on calling thread
+RLAPI void rlSubmitCommandList(rlCommandList *list);    // Submit command list draw commands into render batch, in recording order
+
+// Instanced sprites: sprite instances streamed through a ring buffer and drawn with GPU instancing,
+// as render batch quads if instancing is not supported (OpenGL 1.1) or draw commands are recorded
+RLAPI void rlDrawSpriteInstances(unsigned int textureId, int textureWidth, int textureHeight, const rlSpriteInstance *instances, int count); // Draw sprite instances with a texture
+
+// Frustum culling: bounding boxes checked against current modelview and projection matrices
+RLAPI bool rlCheckBoxInFrustum(Matrix transform, float minX, float minY, float minZ, float maxX, float maxY, float maxZ); // Check if a bounding box, with transform applied, is inside view frustum
+
+// Frame statistics: counters and GPU timing of last finished frame
+RLAPI rlFrameStats rlGetFrameStats(void);               // Get statistics of last finished frame
+RLAPI void rlUpdateFrameStats(float cpuTime);           // Finish frame statistics, cpuTime in milliseconds (called once per frame)
+RLAPI void rlEnableGpuTiming(void);                     // Enable GPU timing with timestamp queries (if supported)
+RLAPI void rlDisableGpuTiming(void);                    // Disable GPU timing
+RLAPI bool rlIsGpuTimingEnabled(void);                  // Check if GPU timing is enabled
+RLAPI void rlPushGpuTimer(const char *name);            // Begin a GPU timer scope, scopes can be nested
+RLAPI void rlPopGpuTimer(void);                         // End last GPU timer scope
+
 //------------------------------------------------------------------------------------------------------------------------
 
 // Vertex buffers management
@@ -720,6 +865,9 @@ RLAPI void rlUnloadFramebuffer(unsigned int id);                          // Del
 RLAPI unsigned int rlLoadShaderCode(const char *vsCode, const char *fsCode);    // Load shader from code strings
 RLAPI unsigned int rlCompileShader(const char *shaderCode, int type);           // Compile custom shader and return shader id (type: RL_VERTEX_SHADER, RL_FRAGMENT_SHADER, RL_COMPUTE_SHADER)
 RLAPI unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId); // Load custom shader program
+RLAPI unsigned char *rlGetShaderProgramBinary(unsigned int id, int *dataSize, int *format); // Get linked shader program binary (if supported), data must be freed (RL_FREE)
+RLAPI unsigned int rlLoadShaderProgramBinary(const unsigned char *data, int dataSize, int format); // Load shader program from binary, returns 0 if driver rejects it
+RLAPI const char *rlGetShaderBinaryDriver(void);                               // Get driver identification program binaries depend on (vendor, renderer, version)
 RLAPI void rlUnloadShaderProgram(unsigned int id);                              // Unload shader program
 RLAPI int rlGetLocationUniform(unsigned int shaderId, const char *uniformName); // Get shader location uniform
 RLAPI int rlGetLocationAttrib(unsigned int shaderId, const char *attribName);   // Get shader location attribute
@@ -774,7 +922,10 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #if defined(RLGL_IMPLEMENTATION)
 
 #if defined(GRAPHICS_API_OPENGL_11)
-    #if defined(__APPLE__)
+    #if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+        #define RLSW_IMPLEMENTATION
+        #include "external/rlsw.h"      // OpenGL 1.1 software rasterizer, no GPU required
+    #elif defined(__APPLE__)
         #include <OpenGL/gl.h>          // OpenGL 1.1 library for OSX
         #include <OpenGL/glext.h>       // OpenGL extensions library
     #else
@@ -829,9 +980,10 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
     #endif
 #endif
 
-#include <stdlib.h>                     // Required for: malloc(), free()
+#include <stdlib.h>                     // Required for: malloc(), free(), qsort()
 #include <string.h>                     // Required for: strcmp(), strlen() [Used in rlglInit(), on extensions loading]
 #include <math.h>                       // Required for: sqrtf(), sinf(), cosf(), floor(), log()
+#include <stdio.h>                      // Required for: snprintf() [Used in rlLoadShaderDefault(), rlGetShaderBinaryDriver()]
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -846,6 +998,15 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
     #define RAD2DEG (180.0f/PI)
 #endif
 
+// Thread local storage, command lists record on worker threads
+#if defined(_MSC_VER)
+    #define RL_THREAD_LOCAL __declspec(thread)
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_THREADS__)
+    #define RL_THREAD_LOCAL _Thread_local
+#else
+    #define RL_THREAD_LOCAL __thread
+#endif
+
 #ifndef GL_SHADING_LANGUAGE_VERSION
     #define GL_SHADING_LANGUAGE_VERSION         0x8B8C
 #endif
@@ -929,6 +1090,9 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2
     #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2    "vertexTexCoord2"   // Bound by default to shader location: 5
 #endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_TEXINDEX
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXINDEX     "vertexTexIndex"    // Bound by default to shader location: 6
+#endif
 
 #ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_MVP
     #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
@@ -971,6 +1135,10 @@ typedef struct rlglData {
         float texcoordx, texcoordy;         // Current active texture coordinate (added on glVertex*())
         float normalx, normaly, normalz;    // Current active normal (added on glVertex*())
         unsigned char colorr, colorg, colorb, colora;   // Current active color (added on glVertex*())
+#if defined(RLGL_MULTI_TEXTURE_BATCH)
+        unsigned char textureIndex;         // Current active texture index in the draw textures (added on glVertex*())
+        unsigned int textureId;             // Current texture set by rlSetTexture(), registered again in draws opened by rlBegin() (0 if none)
+#endif
 
         int currentMatrixMode;              // Current matrix mode
         Matrix *currentMatrix;              // Current matrix pointer
@@ -1028,6 +1196,9 @@ typedef struct rlglData {
         bool texAnisoFilter;                // Anisotropic texture filtering support (GL_EXT_texture_filter_anisotropic)
         bool computeShader;                 // Compute shaders support (GL_ARB_compute_shader)
         bool ssbo;                          // Shader storage buffer object support (GL_ARB_shader_storage_buffer_object)
+        bool bufferStorage;                 // Immutable buffer storage support, allows persistent mapping (GL_ARB_buffer_storage)
+        bool timerQuery;                    // Timestamp queries support (GL_ARB_timer_query)
+        bool programBinary;                 // Shader program binaries support (GL_ARB_get_program_binary)
 
         float maxAnisotropyLevel;           // Maximum anisotropy level supported (minimum is 2.0f)
         int maxDepthBits;                   // Maximum bits for depth component
@@ -1039,13 +1210,135 @@ typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions
 
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
+// Deferred drawing recorded vertex
+typedef struct rlDeferredVertex {
+    float x, y, z;                          // Vertex position (already transformed on OpenGL 3.3+)
+    float u, v;                             // Vertex texture coordinates
+    unsigned char r, g, b, a;               // Vertex color
+} rlDeferredVertex;
+
+// Deferred drawing command, one rlBegin()/rlEnd() block
+typedef struct rlDeferredCommand {
+    int layer;                              // Sort key: draw layer
+    unsigned int shaderId;                  // Sort key: shader program id
+    int blendMode;                          // Sort key: blending mode
+    unsigned int textureId;                 // Sort key: texture id
+    int mode;                               // Sort key: drawing mode (RL_LINES, RL_TRIANGLES, RL_QUADS)
+    int order;                              // Recording order, keeps the sort stable
+    int *shaderLocs;                        // Shader locations, required to set the shader on replay
+    int vertexOffset;                       // First vertex in recorded vertices
+    int vertexCount;                        // Number of vertices
+    int matrixIndex;                        // Modelview matrix on recording (OpenGL 1.1 only)
+} rlDeferredCommand;
+
+// Draw commands recorder, used by deferred drawing and command lists
+// NOTE: Kept out of rlglData, deferred drawing is also available on OpenGL 1.1
+typedef struct rlglDeferredData {
+    bool enabled;                           // Deferred drawing enabled
+    bool threaded;                          // Command list, recorded on any thread without touching OpenGL or rlgl state
+    bool commandOpen;                       // Last command is still receiving vertices (inside rlBegin()/rlEnd())
+    int layer;                              // Current draw layer
+
+    unsigned int shaderId;                  // Current shader, applied to recorded commands
+    int *shaderLocs;                        // Current shader locations
+    int blendMode;                          // Current blending mode
+    unsigned int textureId;                 // Current texture, as the render batch would use it
+    int mode;                               // Current drawing mode, as the render batch would use it
+    bool drawHasVertices;                   // Render batch current draw call would contain vertices
+    float texcoordx, texcoordy;             // Current texture coordinate
+    unsigned char colorr, colorg, colorb, colora;   // Current color
+    float depth;                            // Current depth, incremented on rlEnd() like the render batch does
+
+    Matrix transform;                       // Current transform matrix (command lists only)
+    bool transformRequired;                 // Transform matrix has to be applied to recorded vertices (command lists only)
+    Matrix stack[RL_MAX_MATRIX_STACK_SIZE]; // Matrix stack for push/pop (command lists only)
+    int stackCounter;                       // Matrix stack counter (command lists only)
+
+    rlDeferredCommand *commands;            // Recorded commands
+    int commandCount;                       // Recorded commands counter
+    int commandCapacity;                    // Recorded commands allocated
+    rlDeferredVertex *vertices;             // Recorded vertices
+    int vertexCount;                        // Recorded vertices counter
+    int vertexCapacity;                     // Recorded vertices allocated
+    float *matrices;                        // Recorded modelview matrices, 16 floats each (OpenGL 1.1 only)
+    int matrixCount;                        // Recorded matrices counter
+    int matrixCapacity;                     // Recorded matrices allocated
+
+    rlDeferredStats stats;                  // Replay statistics
+} rlglDeferredData;
+
+// Command list, draw commands recorded on any thread
+struct rlCommandList {
+    rlglDeferredData recorder;              // Recorded commands
+};
+
+#define RL_GPU_TIMER_FRAMES     3       // Frames in flight before GPU timer queries are read back
+
+// GPU timer queries of one frame
+// NOTE: queries[0] and queries[1] are frame begin and end, queries[2 + 2*i] and queries[3 + 2*i] scope i begin and end
+typedef struct rlGpuTimerFrame {
+    unsigned int queries[2 + 2*RL_MAX_GPU_TIMER_SCOPES]; // Timestamp queries
+    const char *names[RL_MAX_GPU_TIMER_SCOPES];          // Scope names
+    int depths[RL_MAX_GPU_TIMER_SCOPES];                 // Scope nesting depths
+    int scopeCount;                                      // Scopes begun in the frame
+    bool pending;                                        // Queries issued, results not read back yet
+} rlGpuTimerFrame;
+
+// Frame statistics state
+typedef struct rlglStatsData {
+    rlFrameStats current;                   // Statistics of the frame being drawn
+    rlFrameStats last;                      // Statistics of last finished frame
+
+    unsigned int shaderId;                  // Last shader program enabled, shader switches are changes of it
+
+    bool gpuTiming;                         // GPU timing enabled
+    rlGpuTimerFrame gpuFrames[RL_GPU_TIMER_FRAMES];   // GPU timer queries of frames in flight
+    int gpuFrame;                           // Frame in flight being recorded
+    int gpuStack[RL_MAX_GPU_TIMER_SCOPES];  // Open scopes, indices into current frame scopes
+    int gpuStackCount;                      // Open scopes counter
+    int gpuStackSkipped;                    // Scopes begun beyond limits, not measured
+    float gpuTime;                          // GPU frame time last read back
+    int gpuScopeCount;                      // GPU timer scopes last read back
+    rlGpuTimerScope gpuScopes[RL_MAX_GPU_TIMER_SCOPES];  // GPU timer scopes last read back
+} rlglStatsData;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Instanced sprites renderer, loaded on first rlDrawSpriteInstances()
+typedef struct rlglSpriteData {
+    bool loaded;                            // Renderer load was tried, shaderId is 0 if it is not available
+    unsigned int shaderId;                  // Sprites shader program id
+    int locCorner;                          // Shader attribute location: quad corner (per vertex)
+    int locPosition;                        // Shader attribute location: position and rotation (per instance)
+    int locScale;                           // Shader attribute location: scale (per instance)
+    int locSource;                          // Shader attribute location: source rectangle (per instance)
+    int locColor;                           // Shader attribute location: tint color (per instance)
+    int locMvp;                             // Shader uniform location: model-view-projection matrix
+    int locTextureSize;                     // Shader uniform location: texture size in pixels
+
+    unsigned int vaoId;                     // OpenGL Vertex Array Object id (if VAO supported)
+    unsigned int vboId[2];                  // OpenGL Vertex Buffer Objects id: quad corners, instances ring buffer
+    rlSpriteInstance *mapped;               // Instances ring buffer, persistently mapped (NULL if not supported)
+    void *fences[RL_DEFAULT_SPRITE_BUFFERS];    // Sync objects signaled when GPU finished reading each frame segment (GLsync)
+    int frameCapacity;                      // Instances per ring segment, a frame of instances goes in one segment
+    int currentBuffer;                      // Ring segment written by current frame
+    int frameInstances;                     // Instances already written into current segment
+} rlglSpriteData;
+#endif
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 static rlglData RLGL = { 0 };
+static rlglSpriteData rlSprites = { 0 };
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
+static rlglDeferredData rlDeferred = { 0 };
+
+// Recorder of draw commands issued by calling thread: deferred drawing or a command list, NULL if drawing directly
+static RL_THREAD_LOCAL rlglDeferredData *rlRecorder = NULL;
+static rlglStatsData rlStats = { 0 };
+
 #if defined(GRAPHICS_API_OPENGL_ES2) && !defined(GRAPHICS_API_OPENGL_ES3)
 // NOTE: VAO functionality is exposed through extensions (OES)
 static PFNGLGENVERTEXARRAYSOESPROC glGenVertexArrays = NULL;
@@ -1071,9 +1364,32 @@ static const char *rlGetCompressedFormatName(int format); // Get compressed form
 
 static int rlGetPixelDataSize(int width, int height, int format);   // Get pixel data size in bytes (image or texture)
 
+static void rlDeferredBegin(rlglDeferredData *recorder, int mode);     // Record a new draw command
+static void rlDeferredEnd(rlglDeferredData *recorder);                  // Close the recorded draw command
+static void rlDeferredAddVertex(rlglDeferredData *recorder, float x, float y, float z);    // Record a vertex with current texcoord and color
+static void rlDeferredSetTexture(rlglDeferredData *recorder, unsigned int id);            // Record a texture change
+static void rlDeferredReplay(void);         // Replay recorded draw commands sorted into the render batch
+static void rlReplayCommands(const rlglDeferredData *recorder);         // Replay recorded draw commands in their order
+static bool rlIsRecordingCommandList(void);                             // Check if calling thread records a command list
+static void rlCommandListTransform(Matrix mat);                         // Multiply command list transform matrix
+
+static void rlDrawSpriteQuads(unsigned int textureId, int textureWidth, int textureHeight, const rlSpriteInstance *instances, int count); // Draw sprite instances as render batch quads
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static void rlLoadSpriteRenderer(void);     // Load instanced sprites renderer
+static void rlUnloadSpriteRenderer(void);   // Unload instanced sprites renderer
+static void rlEnableSpriteAttributes(bool enable);  // Enable/disable sprites shader attributes
+static void rlSetSpriteInstancesOffset(int offset); // Point instance attributes to a ring buffer offset
+static void rlLoadSpriteBuffer(void);       // Load instances ring buffer storage, frameCapacity instances per segment
+static void rlResizeSpriteBuffer(int instances);    // Grow instances ring buffer segments to hold a frame of instances
+static void rlEndSpriteFrame(void);         // Fence current frame segment, next frame writes the following one
+#endif
+
 // Auxiliar matrix math functions
 static Matrix rlMatrixIdentity(void);                       // Get identity matrix
 static Matrix rlMatrixMultiply(Matrix left, Matrix right);  // Multiply two matrices
+static Matrix rlMatrixTranslate(float x, float y, float z); // Get translation matrix
+static Matrix rlMatrixRotate(float angle, float x, float y, float z);  // Get rotation matrix, angle in degrees
+static Matrix rlMatrixScale(float x, float y, float z);     // Get scaling matrix
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Matrix operations
@@ -1103,13 +1419,45 @@ void rlOrtho(double left, double right, double bottom, double top, double znear,
     glOrtho(left, right, bottom, top, znear, zfar);
 }
 
-void rlPushMatrix(void) { glPushMatrix(); }
-void rlPopMatrix(void) { glPopMatrix(); }
-void rlLoadIdentity(void) { glLoadIdentity(); }
-void rlTranslatef(float x, float y, float z) { glTranslatef(x, y, z); }
-void rlRotatef(float angle, float x, float y, float z) { glRotatef(angle, x, y, z); }
-void rlScalef(float x, float y, float z) { glScalef(x, y, z); }
-void rlMultMatrixf(const float *matf) { glMultMatrixf(matf); }
+// NOTE: Threads recording a command list transform vertices on CPU with their own matrix stack
+void rlPushMatrix(void)
+{
+    if (rlIsRecordingCommandList())
+    {
+        if (rlRecorder->stackCounter >= RL_MAX_MATRIX_STACK_SIZE) TRACELOG(RL_LOG_ERROR, "RLGL: Matrix stack overflow (RL_MAX_MATRIX_STACK_SIZE)");
+        else rlRecorder->stack[rlRecorder->stackCounter++] = rlRecorder->transform;
+    }
+    else glPushMatrix();
+}
+
+void rlPopMatrix(void)
+{
+    if (rlIsRecordingCommandList())
+    {
+        if (rlRecorder->stackCounter > 0) rlRecorder->transform = rlRecorder->stack[--rlRecorder->stackCounter];
+    }
+    else glPopMatrix();
+}
+
+void rlLoadIdentity(void) { if (rlIsRecordingCommandList()) rlRecorder->transform = rlMatrixIdentity(); else glLoadIdentity(); }
+void rlTranslatef(float x, float y, float z) { if (rlIsRecordingCommandList()) rlCommandListTransform(rlMatrixTranslate(x, y, z)); else glTranslatef(x, y, z); }
+void rlRotatef(float angle, float x, float y, float z) { if (rlIsRecordingCommandList()) rlCommandListTransform(rlMatrixRotate(angle, x, y, z)); else glRotatef(angle, x, y, z); }
+void rlScalef(float x, float y, float z) { if (rlIsRecordingCommandList()) rlCommandListTransform(rlMatrixScale(x, y, z)); else glScalef(x, y, z); }
+
+void rlMultMatrixf(const float *matf)
+{
+    if (rlIsRecordingCommandList())
+    {
+        Matrix mat = { matf[0], matf[4], matf[8], matf[12],
+                       matf[1], matf[5], matf[9], matf[13],
+                       matf[2], matf[6], matf[10], matf[14],
+                       matf[3], matf[7], matf[11], matf[15] };
+
+        rlRecorder->transform = rlMatrixMultiply(rlRecorder->transform, mat);
+        rlRecorder->transformRequired = true;
+    }
+    else glMultMatrixf(matf);
+}
 #endif
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 // Choose the current matrix to be transformed
@@ -1123,8 +1471,16 @@ void rlMatrixMode(int mode)
 }
 
 // Push the current matrix into RLGL.State.stack
+// NOTE: Threads recording a command list use their own matrix stack
 void rlPushMatrix(void)
 {
+    if (rlIsRecordingCommandList())
+    {
+        if (rlRecorder->stackCounter >= RL_MAX_MATRIX_STACK_SIZE) TRACELOG(RL_LOG_ERROR, "RLGL: Matrix stack overflow (RL_MAX_MATRIX_STACK_SIZE)");
+        else rlRecorder->stack[rlRecorder->stackCounter++] = rlRecorder->transform;
+        return;
+    }
+
     if (RLGL.State.stackCounter >= RL_MAX_MATRIX_STACK_SIZE) TRACELOG(RL_LOG_ERROR, "RLGL: Matrix stack overflow (RL_MAX_MATRIX_STACK_SIZE)");
 
     if (RLGL.State.currentMatrixMode == RL_MODELVIEW)
@@ -1140,6 +1496,12 @@ void rlPushMatrix(void)
 // Pop lattest inserted matrix from RLGL.State.stack
 void rlPopMatrix(void)
 {
+    if (rlIsRecordingCommandList())
+    {
+        if (rlRecorder->stackCounter > 0) rlRecorder->transform = rlRecorder->stack[--rlRecorder->stackCounter];
+        return;
+    }
+
     if (RLGL.State.stackCounter > 0)
     {
         Matrix mat = RLGL.State.stack[RLGL.State.stackCounter - 1];
@@ -1157,80 +1519,39 @@ void rlPopMatrix(void)
 // Reset current matrix to identity matrix
 void rlLoadIdentity(void)
 {
-    *RLGL.State.currentMatrix = rlMatrixIdentity();
+    if (rlIsRecordingCommandList()) rlRecorder->transform = rlMatrixIdentity();
+    else *RLGL.State.currentMatrix = rlMatrixIdentity();
 }
 
 // Multiply the current matrix by a translation matrix
 void rlTranslatef(float x, float y, float z)
 {
-    Matrix matTranslation = {
-        1.0f, 0.0f, 0.0f, x,
-        0.0f, 1.0f, 0.0f, y,
-        0.0f, 0.0f, 1.0f, z,
-        0.0f, 0.0f, 0.0f, 1.0f
-    };
+    Matrix matTranslation = rlMatrixTranslate(x, y, z);
 
+    if (rlIsRecordingCommandList()) rlCommandListTransform(matTranslation);
     // NOTE: We transpose matrix with multiplication order
-    *RLGL.State.currentMatrix = rlMatrixMultiply(matTranslation, *RLGL.State.currentMatrix);
+    else *RLGL.State.currentMatrix = rlMatrixMultiply(matTranslation, *RLGL.State.currentMatrix);
 }
 
 // Multiply the current matrix by a rotation matrix
 // NOTE: The provided angle must be in degrees
 void rlRotatef(float angle, float x, float y, float z)
 {
-    Matrix matRotation = rlMatrixIdentity();
-
-    // Axis vector (x, y, z) normalization
-    float lengthSquared = x*x + y*y + z*z;
-    if ((lengthSquared != 1.0f) && (lengthSquared != 0.0f))
-    {
-        float inverseLength = 1.0f/sqrtf(lengthSquared);
-        x *= inverseLength;
-        y *= inverseLength;
-        z *= inverseLength;
-    }
-
-    // Rotation matrix generation
-    float sinres = sinf(DEG2RAD*angle);
-    float cosres = cosf(DEG2RAD*angle);
-    float t = 1.0f - cosres;
-
-    matRotation.m0 = x*x*t + cosres;
-    matRotation.m1 = y*x*t + z*sinres;
-    matRotation.m2 = z*x*t - y*sinres;
-    matRotation.m3 = 0.0f;
-
-    matRotation.m4 = x*y*t - z*sinres;
-    matRotation.m5 = y*y*t + cosres;
-    matRotation.m6 = z*y*t + x*sinres;
-    matRotation.m7 = 0.0f;
-
-    matRotation.m8 = x*z*t + y*sinres;
-    matRotation.m9 = y*z*t - x*sinres;
-    matRotation.m10 = z*z*t + cosres;
-    matRotation.m11 = 0.0f;
-
-    matRotation.m12 = 0.0f;
-    matRotation.m13 = 0.0f;
-    matRotation.m14 = 0.0f;
-    matRotation.m15 = 1.0f;
+    Matrix matRotation = rlMatrixRotate(angle, x, y, z);
 
+    if (rlIsRecordingCommandList()) rlCommandListTransform(matRotation);
     // NOTE: We transpose matrix with multiplication order
-    *RLGL.State.currentMatrix = rlMatrixMultiply(matRotation, *RLGL.State.currentMatrix);
+    else *RLGL.State.currentMatrix = rlMatrixMultiply(matRotation, *RLGL.State.currentMatrix);
 }
 
 // Multiply the current matrix by a scaling matrix
 void rlScalef(float x, float y, float z)
 {
-    Matrix matScale = {
-        x, 0.0f, 0.0f, 0.0f,
-        0.0f, y, 0.0f, 0.0f,
-        0.0f, 0.0f, z, 0.0f,
-        0.0f, 0.0f, 0.0f, 1.0f
-    };
+    Matrix matScale = rlMatrixScale(x, y, z);
 
+    if (rlIsRecordingCommandList()) rlCommandListTransform(matScale);
     // NOTE: We transpose matrix with multiplication order
-    *RLGL.State.currentMatrix = rlMatrixMultiply(matScale, *RLGL.State.currentMatrix);
+    else *RLGL.State.currentMatrix = rlMatrixMultiply(matScale, *RLGL.State.currentMatrix);
 }
 
 // Multiply the current matrix by another matrix
@@ -1242,7 +1563,12 @@ void rlMultMatrixf(const float *matf)
                    matf[2], matf[6], matf[10], matf[14],
                    matf[3], matf[7], matf[11], matf[15] };
 
-    *RLGL.State.currentMatrix = rlMatrixMultiply(*RLGL.State.currentMatrix, mat);
+    if (rlIsRecordingCommandList())
+    {
+        rlRecorder->transform = rlMatrixMultiply(rlRecorder->transform, mat);
+        rlRecorder->transformRequired = true;
+    }
+    else *RLGL.State.currentMatrix = rlMatrixMultiply(*RLGL.State.currentMatrix, mat);
 }
 
 // Multiply the current matrix by a perspective matrix generated by parameters
@@ -1324,6 +1650,12 @@ void rlViewport(int x, int y, int width, int height)
 //---------------------------------------
 void rlBegin(int mode)
 {
+    if (rlRecorder != NULL)
+    {
+        rlDeferredBegin(rlRecorder, mode);
+        return;
+    }
+
     switch (mode)
     {
         case RL_LINES: glBegin(GL_LINES); break;
@@ -1333,20 +1665,57 @@ void rlBegin(int mode)
     }
 }
 
-void rlEnd() { glEnd(); }
-void rlVertex2i(int x, int y) { glVertex2i(x, y); }
-void rlVertex2f(float x, float y) { glVertex2f(x, y); }
-void rlVertex3f(float x, float y, float z) { glVertex3f(x, y, z); }
-void rlTexCoord2f(float x, float y) { glTexCoord2f(x, y); }
-void rlNormal3f(float x, float y, float z) { glNormal3f(x, y, z); }
-void rlColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a) { glColor4ub(r, g, b, a); }
-void rlColor3f(float x, float y, float z) { glColor3f(x, y, z); }
-void rlColor4f(float x, float y, float z, float w) { glColor4f(x, y, z, w); }
+void rlEnd() { if (rlRecorder != NULL) rlDeferredEnd(rlRecorder); else { glEnd(); rlStats.current.drawCalls++; } }
+void rlVertex2i(int x, int y) { if (rlRecorder != NULL) rlDeferredAddVertex(rlRecorder, (float)x, (float)y, 0.0f); else { glVertex2i(x, y); rlStats.current.vertexCount++; } }
+void rlVertex2f(float x, float y) { if (rlRecorder != NULL) rlDeferredAddVertex(rlRecorder, x, y, 0.0f); else { glVertex2f(x, y); rlStats.current.vertexCount++; } }
+void rlVertex3f(float x, float y, float z) { if (rlRecorder != NULL) rlDeferredAddVertex(rlRecorder, x, y, z); else { glVertex3f(x, y, z); rlStats.current.vertexCount++; } }
+void rlNormal3f(float x, float y, float z) { if (rlRecorder == NULL) glNormal3f(x, y, z); }
+
+// NOTE: Vertex attributes are tracked while recording, OpenGL 1.1 keeps them as internal state
+void rlTexCoord2f(float x, float y)
+{
+    if (rlRecorder != NULL)
+    {
+        rlRecorder->texcoordx = x;
+        rlRecorder->texcoordy = y;
+    }
+    else glTexCoord2f(x, y);
+}
+
+void rlColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a)
+{
+    if (rlRecorder != NULL)
+    {
+        rlRecorder->colorr = r;
+        rlRecorder->colorg = g;
+        rlRecorder->colorb = b;
+        rlRecorder->colora = a;
+    }
+    else glColor4ub(r, g, b, a);
+}
+
+void rlColor3f(float x, float y, float z)
+{
+    if (rlRecorder != NULL) rlColor4ub((unsigned char)(x*255), (unsigned char)(y*255), (unsigned char)(z*255), 255);
+    else glColor3f(x, y, z);
+}
+
+void rlColor4f(float x, float y, float z, float w)
+{
+    if (rlRecorder != NULL) rlColor4ub((unsigned char)(x*255), (unsigned char)(y*255), (unsigned char)(z*255), (unsigned char)(w*255));
+    else glColor4f(x, y, z, w);
+}
 #endif
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 // Initialize drawing mode (how to organize vertex)
 void rlBegin(int mode)
 {
+    if (rlRecorder != NULL)
+    {
+        rlDeferredBegin(rlRecorder, mode);
+        return;
+    }
+
     // Draw mode can be RL_LINES, RL_TRIANGLES and RL_QUADS
     // NOTE: In all three cases, vertex are accumulated over default internal vertex buffer
     if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode != mode)
@@ -1374,12 +1743,42 @@ void rlBegin(int mode)
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = mode;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = RLGL.State.defaultTextureId;
+#if defined(RLGL_MULTI_TEXTURE_BATCH)
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureIds[0] = RLGL.State.defaultTextureId;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureCount = 1;
+        RLGL.State.textureIndex = 0;
+
+        // Texture set before rlBegin() was registered in the previous draw, register it in the new one
+        // NOTE: rlSetTexture() followed by rlBegin() with another mode is how DrawTexturePro() and DrawTextEx() draw
+        if ((RLGL.State.textureId != 0) && (RLGL.State.textureId != RLGL.State.defaultTextureId))
+        {
+            rlDrawCall *draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+
+            if (RLGL.State.currentShaderId == RLGL.State.defaultShaderId)
+            {
+                draw->textureIds[1] = RLGL.State.textureId;
+                draw->textureCount = 2;
+                RLGL.State.textureIndex = 1;
+            }
+            else
+            {
+                draw->textureId = RLGL.State.textureId;
+                draw->textureIds[0] = RLGL.State.textureId;
+            }
+        }
+#endif
     }
 }
 
 // Finish vertex providing
 void rlEnd(void)
 {
+    if (rlRecorder != NULL)
+    {
+        rlDeferredEnd(rlRecorder);
+        return;
+    }
+
     // NOTE: Depth increment is dependant on rlOrtho(): z-near and z-far values,
     // as well as depth buffer bit-depth (16bit or 24bit or 32bit)
     // Correct increment formula would be: depthInc = (zfar - znear)/pow(2, bits)
@@ -1390,6 +1789,12 @@ void rlEnd(void)
 // NOTE: Vertex position data is the basic information required for drawing
 void rlVertex3f(float x, float y, float z)
 {
+    if (rlRecorder != NULL)
+    {
+        rlDeferredAddVertex(rlRecorder, x, y, z);
+        return;
+    }
+
     float tx = x;
     float ty = y;
     float tz = z;
@@ -1427,6 +1832,23 @@ void rlVertex3f(float x, float y, float z)
         }
     }
 
+#if defined(RLGL_INTERLEAVED_BATCH)
+    // Add vertex with current texcoord and color, written as one contiguous 24 bytes record
+    // NOTE: Data can live in write-combined mapped GPU memory, it must only be written, never read back
+    rlBatchVertex *vertex = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].data[RLGL.State.vertexCounter];
+    vertex->x = tx;
+    vertex->y = ty;
+    vertex->z = tz;
+    vertex->u = RLGL.State.texcoordx;
+    vertex->v = RLGL.State.texcoordy;
+    vertex->r = RLGL.State.colorr;
+    vertex->g = RLGL.State.colorg;
+    vertex->b = RLGL.State.colorb;
+    vertex->a = RLGL.State.colora;
+#if defined(RLGL_MULTI_TEXTURE_BATCH)
+    vertex->texIndex = RLGL.State.textureIndex;
+#endif
+#else
     // Add vertices
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter] = tx;
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter + 1] = ty;
@@ -1443,6 +1865,7 @@ void rlVertex3f(float x, float y, float z)
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 1] = RLGL.State.colorg;
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 2] = RLGL.State.colorb;
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 3] = RLGL.State.colora;
+#endif
 
     RLGL.State.vertexCounter++;
     RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount++;
@@ -1451,19 +1874,26 @@ void rlVertex3f(float x, float y, float z)
 // Define one vertex (position)
 void rlVertex2f(float x, float y)
 {
-    rlVertex3f(x, y, RLGL.currentBatch->currentDepth);
+    rlVertex3f(x, y, (rlRecorder != NULL)? rlRecorder->depth : RLGL.currentBatch->currentDepth);
 }
 
 // Define one vertex (position)
 void rlVertex2i(int x, int y)
 {
-    rlVertex3f((float)x, (float)y, RLGL.currentBatch->currentDepth);
+    rlVertex3f((float)x, (float)y, (rlRecorder != NULL)? rlRecorder->depth : RLGL.currentBatch->currentDepth);
 }
 
 // Define one vertex (texture coordinate)
 // NOTE: Texture coordinates are limited to QUADS only
 void rlTexCoord2f(float x, float y)
 {
+    if (rlRecorder != NULL)
+    {
+        rlRecorder->texcoordx = x;
+        rlRecorder->texcoordy = y;
+        return;
+    }
+
     RLGL.State.texcoordx = x;
     RLGL.State.texcoordy = y;
 }
@@ -1472,6 +1902,8 @@ void rlTexCoord2f(float x, float y)
 // NOTE: Normals limited to TRIANGLES only?
 void rlNormal3f(float x, float y, float z)
 {
+    if (rlRecorder != NULL) return;     // Render batch does not store normals
+
     RLGL.State.normalx = x;
     RLGL.State.normaly = y;
     RLGL.State.normalz = z;
@@ -1480,6 +1912,15 @@ void rlNormal3f(float x, float y, float z)
 // Define one vertex (color)
 void rlColor4ub(unsigned char x, unsigned char y, unsigned char z, unsigned char w)
 {
+    if (rlRecorder != NULL)
+    {
+        rlRecorder->colorr = x;
+        rlRecorder->colorg = y;
+        rlRecorder->colorb = z;
+        rlRecorder->colora = w;
+        return;
+    }
+
     RLGL.State.colorr = x;
     RLGL.State.colorg = y;
     RLGL.State.colorb = z;
@@ -1507,11 +1948,24 @@ void rlColor3f(float x, float y, float z)
 // Set current texture to use
 void rlSetTexture(unsigned int id)
 {
+    if (rlRecorder != NULL)
+    {
+        rlDeferredSetTexture(rlRecorder, id);
+        return;
+    }
+
+#if defined(RLGL_MULTI_TEXTURE_BATCH) && !defined(GRAPHICS_API_OPENGL_11)
+    RLGL.State.textureId = id;
+#endif
+
     if (id == 0)
     {
 #if defined(GRAPHICS_API_OPENGL_11)
         rlDisableTexture();
 #else
+#if defined(RLGL_MULTI_TEXTURE_BATCH)
+        RLGL.State.textureIndex = 0;    // Slot 0 is the default texture of the draw
+#endif
         // NOTE: If quads batch limit is reached, we force a draw call and next batch starts
         if (RLGL.State.vertexCounter >=
             RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4)
@@ -1525,6 +1979,30 @@ void rlSetTexture(unsigned int id)
 #if defined(GRAPHICS_API_OPENGL_11)
         rlEnableTexture(id);
 #else
+#if defined(RLGL_MULTI_TEXTURE_BATCH)
+        // Default shader selects the texture per vertex, a new texture only requires a free slot
+        // in current draw call, new draw calls are only registered when all slots are used
+        // NOTE: Custom shaders keep sampling texture0, they get one texture per draw call
+        rlDrawCall *draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+
+        if (RLGL.State.currentShaderId == RLGL.State.defaultShaderId)
+        {
+            int index = 0;
+            while ((index < draw->textureCount) && (draw->textureIds[index] != id)) index++;
+
+            if ((index == draw->textureCount) && (draw->textureCount < RL_DEFAULT_BATCH_TEXTURES))
+            {
+                draw->textureIds[index] = id;
+                draw->textureCount++;
+            }
+
+            if (index < draw->textureCount)
+            {
+                RLGL.State.textureIndex = (unsigned char)index;
+                return;
+            }
+        }
+#endif
         if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId != id)
         {
             if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount > 0)
@@ -1550,6 +2028,11 @@ void rlSetTexture(unsigned int id)
 
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = id;
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
+#if defined(RLGL_MULTI_TEXTURE_BATCH)
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureIds[0] = id;
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureCount = 1;
+            RLGL.State.textureIndex = 0;
+#endif
         }
 #endif
     }
@@ -1570,6 +2053,7 @@ void rlEnableTexture(unsigned int id)
     glEnable(GL_TEXTURE_2D);
 #endif
     glBindTexture(GL_TEXTURE_2D, id);
+    rlStats.current.textureBinds++;
 }
 
 // Disable texture
@@ -1694,6 +2178,10 @@ void rlEnableShader(unsigned int id)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
     glUseProgram(id);
+
+    // NOTE: Only place switches are counted, render batch and sprites enable their programs through here
+    if (id != rlStats.shaderId) rlStats.current.shaderSwitches++;
+    rlStats.shaderId = id;
 #endif
 }
 
@@ -1951,6 +2439,13 @@ void rlCheckErrors()
 void rlSetBlendMode(int mode)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (rlRecorder != NULL)
+    {
+        // Blend mode is a sort key of recorded commands, it is set on replay
+        rlRecorder->blendMode = mode;
+        return;
+    }
+
     if ((RLGL.State.currentBlendMode != mode) || ((mode == RL_BLEND_CUSTOM || mode == RL_BLEND_CUSTOM_SEPARATE) && RLGL.State.glCustomBlendModeModified))
     {
         rlDrawRenderBatch(RLGL.currentBatch);
@@ -2182,12 +2677,29 @@ void rlglClose(void)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     rlUnloadRenderBatch(RLGL.defaultBatch);
+    rlUnloadSpriteRenderer();
 
     rlUnloadShaderDefault();          // Unload default shader
 
     glDeleteTextures(1, &RLGL.State.defaultTextureId); // Unload default texture
     TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Default texture unloaded successfully", RLGL.State.defaultTextureId);
 #endif
+
+#if defined(GRAPHICS_API_OPENGL_33)     // Also defined for GRAPHICS_API_OPENGL_21
+    // Unload GPU timer queries
+    if (rlStats.gpuFrames[0].queries[0] != 0)
+    {
+        for (int i = 0; i < RL_GPU_TIMER_FRAMES; i++) glDeleteQueries(2 + 2*RL_MAX_GPU_TIMER_SCOPES, rlStats.gpuFrames[i].queries);
+    }
+#endif
+    memset(&rlStats, 0, sizeof(rlStats));
+
+    // Unload deferred drawing buffers
+    RL_FREE(rlDeferred.commands);
+    RL_FREE(rlDeferred.vertices);
+    RL_FREE(rlDeferred.matrices);
+    memset(&rlDeferred, 0, sizeof(rlDeferred));
+    rlRecorder = NULL;
 }
 
 // Load OpenGL extensions
@@ -2241,6 +2753,15 @@ void rlLoadExtensions(void *loader)
     RLGL.ExtSupported.texCompASTC = GLAD_GL_KHR_texture_compression_astc_hdr && GLAD_GL_KHR_texture_compression_astc_ldr;
     RLGL.ExtSupported.texCompDXT = GLAD_GL_EXT_texture_compression_s3tc;  // Texture compression: DXT
     RLGL.ExtSupported.texCompETC2 = GLAD_GL_ARB_ES3_compatibility;        // Texture compression: ETC2/EAC
+    #if !defined(GRAPHICS_API_OPENGL_21)
+    RLGL.ExtSupported.bufferStorage = GLAD_GL_ARB_buffer_storage && (glBufferStorage != NULL);   // Core on OpenGL 4.4
+    #endif
+    RLGL.ExtSupported.timerQuery = (glQueryCounter != NULL) && (glGetQueryObjectui64v != NULL);  // Core on OpenGL 3.3
+
+    // NOTE: Drivers can support the extension with no binary formats, that disables binaries as well
+    GLint binaryFormats = 0;
+    if (GLAD_GL_ARB_get_program_binary && (glGetProgramBinary != NULL) && (glProgramBinary != NULL)) glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binaryFormats);
+    RLGL.ExtSupported.programBinary = (binaryFormats > 0);  // Core on OpenGL 4.1
     #if defined(GRAPHICS_API_OPENGL_43)
     RLGL.ExtSupported.computeShader = GLAD_GL_ARB_compute_shader;
     RLGL.ExtSupported.ssbo = GLAD_GL_ARB_shader_storage_buffer_object;
@@ -2454,6 +2975,7 @@ void rlLoadExtensions(void *loader)
     if (RLGL.ExtSupported.texCompASTC) TRACELOG(RL_LOG_INFO, "GL: ASTC compressed textures supported");
     if (RLGL.ExtSupported.computeShader) TRACELOG(RL_LOG_INFO, "GL: Compute shaders supported");
     if (RLGL.ExtSupported.ssbo) TRACELOG(RL_LOG_INFO, "GL: Shader storage buffer objects supported");
+    if (RLGL.ExtSupported.programBinary) TRACELOG(RL_LOG_INFO, "GL: Shader program binaries supported");
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
 
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
@@ -2565,9 +3087,16 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
     {
         batch.vertexBuffer[i].elementCount = bufferElements;
 
+#if defined(RLGL_INTERLEAVED_BATCH)
+        // NOTE: Vertex data is allocated on GPU upload, it could be directly mapped GPU memory
+        batch.vertexBuffer[i].data = NULL;
+        batch.vertexBuffer[i].persistent = false;
+        batch.vertexBuffer[i].fence = NULL;
+#else
         batch.vertexBuffer[i].vertices = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
         batch.vertexBuffer[i].texcoords = (float *)RL_MALLOC(bufferElements*2*4*sizeof(float));       // 2 float by texcoord, 4 texcoord by quad
         batch.vertexBuffer[i].colors = (unsigned char *)RL_MALLOC(bufferElements*4*4*sizeof(unsigned char));   // 4 float by color, 4 colors by quad
+#endif
 #if defined(GRAPHICS_API_OPENGL_33)
         batch.vertexBuffer[i].indices = (unsigned int *)RL_MALLOC(bufferElements*6*sizeof(unsigned int));      // 6 int by quad (indices)
 #endif
@@ -2575,9 +3104,11 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         batch.vertexBuffer[i].indices = (unsigned short *)RL_MALLOC(bufferElements*6*sizeof(unsigned short));  // 6 int by quad (indices)
 #endif
 
+#if !defined(RLGL_INTERLEAVED_BATCH)
         for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].vertices[j] = 0.0f;
         for (int j = 0; j < (2*4*bufferElements); j++) batch.vertexBuffer[i].texcoords[j] = 0.0f;
         for (int j = 0; j < (4*4*bufferElements); j++) batch.vertexBuffer[i].colors[j] = 0;
+#endif
 
         int k = 0;
 
@@ -2611,6 +3142,54 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
             glBindVertexArray(batch.vertexBuffer[i].vaoId);
         }
 
+#if defined(RLGL_INTERLEAVED_BATCH)
+        // Quads - Interleaved vertex buffer: position (shader-location = 0), texcoord (shader-location = 1), color (shader-location = 3)
+        int dataSize = bufferElements*4*sizeof(rlBatchVertex);
+
+        glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
+        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+#if defined(GRAPHICS_API_OPENGL_33)
+        if (RLGL.ExtSupported.bufferStorage)
+        {
+            // Immutable storage mapped once for the batch lifetime, rlVertex3f() writes directly into it
+            // NOTE: Coherent mapping makes CPU writes visible to GPU without explicit flushes,
+            // access synchronization is done with a fence per buffer on rlDrawRenderBatch()
+            GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+            glBufferStorage(GL_ARRAY_BUFFER, dataSize, NULL, flags);
+            batch.vertexBuffer[i].data = (rlBatchVertex *)glMapBufferRange(GL_ARRAY_BUFFER, 0, dataSize, flags);
+
+            if (batch.vertexBuffer[i].data != NULL) batch.vertexBuffer[i].persistent = true;
+            else
+            {
+                // Immutable storage can not be reallocated, get a new buffer for the fallback path
+                TRACELOG(RL_LOG_WARNING, "RLGL: Failed to map render batch buffer persistently, using regular uploads");
+                glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[0]);
+                glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
+                glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+            }
+        }
+#endif
+        if (!batch.vertexBuffer[i].persistent)
+        {
+            batch.vertexBuffer[i].data = (rlBatchVertex *)RL_CALLOC(bufferElements*4, sizeof(rlBatchVertex));
+            glBufferData(GL_ARRAY_BUFFER, dataSize, batch.vertexBuffer[i].data, GL_DYNAMIC_DRAW);
+        }
+
+        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)0);
+        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)(3*sizeof(float)));
+        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(rlBatchVertex), (void *)(5*sizeof(float)));
+#if defined(RLGL_MULTI_TEXTURE_BATCH)
+        // Vertex texture index (shader-location = 6), not normalized, read as float by the shader
+        glEnableVertexAttribArray(6);
+        glVertexAttribPointer(6, 1, GL_UNSIGNED_BYTE, GL_FALSE, sizeof(rlBatchVertex), (void *)(5*sizeof(float) + 4));
+#endif
+
+        batch.vertexBuffer[i].vboId[1] = 0;
+        batch.vertexBuffer[i].vboId[2] = 0;
+#else
         // Quads - Vertex buffers binding and attributes enable
         // Vertex position buffer (shader-location = 0)
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
@@ -2632,6 +3211,7 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         glBufferData(GL_ARRAY_BUFFER, bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, GL_DYNAMIC_DRAW);
         glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
         glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+#endif
 
         // Fill index buffer
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[3]);
@@ -2645,6 +3225,10 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
     }
 
     TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU)");
+#if defined(RLGL_INTERLEAVED_BATCH)
+    if ((numBuffers > 0) && batch.vertexBuffer[0].persistent) TRACELOG(RL_LOG_INFO, "RLGL: Render batch uses %i interleaved buffers, persistently mapped", numBuffers);
+    else TRACELOG(RL_LOG_INFO, "RLGL: Render batch uses %i interleaved buffers", numBuffers);
+#endif
 
     // Unbind the current VAO
     if (RLGL.ExtSupported.vao) glBindVertexArray(0);
@@ -2662,6 +3246,10 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         //batch.draws[i].vaoId = 0;
         //batch.draws[i].shaderId = 0;
         batch.draws[i].textureId = RLGL.State.defaultTextureId;
+#if defined(RLGL_MULTI_TEXTURE_BATCH)
+        batch.draws[i].textureIds[0] = RLGL.State.defaultTextureId;
+        batch.draws[i].textureCount = 1;
+#endif
         //batch.draws[i].RLGL.State.projection = rlMatrixIdentity();
         //batch.draws[i].RLGL.State.modelview = rlMatrixIdentity();
     }
@@ -2697,19 +3285,34 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
             glBindVertexArray(0);
         }
 
+#if defined(RLGL_INTERLEAVED_BATCH)
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+        // Delete pending fence, buffer deletion is deferred by the driver while GPU still uses it
+        if (batch.vertexBuffer[i].fence != NULL) glDeleteSync((GLsync)batch.vertexBuffer[i].fence);
+#endif
+        // Delete VBOs from GPU (VRAM)
+        // NOTE: Persistently mapped buffers are implicitly unmapped on deletion
+        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[0]);
+        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[3]);
+#else
         // Delete VBOs from GPU (VRAM)
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[0]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[1]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[2]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[3]);
+#endif
 
         // Delete VAOs from GPU (VRAM)
         if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
 
         // Free vertex arrays memory from CPU (RAM)
+#if defined(RLGL_INTERLEAVED_BATCH)
+        if (!batch.vertexBuffer[i].persistent) RL_FREE(batch.vertexBuffer[i].data);
+#else
         RL_FREE(batch.vertexBuffer[i].vertices);
         RL_FREE(batch.vertexBuffer[i].texcoords);
         RL_FREE(batch.vertexBuffer[i].colors);
+#endif
         RL_FREE(batch.vertexBuffer[i].indices);
     }
 
@@ -2723,6 +3326,9 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
 // NOTE: We require a pointer to reset batch and increase current buffer (multi-buffer)
 void rlDrawRenderBatch(rlRenderBatch *batch)
 {
+    // Recorded draw commands go into the batch before it is drawn
+    if ((rlRecorder == &rlDeferred) && (rlDeferred.commandCount > 0)) rlDeferredReplay();
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     // Update batch vertex buffers
     //------------------------------------------------------------------------------------------------------------
@@ -2730,9 +3336,32 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     // TODO: If no data changed on the CPU arrays --> No need to re-update GPU arrays (use a change detector flag?)
     if (RLGL.State.vertexCounter > 0)
     {
+        rlStats.current.batchFlushes++;
+
         // Activate elements VAO
         if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
 
+#if defined(RLGL_INTERLEAVED_BATCH)
+        // Interleaved vertex buffer, all attributes updated with a single upload
+        // NOTE: Persistently mapped buffers were already written in place by rlVertex3f()
+        if (!batch->vertexBuffer[batch->currentBuffer].persistent)
+        {
+            int dataSize = RLGL.State.vertexCounter*sizeof(rlBatchVertex);
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+            // Unsynchronized mapping skips the driver implicit sync, buffer fence already guarantees GPU is not reading it
+            void *mapped = glMapBufferRange(GL_ARRAY_BUFFER, 0, dataSize, GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+            if (mapped != NULL)
+            {
+                memcpy(mapped, batch->vertexBuffer[batch->currentBuffer].data, dataSize);
+                glUnmapBuffer(GL_ARRAY_BUFFER);
+            }
+            else glBufferSubData(GL_ARRAY_BUFFER, 0, dataSize, batch->vertexBuffer[batch->currentBuffer].data);
+#else
+            glBufferSubData(GL_ARRAY_BUFFER, 0, dataSize, batch->vertexBuffer[batch->currentBuffer].data);
+#endif
+        }
+#else
         // Vertex positions buffer
         glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
         glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].vertices);
@@ -2747,6 +3376,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
         glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*4*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].colors);
         //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
+#endif
 
         // NOTE: glMapBuffer() causes sync issue.
         // If GPU is working with this buffer, glMapBuffer() will wait(stall) until GPU to finish its job.
@@ -2793,7 +3423,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         if (RLGL.State.vertexCounter > 0)
         {
             // Set current shader and upload current MVP matrix
-            glUseProgram(RLGL.State.currentShaderId);
+            rlEnableShader(RLGL.State.currentShaderId);
 
             // Create modelview-projection matrix and upload to shader
             Matrix matMVP = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
@@ -2808,6 +3438,20 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
             else
             {
+#if defined(RLGL_INTERLEAVED_BATCH)
+                // Bind vertex attribs from the interleaved buffer: position, texcoord, color
+                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)0);
+                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)(3*sizeof(float)));
+                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(rlBatchVertex), (void *)(5*sizeof(float)));
+                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+    #if defined(RLGL_MULTI_TEXTURE_BATCH)
+                glVertexAttribPointer(6, 1, GL_UNSIGNED_BYTE, GL_FALSE, sizeof(rlBatchVertex), (void *)(5*sizeof(float) + 4));
+                glEnableVertexAttribArray(6);
+    #endif
+#else
                 // Bind vertex attrib: position (shader-location = 0)
                 glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
                 glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
@@ -2822,6 +3466,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
                 glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
                 glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
                 glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+#endif
 
                 glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
             }
@@ -2838,17 +3483,34 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
                 {
                     glActiveTexture(GL_TEXTURE0 + 1 + i);
                     glBindTexture(GL_TEXTURE_2D, RLGL.State.activeTextureId[i]);
+                    rlStats.current.textureBinds++;
                 }
             }
 
             // Activate default sampler2D texture0 (one texture is always active for default batch shader)
             // NOTE: Batch system accumulates calls by texture0 changes, additional textures are enabled for all the draw calls
             glActiveTexture(GL_TEXTURE0);
+#if defined(RLGL_MULTI_TEXTURE_BATCH)
+            int usedTextureUnits = 1;
+#endif
 
             for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
             {
+#if defined(RLGL_MULTI_TEXTURE_BATCH)
+                // Bind current draw call textures to consecutive units, selected per vertex in default shader
+                // NOTE: Texture unit 0 is left active, as expected by following draws
+                for (int t = batch->draws[i].textureCount - 1; t >= 0; t--)
+                {
+                    glActiveTexture(GL_TEXTURE0 + t);
+                    glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureIds[t]);
+                }
+                if (batch->draws[i].textureCount > usedTextureUnits) usedTextureUnits = batch->draws[i].textureCount;
+                rlStats.current.textureBinds += batch->draws[i].textureCount;
+#else
                 // Bind current draw call texture, activated as GL_TEXTURE0 and Bound to sampler2D texture0 by default
                 glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
+                rlStats.current.textureBinds++;
+#endif
 
                 if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
                 else
@@ -2865,6 +3527,9 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
                 }
 
                 vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
+
+                rlStats.current.drawCalls++;
+                rlStats.current.vertexCount += batch->draws[i].vertexCount;
             }
 
             if (!RLGL.ExtSupported.vao)
@@ -2873,6 +3538,14 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
                 glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
             }
 
+#if defined(RLGL_MULTI_TEXTURE_BATCH)
+            for (int t = usedTextureUnits - 1; t > 0; t--)
+            {
+                glActiveTexture(GL_TEXTURE0 + t);
+                glBindTexture(GL_TEXTURE_2D, 0);
+            }
+            glActiveTexture(GL_TEXTURE0);
+#endif
             glBindTexture(GL_TEXTURE_2D, 0);    // Unbind textures
         }
 
@@ -2883,6 +3556,14 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
 
     // Restore viewport to default measures
     if (eyeCount == 2) rlViewport(0, 0, RLGL.State.framebufferWidth, RLGL.State.framebufferHeight);
+
+#if defined(RLGL_INTERLEAVED_BATCH) && defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    // Fence the submitted buffer, it can not be written again until GPU finished reading it
+    if (RLGL.State.vertexCounter > 0)
+    {
+        batch->vertexBuffer[batch->currentBuffer].fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+#endif
     //------------------------------------------------------------------------------------------------------------
 
     // Reset batch buffers
@@ -2903,7 +3584,14 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         batch->draws[i].mode = RL_QUADS;
         batch->draws[i].vertexCount = 0;
         batch->draws[i].textureId = RLGL.State.defaultTextureId;
+#if defined(RLGL_MULTI_TEXTURE_BATCH)
+        batch->draws[i].textureIds[0] = RLGL.State.defaultTextureId;
+        batch->draws[i].textureCount = 1;
+#endif
     }
+#if defined(RLGL_MULTI_TEXTURE_BATCH)
+    RLGL.State.textureIndex = 0;
+#endif
 
     // Reset active texture units for next batch
     for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++) RLGL.State.activeTextureId[i] = 0;
@@ -2915,6 +3603,23 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     // Change to next buffer in the list (in case of multi-buffering)
     batch->currentBuffer++;
     if (batch->currentBuffer >= batch->bufferCount) batch->currentBuffer = 0;
+
+#if defined(RLGL_INTERLEAVED_BATCH) && defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    // Wait for GPU to release the next buffer in the ring before rlVertex3f() writes into it
+    // NOTE: With enough buffers the fence is already signaled and this does not block
+    rlVertexBuffer *nextBuffer = &batch->vertexBuffer[batch->currentBuffer];
+
+    if (nextBuffer->fence != NULL)
+    {
+        GLenum waitResult = glClientWaitSync((GLsync)nextBuffer->fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);   // Timeout in nanoseconds
+
+        while (waitResult == GL_TIMEOUT_EXPIRED) waitResult = glClientWaitSync((GLsync)nextBuffer->fence, 0, 1000000);
+        if (waitResult == GL_WAIT_FAILED) TRACELOG(RL_LOG_WARNING, "RLGL: Failed to wait for render batch buffer fence");
+
+        glDeleteSync((GLsync)nextBuffer->fence);
+        nextBuffer->fence = NULL;
+    }
+#endif
 #endif
 }
 
@@ -2934,6 +3639,8 @@ void rlDrawRenderBatchActive(void)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     rlDrawRenderBatch(RLGL.currentBatch);    // NOTE: Stereo rendering is checked inside
+#else
+    if ((rlRecorder == &rlDeferred) && (rlDeferred.commandCount > 0)) rlDeferredReplay();
 #endif
 }
 
@@ -2952,32 +3659,1140 @@ bool rlCheckRenderBatchLimit(int vCount)
         // Store current primitive drawing mode and texture id
         int currentMode = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode;
         int currentTexture = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId;
+#if defined(RLGL_MULTI_TEXTURE_BATCH)
+        rlDrawCall currentDraw = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+        unsigned char currentTextureIndex = RLGL.State.textureIndex;
+#endif
 
         rlDrawRenderBatch(RLGL.currentBatch);    // NOTE: Stereo rendering is checked inside
 
         // Restore state of last batch so we can continue adding vertices
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = currentMode;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = currentTexture;
+#if defined(RLGL_MULTI_TEXTURE_BATCH)
+        for (int i = 0; i < currentDraw.textureCount; i++) RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureIds[i] = currentDraw.textureIds[i];
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureCount = currentDraw.textureCount;
+        RLGL.State.textureIndex = currentTextureIndex;
+#endif
     }
 #endif
 
     return overflow;
 }
 
-// Textures data management
+// Deferred drawing
 //-----------------------------------------------------------------------------------------
-// Convert image data to OpenGL texture (returns OpenGL valid Id)
-unsigned int rlLoadTexture(const void *data, int width, int height, int format, int mipmapCount)
+// Enable deferred drawing, following draw commands are recorded
+// NOTE: Recorded commands are replayed on next render batch draw (i.e. EndMode2D(), EndDrawing()),
+// state changes that require a batch draw (matrices, framebuffer, scissor) split the recording
+void rlEnableDeferredDraw(void)
 {
-    unsigned int id = 0;
+    if (rlDeferred.enabled) return;
 
-    glBindTexture(GL_TEXTURE_2D, 0);    // Free any old binding
+    rlDeferred.enabled = true;
+    rlDeferred.layer = 0;
+    memset(&rlDeferred.stats, 0, sizeof(rlDeferredStats));
 
-    // Check texture format support by OpenGL 1.1 (compressed textures not supported)
-#if defined(GRAPHICS_API_OPENGL_11)
-    if (format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB)
-    {
-        TRACELOG(RL_LOG_WARNING, "GL: OpenGL 1.1 does not support GPU compressed texture formats");
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlDeferred.shaderId = RLGL.State.currentShaderId;
+    rlDeferred.shaderLocs = RLGL.State.currentShaderLocs;
+    rlDeferred.blendMode = RLGL.State.currentBlendMode;
+    rlDeferred.textureId = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId;
+    rlDeferred.mode = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode;
+    rlDeferred.drawHasVertices = (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount > 0);
+    rlDeferred.texcoordx = RLGL.State.texcoordx;
+    rlDeferred.texcoordy = RLGL.State.texcoordy;
+    rlDeferred.colorr = RLGL.State.colorr;
+    rlDeferred.colorg = RLGL.State.colorg;
+    rlDeferred.colorb = RLGL.State.colorb;
+    rlDeferred.colora = RLGL.State.colora;
+    rlDeferred.depth = RLGL.currentBatch->currentDepth;
+#else
+    rlDeferred.textureId = 0;
+    rlDeferred.mode = RL_QUADS;
+    rlDeferred.texcoordx = 0.0f;
+    rlDeferred.texcoordy = 0.0f;
+    rlDeferred.colorr = 255;
+    rlDeferred.colorg = 255;
+    rlDeferred.colorb = 255;
+    rlDeferred.colora = 255;
+#endif
+
+    rlRecorder = &rlDeferred;
+}
+
+// Disable deferred drawing, recorded draw commands are replayed
+void rlDisableDeferredDraw(void)
+{
+    if (!rlDeferred.enabled) return;
+
+    if (rlDeferred.commandCount > 0) rlDeferredReplay();
+
+    rlDeferred.enabled = false;
+    rlRecorder = NULL;
+}
+
+// Check if deferred drawing is enabled
+bool rlIsDeferredDrawEnabled(void)
+{
+    return rlDeferred.enabled;
+}
+
+// Set layer of following deferred draw commands
+// NOTE: Commands are sorted by layer first, draw order between different textures
+// is only guaranteed across layers
+void rlSetDrawLayer(int layer)
+{
+    rlDeferred.layer = layer;
+}
+
+// Get deferred drawing statistics, accumulated since deferred drawing was last enabled
+rlDeferredStats rlGetDeferredStats(void)
+{
+    return rlDeferred.stats;
+}
+
+// Record a new draw command
+static void rlDeferredBegin(rlglDeferredData *recorder, int mode)
+{
+    if (recorder->commandOpen) rlDeferredEnd(recorder);
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Follow render batch behaviour: a drawing mode change registers a new draw call with default texture
+    if (recorder->mode != mode)
+    {
+        recorder->mode = mode;
+        recorder->textureId = RLGL.State.defaultTextureId;
+        recorder->drawHasVertices = false;
+    }
+#else
+    recorder->mode = mode;
+#endif
+
+    if (recorder->commandCount >= recorder->commandCapacity)
+    {
+        recorder->commandCapacity = (recorder->commandCapacity == 0)? 1024 : 2*recorder->commandCapacity;
+        recorder->commands = (rlDeferredCommand *)RL_REALLOC(recorder->commands, recorder->commandCapacity*sizeof(rlDeferredCommand));
+    }
+
+    rlDeferredCommand *command = &recorder->commands[recorder->commandCount];
+    command->layer = recorder->layer;
+    command->shaderId = recorder->shaderId;
+    command->blendMode = recorder->blendMode;
+    command->textureId = recorder->textureId;
+    command->mode = mode;
+    command->order = recorder->commandCount;
+    command->shaderLocs = recorder->shaderLocs;
+    command->vertexOffset = recorder->vertexCount;
+    command->vertexCount = 0;
+    command->matrixIndex = -1;
+
+#if defined(GRAPHICS_API_OPENGL_11)
+    // OpenGL 1.1 transforms vertex on the GPU, modelview matrix at recording time is kept for replay
+    // NOTE: Command lists transform on CPU, they are drawn with the modelview matrix at submission
+    if (!recorder->threaded)
+    {
+        float matrix[16] = { 0 };
+        glGetFloatv(GL_MODELVIEW_MATRIX, matrix);
+
+        if ((recorder->matrixCount == 0) || (memcmp(&recorder->matrices[16*(recorder->matrixCount - 1)], matrix, sizeof(matrix)) != 0))
+        {
+            if (recorder->matrixCount >= recorder->matrixCapacity)
+            {
+                recorder->matrixCapacity = (recorder->matrixCapacity == 0)? 64 : 2*recorder->matrixCapacity;
+                recorder->matrices = (float *)RL_REALLOC(recorder->matrices, recorder->matrixCapacity*16*sizeof(float));
+            }
+
+            memcpy(&recorder->matrices[16*recorder->matrixCount], matrix, sizeof(matrix));
+            recorder->matrixCount++;
+        }
+
+        command->matrixIndex = recorder->matrixCount - 1;
+    }
+#endif
+
+    recorder->commandCount++;
+    recorder->commandOpen = true;
+}
+
+// Close the recorded draw command
+static void rlDeferredEnd(rlglDeferredData *recorder)
+{
+    // Commands without vertices are discarded
+    if (recorder->commandOpen && (recorder->commands[recorder->commandCount - 1].vertexCount == 0)) recorder->commandCount--;
+
+    recorder->commandOpen = false;
+    recorder->depth += (1.0f/20000.0f);
+}
+
+// Record a vertex with current texcoord and color
+static void rlDeferredAddVertex(rlglDeferredData *recorder, float x, float y, float z)
+{
+    if (!recorder->commandOpen) rlDeferredBegin(recorder, recorder->mode);
+
+    if (recorder->vertexCount >= recorder->vertexCapacity)
+    {
+        recorder->vertexCapacity = (recorder->vertexCapacity == 0)? 4096 : 2*recorder->vertexCapacity;
+        recorder->vertices = (rlDeferredVertex *)RL_REALLOC(recorder->vertices, recorder->vertexCapacity*sizeof(rlDeferredVertex));
+    }
+
+    // Vertices are recorded transformed, like the render batch stores them
+    Matrix *transform = NULL;
+    if (recorder->threaded) { if (recorder->transformRequired) transform = &recorder->transform; }
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    else if (RLGL.State.transformRequired) transform = &RLGL.State.transform;
+#endif
+
+    rlDeferredVertex *vertex = &recorder->vertices[recorder->vertexCount];
+    if (transform != NULL)
+    {
+        vertex->x = transform->m0*x + transform->m4*y + transform->m8*z + transform->m12;
+        vertex->y = transform->m1*x + transform->m5*y + transform->m9*z + transform->m13;
+        vertex->z = transform->m2*x + transform->m6*y + transform->m10*z + transform->m14;
+    }
+    else
+    {
+        vertex->x = x;
+        vertex->y = y;
+        vertex->z = z;
+    }
+    vertex->u = recorder->texcoordx;
+    vertex->v = recorder->texcoordy;
+    vertex->r = recorder->colorr;
+    vertex->g = recorder->colorg;
+    vertex->b = recorder->colorb;
+    vertex->a = recorder->colora;
+
+    recorder->vertexCount++;
+    recorder->commands[recorder->commandCount - 1].vertexCount++;
+    recorder->drawHasVertices = true;
+}
+
+// Record a texture change
+static void rlDeferredSetTexture(rlglDeferredData *recorder, unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Follow render batch behaviour: texture 0 keeps current texture,
+    // a new draw call is registered for a different texture, it starts in RL_QUADS mode
+    if ((id == 0) || (id == recorder->textureId)) return;
+
+    bool newDraw = recorder->drawHasVertices;
+#if defined(RLGL_MULTI_TEXTURE_BATCH)
+    // Default shader keeps the draw call, texture goes into a free slot
+    if (recorder->shaderId == RLGL.State.defaultShaderId) newDraw = false;
+#endif
+    if (newDraw)
+    {
+        recorder->mode = RL_QUADS;
+        recorder->drawHasVertices = false;
+    }
+#else
+    // NOTE: On OpenGL 1.1 texture 0 disables texturing
+    if (id == recorder->textureId) return;
+#endif
+
+    recorder->textureId = id;
+
+    // Texture changed inside rlBegin()/rlEnd(), following vertices go into a new command
+    if (recorder->commandOpen)
+    {
+        if (recorder->commands[recorder->commandCount - 1].vertexCount > 0) rlDeferredBegin(recorder, recorder->mode);
+        else recorder->commands[recorder->commandCount - 1].textureId = id;
+    }
+}
+
+// Compare deferred commands by sort key, recording order breaks ties
+static int rlDeferredCompare(const void *a, const void *b)
+{
+    const rlDeferredCommand *ca = (const rlDeferredCommand *)a;
+    const rlDeferredCommand *cb = (const rlDeferredCommand *)b;
+
+    if (ca->layer != cb->layer) return (ca->layer < cb->layer)? -1 : 1;
+    if (ca->shaderId != cb->shaderId) return (ca->shaderId < cb->shaderId)? -1 : 1;
+    if (ca->blendMode != cb->blendMode) return (ca->blendMode < cb->blendMode)? -1 : 1;
+    if (ca->textureId != cb->textureId) return (ca->textureId < cb->textureId)? -1 : 1;
+    if (ca->mode != cb->mode) return (ca->mode < cb->mode)? -1 : 1;
+    return (ca->order < cb->order)? -1 : ((ca->order > cb->order)? 1 : 0);
+}
+
+// Count state changes between consecutive commands, every change requires a new draw call
+static int rlDeferredCountDrawCalls(const rlDeferredCommand *commands, int count)
+{
+    int drawCalls = (count > 0)? 1 : 0;
+
+    for (int i = 1; i < count; i++)
+    {
+        if ((commands[i].shaderId != commands[i - 1].shaderId) || (commands[i].blendMode != commands[i - 1].blendMode) ||
+            (commands[i].textureId != commands[i - 1].textureId) || (commands[i].mode != commands[i - 1].mode)) drawCalls++;
+    }
+
+    return drawCalls;
+}
+
+// Replay recorded draw commands in their order through regular functions
+// NOTE: Vertices are already transformed, current transform applies on top of them
+static void rlReplayCommands(const rlglDeferredData *recorder)
+{
+#if defined(GRAPHICS_API_OPENGL_11)
+    bool matrixPushed = false;
+    int matrixIndex = -1;
+#endif
+
+    for (int i = 0; i < recorder->commandCount; i++)
+    {
+        const rlDeferredCommand *command = &recorder->commands[i];
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+        rlSetShader(command->shaderId, command->shaderLocs);
+        rlSetBlendMode(command->blendMode);
+
+        rlBegin(command->mode);
+        rlSetTexture(command->textureId);
+        // NOTE: A new draw call registered by rlSetTexture() starts in RL_QUADS mode, it has no vertices yet
+        if (rlRecorder == NULL) RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = command->mode;
+#else
+        if ((command->matrixIndex >= 0) && (command->matrixIndex != matrixIndex))
+        {
+            if (!matrixPushed)
+            {
+                glMatrixMode(GL_MODELVIEW);
+                glPushMatrix();
+                matrixPushed = true;
+            }
+
+            matrixIndex = command->matrixIndex;
+            glLoadMatrixf(&recorder->matrices[16*matrixIndex]);
+        }
+
+        if ((i == 0) || (command->textureId != recorder->commands[i - 1].textureId)) rlSetTexture(command->textureId);
+        rlBegin(command->mode);
+#endif
+
+        for (int v = command->vertexOffset; v < (command->vertexOffset + command->vertexCount); v++)
+        {
+            const rlDeferredVertex *vertex = &recorder->vertices[v];
+            rlTexCoord2f(vertex->u, vertex->v);
+            rlColor4ub(vertex->r, vertex->g, vertex->b, vertex->a);
+            rlVertex3f(vertex->x, vertex->y, vertex->z);
+        }
+
+        rlEnd();
+    }
+
+#if defined(GRAPHICS_API_OPENGL_11)
+    if (matrixPushed) glPopMatrix();
+#endif
+}
+
+// Replay recorded draw commands sorted into the render batch
+static void rlDeferredReplay(void)
+{
+    if (rlDeferred.commandOpen) rlDeferredEnd(&rlDeferred);
+
+    rlRecorder = NULL;      // Replay goes through regular functions
+
+    rlDeferred.stats.commandCount += rlDeferred.commandCount;
+    rlDeferred.stats.vertexCount += rlDeferred.vertexCount;
+    rlDeferred.stats.drawCallsRecorded += rlDeferredCountDrawCalls(rlDeferred.commands, rlDeferred.commandCount);
+
+    qsort(rlDeferred.commands, rlDeferred.commandCount, sizeof(rlDeferredCommand), rlDeferredCompare);
+
+    rlDeferred.stats.drawCallsSorted += rlDeferredCountDrawCalls(rlDeferred.commands, rlDeferred.commandCount);
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Recorded vertices already contain the transform
+    bool transformRequired = RLGL.State.transformRequired;
+    RLGL.State.transformRequired = false;
+
+    rlReplayCommands(&rlDeferred);
+
+    RLGL.State.transformRequired = transformRequired;
+
+    // Restore current shader and blend mode, the ones following commands are recorded with
+    rlSetShader(rlDeferred.shaderId, rlDeferred.shaderLocs);
+    rlSetBlendMode(rlDeferred.blendMode);
+
+    // Render batch draw calls are reset after drawing
+    rlDeferred.textureId = RLGL.State.defaultTextureId;
+    rlDeferred.mode = RL_QUADS;
+    rlDeferred.drawHasVertices = false;
+    rlDeferred.depth = RLGL.currentBatch->currentDepth;
+#else
+    rlReplayCommands(&rlDeferred);
+
+    rlSetTexture(rlDeferred.textureId);
+    rlDeferred.matrixCount = 0;
+#endif
+
+    rlDeferred.commandCount = 0;
+    rlDeferred.vertexCount = 0;
+    rlRecorder = rlDeferred.enabled? &rlDeferred : NULL;
+}
+
+// Command lists
+//-----------------------------------------------------------------------------------------
+// Load a command list
+rlCommandList *rlLoadCommandList(void)
+{
+    rlCommandList *list = (rlCommandList *)RL_CALLOC(1, sizeof(rlCommandList));
+    list->recorder.threaded = true;
+
+    return list;
+}
+
+// Unload a command list
+void rlUnloadCommandList(rlCommandList *list)
+{
+    if (list == NULL) return;
+
+    RL_FREE(list->recorder.commands);
+    RL_FREE(list->recorder.vertices);
+    RL_FREE(list);
+}
+
+// Begin recording draw commands into a command list on calling thread, previous commands are cleared
+// NOTE: Recording threads can use vertex, texture, shader, blending and modelview matrix functions
+// (i.e. rshapes and rtext drawing), they must not call functions requiring OpenGL or drawing the render batch
+void rlBeginCommandList(rlCommandList *list)
+{
+    if (rlRecorder != NULL)
+    {
+        TRACELOG(RL_LOG_WARNING, "RLGL: Draw commands already recorded on this thread, command list not begun");
+        return;
+    }
+
+    rlglDeferredData *recorder = &list->recorder;
+    recorder->commandOpen = false;
+    recorder->commandCount = 0;
+    recorder->vertexCount = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    recorder->shaderId = RLGL.State.defaultShaderId;
+    recorder->shaderLocs = RLGL.State.defaultShaderLocs;
+    recorder->textureId = RLGL.State.defaultTextureId;
+#else
+    recorder->textureId = 0;
+#endif
+    recorder->blendMode = RL_BLEND_ALPHA;
+    recorder->mode = RL_QUADS;
+    recorder->drawHasVertices = false;
+    recorder->texcoordx = 0.0f;
+    recorder->texcoordy = 0.0f;
+    recorder->colorr = 255;
+    recorder->colorg = 255;
+    recorder->colorb = 255;
+    recorder->colora = 255;
+    recorder->depth = -1.0f;
+
+    recorder->transform = rlMatrixIdentity();
+    recorder->transformRequired = false;
+    recorder->stackCounter = 0;
+
+    rlRecorder = recorder;
+}
+
+// End recording draw commands on calling thread
+void rlEndCommandList(void)
+{
+    if (!rlIsRecordingCommandList()) return;
+
+    if (rlRecorder->commandOpen) rlDeferredEnd(rlRecorder);
+    rlRecorder = NULL;
+}
+
+// Submit command list draw commands into render batch, in recording order
+// NOTE: Call it on the thread owning the OpenGL context, lists are drawn with current modelview matrix,
+// their shader and blend mode are the default ones unless set while recording
+void rlSubmitCommandList(rlCommandList *list)
+{
+    if (list->recorder.commandCount == 0) return;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    unsigned int shaderId = (rlRecorder != NULL)? rlRecorder->shaderId : RLGL.State.currentShaderId;
+    int *shaderLocs = (rlRecorder != NULL)? rlRecorder->shaderLocs : RLGL.State.currentShaderLocs;
+    int blendMode = (rlRecorder != NULL)? rlRecorder->blendMode : RLGL.State.currentBlendMode;
+
+    rlReplayCommands(&list->recorder);
+
+    rlSetShader(shaderId, shaderLocs);
+    rlSetBlendMode(blendMode);
+#else
+    rlReplayCommands(&list->recorder);
+
+    rlSetTexture(0);
+#endif
+}
+
+// Check if calling thread records a command list
+static bool rlIsRecordingCommandList(void)
+{
+    return (rlRecorder != NULL) && rlRecorder->threaded;
+}
+
+// Multiply command list transform matrix, like rlTranslatef() does with current matrix
+static void rlCommandListTransform(Matrix mat)
+{
+    // NOTE: We transpose matrix with multiplication order
+    rlRecorder->transform = rlMatrixMultiply(mat, rlRecorder->transform);
+    rlRecorder->transformRequired = true;
+}
+
+// Instanced sprites
+//-----------------------------------------------------------------------------------------
+// Draw sprite instances with a texture
+// NOTE: All instances of a frame are copied into one segment of a ring buffer and every call is drawn with
+// a single instanced draw call. The segment grows when a frame draws more instances than it holds, and a
+// fence per frame (placed by rlUpdateFrameStats()) prevents overwriting instances the GPU is still reading,
+// so waiting only happens at the first draw of a frame. Previous render batch draws are drawn first to keep order
+void rlDrawSpriteInstances(unsigned int textureId, int textureWidth, int textureHeight, const rlSpriteInstance *instances, int count)
+{
+    if ((instances == NULL) || (count <= 0)) return;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!rlSprites.loaded) rlLoadSpriteRenderer();
+
+    // Recorded draw commands are replayed into the render batch, instanced draws can not be recorded
+    if ((rlSprites.shaderId == 0) || (rlRecorder != NULL))
+    {
+        rlDrawSpriteQuads(textureId, textureWidth, textureHeight, instances, count);
+        return;
+    }
+
+    rlDrawRenderBatch(RLGL.currentBatch);
+
+    // Render batch vertices are transformed on CPU, instances transform is applied in the shader
+    Matrix matMVP = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
+    if (RLGL.State.transformRequired) matMVP = rlMatrixMultiply(RLGL.State.transform, matMVP);
+
+    float matMVPfloat[16] = {
+        matMVP.m0, matMVP.m1, matMVP.m2, matMVP.m3,
+        matMVP.m4, matMVP.m5, matMVP.m6, matMVP.m7,
+        matMVP.m8, matMVP.m9, matMVP.m10, matMVP.m11,
+        matMVP.m12, matMVP.m13, matMVP.m14, matMVP.m15
+    };
+
+    rlEnableShader(rlSprites.shaderId);
+    glUniformMatrix4fv(rlSprites.locMvp, 1, false, matMVPfloat);
+    glUniform2f(rlSprites.locTextureSize, (float)textureWidth, (float)textureHeight);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, textureId);
+
+    rlStats.current.textureBinds++;
+
+    if (RLGL.ExtSupported.vao) glBindVertexArray(rlSprites.vaoId);
+    else rlEnableSpriteAttributes(true);
+
+    glBindBuffer(GL_ARRAY_BUFFER, rlSprites.vboId[1]);
+
+    if ((rlSprites.frameInstances + count) > rlSprites.frameCapacity) rlResizeSpriteBuffer(rlSprites.frameInstances + count);
+
+    int offset = rlSprites.currentBuffer*rlSprites.frameCapacity + rlSprites.frameInstances;
+    size_t dataSize = count*sizeof(rlSpriteInstance);
+
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    // Wait for GPU to release the segment, it was drawn RL_DEFAULT_SPRITE_BUFFERS frames ago
+    // NOTE: With enough frames in flight the fence is already signaled and this does not block
+    if ((rlSprites.frameInstances == 0) && (rlSprites.fences[rlSprites.currentBuffer] != NULL))
+    {
+        GLsync fence = (GLsync)rlSprites.fences[rlSprites.currentBuffer];
+        GLenum waitResult = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);   // Timeout in nanoseconds
+
+        while (waitResult == GL_TIMEOUT_EXPIRED) waitResult = glClientWaitSync(fence, 0, 1000000);
+        if (waitResult == GL_WAIT_FAILED) TRACELOG(RL_LOG_WARNING, "RLGL: Failed to wait for sprite instances buffer fence");
+
+        glDeleteSync(fence);
+        rlSprites.fences[rlSprites.currentBuffer] = NULL;
+    }
+
+    if (rlSprites.mapped != NULL) memcpy(rlSprites.mapped + offset, instances, dataSize);
+    else
+    {
+        // Unsynchronized mapping skips the driver implicit sync, segment fence already guarantees GPU is not reading it
+        void *mapped = glMapBufferRange(GL_ARRAY_BUFFER, offset*sizeof(rlSpriteInstance), dataSize, GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+        if (mapped != NULL)
+        {
+            memcpy(mapped, instances, dataSize);
+            glUnmapBuffer(GL_ARRAY_BUFFER);
+        }
+        else glBufferSubData(GL_ARRAY_BUFFER, offset*sizeof(rlSpriteInstance), dataSize, instances);
+    }
+#else
+    // No fences available, the whole ring is orphaned when it wraps around so the driver
+    // provides new storage instead of waiting for the GPU to finish with previous frames
+    if ((rlSprites.currentBuffer == 0) && (rlSprites.frameInstances == 0)) glBufferData(GL_ARRAY_BUFFER, RL_DEFAULT_SPRITE_BUFFERS*rlSprites.frameCapacity*sizeof(rlSpriteInstance), NULL, GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, offset*sizeof(rlSpriteInstance), dataSize, instances);
+#endif
+
+    rlSetSpriteInstancesOffset(offset);
+    glDrawArraysInstanced(GL_TRIANGLES, 0, 6, count);
+
+    rlSprites.frameInstances += count;
+
+    rlStats.current.drawCalls++;
+    rlStats.current.vertexCount += 6*count;
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+    else rlEnableSpriteAttributes(false);
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glUseProgram(0);
+#else
+    rlDrawSpriteQuads(textureId, textureWidth, textureHeight, instances, count);
+#endif
+}
+
+// Draw sprite instances as render batch quads, transformed on CPU
+static void rlDrawSpriteQuads(unsigned int textureId, int textureWidth, int textureHeight, const rlSpriteInstance *instances, int count)
+{
+    float width = (float)textureWidth;
+    float height = (float)textureHeight;
+
+    rlSetTexture(textureId);
+    rlBegin(RL_QUADS);
+
+        rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+
+        for (int i = 0; i < count; i++)
+        {
+            const rlSpriteInstance *sprite = &instances[i];
+
+            // Half extents of the sprite, rotated around its center
+            float halfWidth = 0.5f*sprite->sourcewidth*sprite->scalex;
+            float halfHeight = 0.5f*sprite->sourceheight*sprite->scaley;
+            float cosRotation = 1.0f;
+            float sinRotation = 0.0f;
+
+            if (sprite->rotation != 0.0f)
+            {
+                cosRotation = cosf(sprite->rotation*DEG2RAD);
+                sinRotation = sinf(sprite->rotation*DEG2RAD);
+            }
+
+            float ax = halfWidth*cosRotation;
+            float ay = halfWidth*sinRotation;
+            float bx = -halfHeight*sinRotation;
+            float by = halfHeight*cosRotation;
+
+            float left = sprite->sourcex/width;
+            float top = sprite->sourcey/height;
+            float right = (sprite->sourcex + sprite->sourcewidth)/width;
+            float bottom = (sprite->sourcey + sprite->sourceheight)/height;
+
+            rlColor4ub(sprite->r, sprite->g, sprite->b, sprite->a);
+
+            // Top-left corner for texture and quad
+            rlTexCoord2f(left, top);
+            rlVertex2f(sprite->x - ax - bx, sprite->y - ay - by);
+
+            // Bottom-left corner for texture and quad
+            rlTexCoord2f(left, bottom);
+            rlVertex2f(sprite->x - ax + bx, sprite->y - ay + by);
+
+            // Bottom-right corner for texture and quad
+            rlTexCoord2f(right, bottom);
+            rlVertex2f(sprite->x + ax + bx, sprite->y + ay + by);
+
+            // Top-right corner for texture and quad
+            rlTexCoord2f(right, top);
+            rlVertex2f(sprite->x + ax - bx, sprite->y + ay - by);
+        }
+
+    rlEnd();
+    rlSetTexture(0);
+}
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Load instanced sprites renderer: shader, quad corners and instances ring buffer
+// NOTE: Without instancing support the renderer is not loaded, sprites are drawn as render batch quads
+static void rlLoadSpriteRenderer(void)
+{
+    rlSprites.loaded = true;
+
+    if (!RLGL.ExtSupported.instancing)
+    {
+        TRACELOG(RL_LOG_INFO, "RLGL: Instancing not supported, sprite instances drawn with render batch");
+        return;
+    }
+
+    // Vertex shader building every sprite quad from its instance data
+    const char *spriteVShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec2 vertexPosition;     \n"
+    "attribute vec3 instancePosition;   \n"
+    "attribute vec2 instanceScale;      \n"
+    "attribute vec4 instanceSource;     \n"
+    "attribute vec4 instanceColor;      \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 vertexPosition;            \n"
+    "in vec3 instancePosition;          \n"
+    "in vec2 instanceScale;             \n"
+    "in vec4 instanceSource;            \n"
+    "in vec4 instanceColor;             \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL) (on some browsers)
+    "attribute vec2 vertexPosition;     \n"
+    "attribute vec3 instancePosition;   \n"
+    "attribute vec2 instanceScale;      \n"
+    "attribute vec4 instanceSource;     \n"
+    "attribute vec4 instanceColor;      \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "uniform vec2 textureSize;          \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec2 offset = (vertexPosition - 0.5)*instanceSource.zw*instanceScale; \n"
+    "    float angle = radians(instancePosition.z); \n"
+    "    vec2 rotated = vec2(offset.x*cos(angle) - offset.y*sin(angle), offset.x*sin(angle) + offset.y*cos(angle)); \n"
+    "    fragTexCoord = (instanceSource.xy + vertexPosition*instanceSource.zw)/textureSize; \n"
+    "    fragColor = instanceColor;     \n"
+    "    gl_Position = mvp*vec4(instancePosition.xy + rotated, 0.0, 1.0); \n"
+    "}                                  \n";
+
+    const char *spriteFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    gl_FragColor = texture2D(texture0, fragTexCoord)*fragColor; \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    finalColor = texture(texture0, fragTexCoord)*fragColor; \n"
+    "}                                  \n";
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL)
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    gl_FragColor = texture2D(texture0, fragTexCoord)*fragColor; \n"
+    "}                                  \n";
+#endif
+
+    unsigned int vShaderId = rlCompileShader(spriteVShaderCode, GL_VERTEX_SHADER);
+    unsigned int fShaderId = rlCompileShader(spriteFShaderCode, GL_FRAGMENT_SHADER);
+
+    if ((vShaderId != 0) && (fShaderId != 0)) rlSprites.shaderId = rlLoadShaderProgram(vShaderId, fShaderId);
+    if (vShaderId != 0) glDeleteShader(vShaderId);
+    if (fShaderId != 0) glDeleteShader(fShaderId);
+
+    if (rlSprites.shaderId == 0)
+    {
+        TRACELOG(RL_LOG_WARNING, "SHADER: Failed to load sprite instances shader, sprite instances drawn with render batch");
+        return;
+    }
+
+    rlSprites.locCorner = glGetAttribLocation(rlSprites.shaderId, "vertexPosition");
+    rlSprites.locPosition = glGetAttribLocation(rlSprites.shaderId, "instancePosition");
+    rlSprites.locScale = glGetAttribLocation(rlSprites.shaderId, "instanceScale");
+    rlSprites.locSource = glGetAttribLocation(rlSprites.shaderId, "instanceSource");
+    rlSprites.locColor = glGetAttribLocation(rlSprites.shaderId, "instanceColor");
+    rlSprites.locMvp = glGetUniformLocation(rlSprites.shaderId, "mvp");
+    rlSprites.locTextureSize = glGetUniformLocation(rlSprites.shaderId, "textureSize");
+
+    glUseProgram(rlSprites.shaderId);
+    glUniform1i(glGetUniformLocation(rlSprites.shaderId, "texture0"), 0);
+    glUseProgram(0);
+
+    // Quad corners, two triangles from (0, 0) top-left to (1, 1) bottom-right
+    float corners[12] = { 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 0.0f };
+
+    if (RLGL.ExtSupported.vao)
+    {
+        glGenVertexArrays(1, &rlSprites.vaoId);
+        glBindVertexArray(rlSprites.vaoId);
+    }
+
+    glGenBuffers(2, rlSprites.vboId);
+    glBindBuffer(GL_ARRAY_BUFFER, rlSprites.vboId[0]);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(corners), corners, GL_STATIC_DRAW);
+
+    glBindBuffer(GL_ARRAY_BUFFER, rlSprites.vboId[1]);
+    rlSprites.frameCapacity = RL_DEFAULT_SPRITE_INSTANCES;
+    rlLoadSpriteBuffer();
+
+    if (RLGL.ExtSupported.vao)
+    {
+        // Attributes are kept by the VAO, only instances offset changes on draw
+        rlEnableSpriteAttributes(true);
+        glBindVertexArray(0);
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    TRACELOG(RL_LOG_INFO, "RLGL: Sprite instances renderer loaded successfully (%i frames of %i instances%s)",
+        RL_DEFAULT_SPRITE_BUFFERS, rlSprites.frameCapacity, (rlSprites.mapped != NULL)? ", persistently mapped" : "");
+}
+
+// Load instances ring buffer storage, frameCapacity instances per segment
+// NOTE: Instances ring buffer must be bound
+static void rlLoadSpriteBuffer(void)
+{
+    size_t dataSize = RL_DEFAULT_SPRITE_BUFFERS*rlSprites.frameCapacity*sizeof(rlSpriteInstance);
+
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    if (RLGL.ExtSupported.bufferStorage)
+    {
+        // Immutable storage mapped once for the buffer lifetime, instances are copied directly into it
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glBufferStorage(GL_ARRAY_BUFFER, dataSize, NULL, flags);
+        rlSprites.mapped = (rlSpriteInstance *)glMapBufferRange(GL_ARRAY_BUFFER, 0, dataSize, flags);
+
+        if (rlSprites.mapped == NULL)
+        {
+            // Immutable storage can not be reallocated, get a new buffer for the fallback path
+            TRACELOG(RL_LOG_WARNING, "RLGL: Failed to map sprite instances buffer persistently, using regular uploads");
+            glDeleteBuffers(1, &rlSprites.vboId[1]);
+            glGenBuffers(1, &rlSprites.vboId[1]);
+            glBindBuffer(GL_ARRAY_BUFFER, rlSprites.vboId[1]);
+        }
+    }
+#endif
+    if (rlSprites.mapped == NULL) glBufferData(GL_ARRAY_BUFFER, dataSize, NULL, GL_STREAM_DRAW);
+}
+
+// Grow instances ring buffer segments to hold a frame of instances
+// NOTE: Buffer is replaced by a new one, draws already issued keep reading previous storage until
+// the GPU finishes with them, so nothing is waited here. Current frame continues in the new buffer
+static void rlResizeSpriteBuffer(int instances)
+{
+    int capacity = rlSprites.frameCapacity;
+    while (capacity < instances) capacity *= 2;
+
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    for (int i = 0; i < RL_DEFAULT_SPRITE_BUFFERS; i++)
+    {
+        if (rlSprites.fences[i] != NULL) glDeleteSync((GLsync)rlSprites.fences[i]);
+        rlSprites.fences[i] = NULL;
+    }
+#endif
+    // NOTE: Persistently mapped buffer is implicitly unmapped on deletion
+    glDeleteBuffers(1, &rlSprites.vboId[1]);
+    glGenBuffers(1, &rlSprites.vboId[1]);
+    glBindBuffer(GL_ARRAY_BUFFER, rlSprites.vboId[1]);
+
+    rlSprites.mapped = NULL;
+    rlSprites.frameCapacity = capacity;
+    rlSprites.frameInstances = 0;
+    rlLoadSpriteBuffer();
+
+    TRACELOG(RL_LOG_INFO, "RLGL: Sprite instances buffer resized (%i frames of %i instances)", RL_DEFAULT_SPRITE_BUFFERS, capacity);
+}
+
+// Fence current frame segment, next frame writes the following one
+static void rlEndSpriteFrame(void)
+{
+    if (rlSprites.frameInstances == 0) return;
+
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    rlSprites.fences[rlSprites.currentBuffer] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+#endif
+    rlSprites.currentBuffer = (rlSprites.currentBuffer + 1)%RL_DEFAULT_SPRITE_BUFFERS;
+    rlSprites.frameInstances = 0;
+}
+
+// Unload instanced sprites renderer
+static void rlUnloadSpriteRenderer(void)
+{
+    if (rlSprites.shaderId != 0)
+    {
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+        for (int i = 0; i < RL_DEFAULT_SPRITE_BUFFERS; i++) if (rlSprites.fences[i] != NULL) glDeleteSync((GLsync)rlSprites.fences[i]);
+#endif
+        // NOTE: Persistently mapped buffer is implicitly unmapped on deletion
+        glDeleteBuffers(2, rlSprites.vboId);
+        if (rlSprites.vaoId != 0) glDeleteVertexArrays(1, &rlSprites.vaoId);
+        glDeleteProgram(rlSprites.shaderId);
+    }
+
+    memset(&rlSprites, 0, sizeof(rlSprites));
+}
+
+// Enable/disable sprites shader attributes: quad corners per vertex, instance data per instance
+// NOTE: Without VAO support attributes are enabled on every draw, they must be disabled after it
+// and divisors reset, render batch attributes do not advance per instance
+static void rlEnableSpriteAttributes(bool enable)
+{
+    int instanceLocs[4] = { rlSprites.locPosition, rlSprites.locScale, rlSprites.locSource, rlSprites.locColor };
+
+    if (enable)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, rlSprites.vboId[0]);
+        glVertexAttribPointer(rlSprites.locCorner, 2, GL_FLOAT, 0, 0, 0);
+        glEnableVertexAttribArray(rlSprites.locCorner);
+
+        for (int i = 0; i < 4; i++)
+        {
+            if (instanceLocs[i] < 0) continue;
+            glEnableVertexAttribArray(instanceLocs[i]);
+            glVertexAttribDivisor(instanceLocs[i], 1);
+        }
+    }
+    else
+    {
+        glDisableVertexAttribArray(rlSprites.locCorner);
+
+        for (int i = 0; i < 4; i++)
+        {
+            if (instanceLocs[i] < 0) continue;
+            glVertexAttribDivisor(instanceLocs[i], 0);
+            glDisableVertexAttribArray(instanceLocs[i]);
+        }
+    }
+}
+
+// Point instance attributes to a ring buffer offset (in instances)
+// NOTE: Instances ring buffer must be bound, attributes: position + rotation, scale, source, color
+static void rlSetSpriteInstancesOffset(int offset)
+{
+    size_t base = offset*sizeof(rlSpriteInstance);
+
+    if (rlSprites.locPosition >= 0) glVertexAttribPointer(rlSprites.locPosition, 3, GL_FLOAT, 0, sizeof(rlSpriteInstance), (void *)base);
+    if (rlSprites.locScale >= 0) glVertexAttribPointer(rlSprites.locScale, 2, GL_FLOAT, 0, sizeof(rlSpriteInstance), (void *)(base + 3*sizeof(float)));
+    if (rlSprites.locSource >= 0) glVertexAttribPointer(rlSprites.locSource, 4, GL_UNSIGNED_SHORT, 0, sizeof(rlSpriteInstance), (void *)(base + 5*sizeof(float)));
+    if (rlSprites.locColor >= 0) glVertexAttribPointer(rlSprites.locColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(rlSpriteInstance), (void *)(base + 5*sizeof(float) + 4*sizeof(unsigned short)));
+}
+#endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
+
+// Frustum culling
+//-----------------------------------------------------------------------------------------
+// Check if a bounding box, with transform applied, is inside view frustum
+// NOTE: Frustum planes are extracted from the model-view-projection matrix (Gribb-Hartmann), box is
+// checked in its local space and is culled only if it is fully outside of one plane, so boxes crossing
+// frustum corners are kept (conservative). Stereo rendering uses two frustums, boxes are never culled
+bool rlCheckBoxInFrustum(Matrix transform, float minX, float minY, float minZ, float maxX, float maxY, float maxZ)
+{
+    rlStats.current.cullTests++;
+
+    if (rlIsStereoRenderEnabled()) return true;
+
+    // Same transforms applied by DrawMesh(): model, internal transform, view and projection
+    Matrix mvp = rlMatrixMultiply(rlMatrixMultiply(rlMatrixMultiply(transform, rlGetMatrixTransform()), rlGetMatrixModelview()), rlGetMatrixProjection());
+
+    // Planes as (a, b, c, d), points inside satisfy a*x + b*y + c*z + d >= 0
+    float planes[6][4] = {
+        { mvp.m3 + mvp.m0, mvp.m7 + mvp.m4, mvp.m11 + mvp.m8, mvp.m15 + mvp.m12 },     // Left
+        { mvp.m3 - mvp.m0, mvp.m7 - mvp.m4, mvp.m11 - mvp.m8, mvp.m15 - mvp.m12 },     // Right
+        { mvp.m3 + mvp.m1, mvp.m7 + mvp.m5, mvp.m11 + mvp.m9, mvp.m15 + mvp.m13 },     // Bottom
+        { mvp.m3 - mvp.m1, mvp.m7 - mvp.m5, mvp.m11 - mvp.m9, mvp.m15 - mvp.m13 },     // Top
+        { mvp.m3 + mvp.m2, mvp.m7 + mvp.m6, mvp.m11 + mvp.m10, mvp.m15 + mvp.m14 },    // Near
+        { mvp.m3 - mvp.m2, mvp.m7 - mvp.m6, mvp.m11 - mvp.m10, mvp.m15 - mvp.m14 }     // Far
+    };
+
+    for (int i = 0; i < 6; i++)
+    {
+        // Box corner furthest along the plane normal, box is outside if even that corner is
+        float x = (planes[i][0] >= 0.0f)? maxX : minX;
+        float y = (planes[i][1] >= 0.0f)? maxY : minY;
+        float z = (planes[i][2] >= 0.0f)? maxZ : minZ;
+
+        if ((planes[i][0]*x + planes[i][1]*y + planes[i][2]*z + planes[i][3]) < 0.0f)
+        {
+            rlStats.current.culledCount++;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Frame statistics
+//-----------------------------------------------------------------------------------------
+// Get statistics of last finished frame
+rlFrameStats rlGetFrameStats(void)
+{
+    return rlStats.last;
+}
+
+// Finish frame statistics, counters start over for next frame
+// NOTE: GPU timer queries are read back RL_GPU_TIMER_FRAMES frames later, by then
+// results are available and reading them does not stall the pipeline. Sprite instances frame
+// is finished here too, its ring segment is fenced once per frame
+void rlUpdateFrameStats(float cpuTime)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlEndSpriteFrame();
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_33)     // Also defined for GRAPHICS_API_OPENGL_21
+    if (rlStats.gpuTiming)
+    {
+        while ((rlStats.gpuStackCount + rlStats.gpuStackSkipped) > 0) rlPopGpuTimer();
+
+        rlGpuTimerFrame *frame = &rlStats.gpuFrames[rlStats.gpuFrame];
+        glQueryCounter(frame->queries[1], GL_TIMESTAMP);
+        frame->pending = true;
+
+        // Read back oldest frame in flight, its queries are reused for next frame
+        rlStats.gpuFrame = (rlStats.gpuFrame + 1)%RL_GPU_TIMER_FRAMES;
+        frame = &rlStats.gpuFrames[rlStats.gpuFrame];
+
+        if (frame->pending)
+        {
+            GLuint64 begin = 0;
+            GLuint64 end = 0;
+            glGetQueryObjectui64v(frame->queries[0], GL_QUERY_RESULT, &begin);
+            glGetQueryObjectui64v(frame->queries[1], GL_QUERY_RESULT, &end);
+            rlStats.gpuTime = (float)(end - begin)/1000000.0f;
+
+            for (int i = 0; i < frame->scopeCount; i++)
+            {
+                glGetQueryObjectui64v(frame->queries[2 + 2*i], GL_QUERY_RESULT, &begin);
+                glGetQueryObjectui64v(frame->queries[3 + 2*i], GL_QUERY_RESULT, &end);
+                rlStats.gpuScopes[i].name = frame->names[i];
+                rlStats.gpuScopes[i].depth = frame->depths[i];
+                rlStats.gpuScopes[i].time = (float)(end - begin)/1000000.0f;
+            }
+            rlStats.gpuScopeCount = frame->scopeCount;
+        }
+
+        frame->scopeCount = 0;
+        frame->pending = false;
+        glQueryCounter(frame->queries[0], GL_TIMESTAMP);
+    }
+#endif
+
+    rlStats.current.cpuTime = cpuTime;
+    rlStats.current.gpuTime = rlStats.gpuTime;
+    rlStats.current.gpuScopeCount = rlStats.gpuScopeCount;
+    memcpy(rlStats.current.gpuScopes, rlStats.gpuScopes, sizeof(rlStats.gpuScopes));
+
+    rlStats.last = rlStats.current;
+    memset(&rlStats.current, 0, sizeof(rlFrameStats));
+}
+
+// Enable GPU timing with timestamp queries
+// NOTE: Timestamp queries are not available on OpenGL 1.1 and OpenGL ES 2.0
+void rlEnableGpuTiming(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33)     // Also defined for GRAPHICS_API_OPENGL_21
+    if (rlStats.gpuTiming) return;
+
+    if (!RLGL.ExtSupported.timerQuery)
+    {
+        TRACELOG(RL_LOG_WARNING, "RLGL: GPU timing requires timestamp queries, not supported");
+        return;
+    }
+
+    if (rlStats.gpuFrames[0].queries[0] == 0)
+    {
+        for (int i = 0; i < RL_GPU_TIMER_FRAMES; i++) glGenQueries(2 + 2*RL_MAX_GPU_TIMER_SCOPES, rlStats.gpuFrames[i].queries);
+    }
+
+    for (int i = 0; i < RL_GPU_TIMER_FRAMES; i++)
+    {
+        rlStats.gpuFrames[i].scopeCount = 0;
+        rlStats.gpuFrames[i].pending = false;
+    }
+
+    rlStats.gpuTiming = true;
+    rlStats.gpuFrame = 0;
+    rlStats.gpuStackCount = 0;
+    rlStats.gpuStackSkipped = 0;
+    glQueryCounter(rlStats.gpuFrames[0].queries[0], GL_TIMESTAMP);
+#else
+    TRACELOG(RL_LOG_WARNING, "RLGL: GPU timing not supported by current OpenGL version");
+#endif
+}
+
+// Disable GPU timing
+void rlDisableGpuTiming(void)
+{
+    rlStats.gpuTiming = false;
+    rlStats.gpuTime = 0.0f;
+    rlStats.gpuScopeCount = 0;
+}
+
+// Check if GPU timing is enabled
+bool rlIsGpuTimingEnabled(void)
+{
+    return rlStats.gpuTiming;
+}
+
+// Begin a GPU timer scope
+// NOTE: Render batch is drawn at scope begin and end, so batch vertices are measured in the scope they were added,
+// deferred drawing commands are only drawn on EndDeferredMode() and measured in the scope open there
+void rlPushGpuTimer(const char *name)
+{
+    if (!rlStats.gpuTiming || rlIsRecordingCommandList()) return;
+
+#if defined(GRAPHICS_API_OPENGL_33)     // Also defined for GRAPHICS_API_OPENGL_21
+    // NOTE: Deferred drawing replays and sorts its commands on EndDeferredMode(), they are not flushed here
+    if (rlRecorder != &rlDeferred) rlDrawRenderBatch(RLGL.currentBatch);
+
+    rlGpuTimerFrame *frame = &rlStats.gpuFrames[rlStats.gpuFrame];
+
+    if ((frame->scopeCount >= RL_MAX_GPU_TIMER_SCOPES) || (rlStats.gpuStackSkipped > 0))
+    {
+        rlStats.gpuStackSkipped++;
+        return;
+    }
+
+    glQueryCounter(frame->queries[2 + 2*frame->scopeCount], GL_TIMESTAMP);
+    frame->names[frame->scopeCount] = name;
+    frame->depths[frame->scopeCount] = rlStats.gpuStackCount;
+    rlStats.gpuStack[rlStats.gpuStackCount] = frame->scopeCount;
+    rlStats.gpuStackCount++;
+    frame->scopeCount++;
+#endif
+}
+
+// End last GPU timer scope
+void rlPopGpuTimer(void)
+{
+    if (!rlStats.gpuTiming || rlIsRecordingCommandList()) return;
+
+#if defined(GRAPHICS_API_OPENGL_33)     // Also defined for GRAPHICS_API_OPENGL_21
+    // NOTE: Deferred drawing replays and sorts its commands on EndDeferredMode(), they are not flushed here
+    if (rlRecorder != &rlDeferred) rlDrawRenderBatch(RLGL.currentBatch);
+
+    if (rlStats.gpuStackSkipped > 0) rlStats.gpuStackSkipped--;
+    else if (rlStats.gpuStackCount > 0)
+    {
+        rlStats.gpuStackCount--;
+        glQueryCounter(rlStats.gpuFrames[rlStats.gpuFrame].queries[3 + 2*rlStats.gpuStack[rlStats.gpuStackCount]], GL_TIMESTAMP);
+    }
+#endif
+}
+
+// Textures data management
+//-----------------------------------------------------------------------------------------
+// Convert image data to OpenGL texture (returns OpenGL valid Id)
+unsigned int rlLoadTexture(const void *data, int width, int height, int format, int mipmapCount)
+{
+    unsigned int id = 0;
+
+    glBindTexture(GL_TEXTURE_2D, 0);    // Free any old binding
+
+    // Check texture format support by OpenGL 1.1 (compressed textures not supported)
+#if defined(GRAPHICS_API_OPENGL_11)
+    if (format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: OpenGL 1.1 does not support GPU compressed texture formats");
         return id;
     }
 #else
@@ -3715,6 +5530,9 @@ void rlDisableVertexAttribute(unsigned int index)
 void rlDrawVertexArray(int offset, int count)
 {
     glDrawArrays(GL_TRIANGLES, offset, count);
+
+    rlStats.current.drawCalls++;
+    rlStats.current.vertexCount += count;
 }
 
 // Draw vertex array elements
@@ -3725,6 +5543,9 @@ void rlDrawVertexArrayElements(int offset, int count, const void *buffer)
     if (offset > 0) bufferPtr += offset;
 
     glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)bufferPtr);
+
+    rlStats.current.drawCalls++;
+    rlStats.current.vertexCount += count;
 }
 
 // Draw vertex array instanced
@@ -3732,6 +5553,9 @@ void rlDrawVertexArrayInstanced(int offset, int count, int instances)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glDrawArraysInstanced(GL_TRIANGLES, 0, count, instances);
+
+    rlStats.current.drawCalls++;
+    rlStats.current.vertexCount += count*instances;
 #endif
 }
 
@@ -3744,6 +5568,9 @@ void rlDrawVertexArrayElementsInstanced(int offset, int count, const void *buffe
     if (offset > 0) bufferPtr += offset;
 
     glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)bufferPtr, instances);
+
+    rlStats.current.drawCalls++;
+    rlStats.current.vertexCount += count*instances;
 #endif
 }
 
@@ -3976,9 +5803,17 @@ unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
     glBindAttribLocation(program, 3, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
     glBindAttribLocation(program, 4, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
     glBindAttribLocation(program, 5, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
+#if defined(RLGL_MULTI_TEXTURE_BATCH)
+    glBindAttribLocation(program, 6, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXINDEX);
+#endif
 
     // NOTE: If some attrib name is no found on the shader, it locations becomes -1
 
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Keep program binary retrievable, for drivers that only provide it when requested before linking
+    if (RLGL.ExtSupported.programBinary) glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+#endif
+
     glLinkProgram(program);
 
     // NOTE: All uniform variables are intitialised to 0 when a program links
@@ -4018,6 +5853,89 @@ unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
     return program;
 }
 
+// Get linked shader program binary, to load it later with rlLoadShaderProgramBinary()
+// NOTE: Binaries are only valid for the same driver, check rlGetShaderBinaryDriver(),
+// not available on OpenGL ES 2.0 and OpenGL 1.1, returns NULL
+unsigned char *rlGetShaderProgramBinary(unsigned int id, int *dataSize, int *format)
+{
+    unsigned char *data = NULL;
+    *dataSize = 0;
+    *format = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (RLGL.ExtSupported.programBinary && (id > 0))
+    {
+        GLint binarySize = 0;
+        glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &binarySize);
+
+        if (binarySize > 0)
+        {
+            GLsizei length = 0;
+            GLenum binaryFormat = 0;
+            data = (unsigned char *)RL_MALLOC(binarySize);
+            glGetProgramBinary(id, binarySize, &length, &binaryFormat, data);
+
+            if (length > 0)
+            {
+                *dataSize = length;
+                *format = (int)binaryFormat;
+            }
+            else
+            {
+                RL_FREE(data);
+                data = NULL;
+            }
+        }
+    }
+#endif
+    return data;
+}
+
+// Load shader program from binary
+// NOTE: Drivers reject binaries of other drivers or versions, returned id is 0 and program must be compiled
+unsigned int rlLoadShaderProgramBinary(const unsigned char *data, int dataSize, int format)
+{
+    unsigned int program = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (RLGL.ExtSupported.programBinary && (data != NULL) && (dataSize > 0))
+    {
+        GLint success = 0;
+        program = glCreateProgram();
+
+        // NOTE: Attribute locations bound on linking are part of the binary
+        glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        glProgramBinary(program, (GLenum)format, data, dataSize);
+        glGetProgramiv(program, GL_LINK_STATUS, &success);
+
+        if (success == GL_FALSE)
+        {
+            TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program binary not accepted by driver", program);
+            glDeleteProgram(program);
+            program = 0;
+        }
+        else TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program shader loaded successfully from binary", program);
+    }
+#endif
+    return program;
+}
+
+// Get driver identification program binaries depend on
+// NOTE: Empty string if program binaries are not supported
+const char *rlGetShaderBinaryDriver(void)
+{
+    static char driver[512] = { 0 };
+    driver[0] = '\0';
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (RLGL.ExtSupported.programBinary)
+    {
+        snprintf(driver, sizeof(driver), "%s|%s|%s", (const char *)glGetString(GL_VENDOR), (const char *)glGetString(GL_RENDERER), (const char *)glGetString(GL_VERSION));
+    }
+#endif
+    return driver;
+}
+
 // Unload shader program
 void rlUnloadShaderProgram(unsigned int id)
 {
@@ -4128,6 +6046,14 @@ void rlSetUniformSampler(int locIndex, unsigned int textureId)
 void rlSetShader(unsigned int id, int *locs)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (rlRecorder != NULL)
+    {
+        // Shader is a sort key of recorded commands, it is set on replay
+        rlRecorder->shaderId = id;
+        rlRecorder->shaderLocs = locs;
+        return;
+    }
+
     if (RLGL.State.currentShaderId != id)
     {
         rlDrawRenderBatch(RLGL.currentBatch);
@@ -4581,6 +6507,10 @@ static void rlLoadShaderDefault(void)
     "attribute vec4 vertexColor;        \n"
     "varying vec2 fragTexCoord;         \n"
     "varying vec4 fragColor;            \n"
+  #if defined(RLGL_MULTI_TEXTURE_BATCH)
+    "attribute float vertexTexIndex;    \n"
+    "varying float fragTexIndex;        \n"
+  #endif
 #elif defined(GRAPHICS_API_OPENGL_33)
     "#version 330                       \n"
     "in vec3 vertexPosition;            \n"
@@ -4588,6 +6518,10 @@ static void rlLoadShaderDefault(void)
     "in vec4 vertexColor;               \n"
     "out vec2 fragTexCoord;             \n"
     "out vec4 fragColor;                \n"
+  #if defined(RLGL_MULTI_TEXTURE_BATCH)
+    "in float vertexTexIndex;           \n"
+    "out float fragTexIndex;            \n"
+  #endif
 #endif
 #if defined(GRAPHICS_API_OPENGL_ES2)
     "#version 100                       \n"
@@ -4597,15 +6531,56 @@ static void rlLoadShaderDefault(void)
     "attribute vec4 vertexColor;        \n"
     "varying vec2 fragTexCoord;         \n"
     "varying vec4 fragColor;            \n"
+  #if defined(RLGL_MULTI_TEXTURE_BATCH)
+    "attribute float vertexTexIndex;    \n"
+    "varying float fragTexIndex;        \n"
+  #endif
 #endif
     "uniform mat4 mvp;                  \n"
     "void main()                        \n"
     "{                                  \n"
     "    fragTexCoord = vertexTexCoord; \n"
     "    fragColor = vertexColor;       \n"
+#if defined(RLGL_MULTI_TEXTURE_BATCH)
+    "    fragTexIndex = vertexTexIndex; \n"
+#endif
     "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
     "}                                  \n";
 
+#if defined(RLGL_MULTI_TEXTURE_BATCH)
+    // Fragment shader selecting the batch texture from the vertex texture index
+    // NOTE: GLSL 1.x/3.30 only allow indexing sampler arrays with constant expressions,
+    // so the selection is generated as an if-else chain over RL_DEFAULT_BATCH_TEXTURES samplers
+    #if defined(GRAPHICS_API_OPENGL_21)
+    const char *fShaderHeader = "#version 120\nvarying vec2 fragTexCoord;\nvarying vec4 fragColor;\nvarying float fragTexIndex;\n";
+    const char *fShaderSample = "texture2D";
+    const char *fShaderOutput = "gl_FragColor";
+    #elif defined(GRAPHICS_API_OPENGL_33)
+    const char *fShaderHeader = "#version 330\nin vec2 fragTexCoord;\nin vec4 fragColor;\nin float fragTexIndex;\nout vec4 finalColor;\n";
+    const char *fShaderSample = "texture";
+    const char *fShaderOutput = "finalColor";
+    #endif
+    #if defined(GRAPHICS_API_OPENGL_ES2)
+    const char *fShaderHeader = "#version 100\nprecision mediump float;\nvarying vec2 fragTexCoord;\nvarying vec4 fragColor;\nvarying float fragTexIndex;\n";
+    const char *fShaderSample = "texture2D";
+    const char *fShaderOutput = "gl_FragColor";
+    #endif
+
+    char defaultFShaderCode[4096] = { 0 };
+    int codeLength = snprintf(defaultFShaderCode, sizeof(defaultFShaderCode),
+        "%suniform sampler2D batchTextures[%i];\nuniform vec4 colDiffuse;\nvoid main()\n{\n    vec4 texelColor;\n",
+        fShaderHeader, RL_DEFAULT_BATCH_TEXTURES);
+
+    for (int i = 0; i < RL_DEFAULT_BATCH_TEXTURES; i++)
+    {
+        if (i < (RL_DEFAULT_BATCH_TEXTURES - 1)) codeLength += snprintf(defaultFShaderCode + codeLength, sizeof(defaultFShaderCode) - codeLength,
+            "    %sif (fragTexIndex < %i.5) texelColor = %s(batchTextures[%i], fragTexCoord);\n", (i > 0)? "else " : "", i, fShaderSample, i);
+        else codeLength += snprintf(defaultFShaderCode + codeLength, sizeof(defaultFShaderCode) - codeLength,
+            "    %stexelColor = %s(batchTextures[%i], fragTexCoord);\n", (i > 0)? "else " : "", fShaderSample, i);
+    }
+
+    snprintf(defaultFShaderCode + codeLength, sizeof(defaultFShaderCode) - codeLength, "    %s = texelColor*colDiffuse*fragColor;\n}\n", fShaderOutput);
+#else
     // Fragment shader directly defined, no external file required
     const char *defaultFShaderCode =
 #if defined(GRAPHICS_API_OPENGL_21)
@@ -4645,6 +6620,7 @@ static void rlLoadShaderDefault(void)
     "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
     "}                                  \n";
 #endif
+#endif  // RLGL_MULTI_TEXTURE_BATCH
 
     // NOTE: Compiled vertex/fragment shaders are not deleted,
     // they are kept for re-use as default shaders in case some shader loading fails
@@ -4665,7 +6641,23 @@ static void rlLoadShaderDefault(void)
         // Set default shader locations: uniform locations
         RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MATRIX_MVP]  = glGetUniformLocation(RLGL.State.defaultShaderId, "mvp");
         RLGL.State.defaultShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE] = glGetUniformLocation(RLGL.State.defaultShaderId, "colDiffuse");
+#if defined(RLGL_MULTI_TEXTURE_BATCH)
+        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE] = glGetUniformLocation(RLGL.State.defaultShaderId, "batchTextures");
+
+        // Batch textures samplers read consecutive texture units, set once for the program
+        int textureUnits[RL_DEFAULT_BATCH_TEXTURES] = { 0 };
+        for (int i = 0; i < RL_DEFAULT_BATCH_TEXTURES; i++) textureUnits[i] = i;
+
+        glUseProgram(RLGL.State.defaultShaderId);
+        glUniform1iv(RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], RL_DEFAULT_BATCH_TEXTURES, textureUnits);
+        glUseProgram(0);
+
+        GLint maxTextureUnits = 0;
+        glGetIntegerv(GL_MAX_TEXTURE_IMAGE_UNITS, &maxTextureUnits);
+        if (maxTextureUnits < RL_DEFAULT_BATCH_TEXTURES) TRACELOG(RL_LOG_WARNING, "SHADER: Batch textures (%i) exceed GPU texture units (%i)", RL_DEFAULT_BATCH_TEXTURES, maxTextureUnits);
+#else
         RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE] = glGetUniformLocation(RLGL.State.defaultShaderId, "texture0");
+#endif
     }
     else TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to load default shader", RLGL.State.defaultShaderId);
 }
@@ -4856,4 +6848,74 @@ static Matrix rlMatrixMultiply(Matrix left, Matrix right)
     return result;
 }
 
+// Get translation matrix
+static Matrix rlMatrixTranslate(float x, float y, float z)
+{
+    Matrix result = {
+        1.0f, 0.0f, 0.0f, x,
+        0.0f, 1.0f, 0.0f, y,
+        0.0f, 0.0f, 1.0f, z,
+        0.0f, 0.0f, 0.0f, 1.0f
+    };
+
+    return result;
+}
+
+// Get rotation matrix
+// NOTE: The provided angle must be in degrees
+static Matrix rlMatrixRotate(float angle, float x, float y, float z)
+{
+    Matrix result = rlMatrixIdentity();
+
+    // Axis vector (x, y, z) normalization
+    float lengthSquared = x*x + y*y + z*z;
+    if ((lengthSquared != 1.0f) && (lengthSquared != 0.0f))
+    {
+        float inverseLength = 1.0f/sqrtf(lengthSquared);
+        x *= inverseLength;
+        y *= inverseLength;
+        z *= inverseLength;
+    }
+
+    // Rotation matrix generation
+    float sinres = sinf(DEG2RAD*angle);
+    float cosres = cosf(DEG2RAD*angle);
+    float t = 1.0f - cosres;
+
+    result.m0 = x*x*t + cosres;
+    result.m1 = y*x*t + z*sinres;
+    result.m2 = z*x*t - y*sinres;
+    result.m3 = 0.0f;
+
+    result.m4 = x*y*t - z*sinres;
+    result.m5 = y*y*t + cosres;
+    result.m6 = z*y*t + x*sinres;
+    result.m7 = 0.0f;
+
+    result.m8 = x*z*t + y*sinres;
+    result.m9 = y*z*t - x*sinres;
+    result.m10 = z*z*t + cosres;
+    result.m11 = 0.0f;
+
+    result.m12 = 0.0f;
+    result.m13 = 0.0f;
+    result.m14 = 0.0f;
+    result.m15 = 1.0f;
+
+    return result;
+}
+
+// Get scaling matrix
+static Matrix rlMatrixScale(float x, float y, float z)
+{
+    Matrix result = {
+        x, 0.0f, 0.0f, 0.0f,
+        0.0f, y, 0.0f, 0.0f,
+        0.0f, 0.0f, z, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    };
+
+    return result;
+}
+
 #endif  // RLGL_IMPLEMENTATION
@@ -55,8 +55,9 @@
 
 #include <stdio.h>          // Required for: sprintf()
 #include <stdlib.h>         // Required for: malloc(), free()
-#include <string.h>         // Required for: memcmp(), strlen()
+#include <string.h>         // Required for: memcmp(), strlen(), memcpy(), memset()
 #include <math.h>           // Required for: sinf(), cosf(), sqrtf(), fabsf()
+#include <stdint.h>         // Required for: SIZE_MAX
 
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
     #define TINYOBJ_MALLOC RL_MALLOC
@@ -136,12 +137,19 @@
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Mesh bounding box, cached for frustum culling
+typedef struct MeshBounds {
+    const float *vertices;          // Mesh vertex data, used as key (NULL for empty slots)
+    BoundingBox box;                // Mesh bounding box
+} MeshBounds;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// ...
+static bool meshCulling = false;    // Frustum culling of DrawMesh() enabled
+static MeshBounds *meshBounds = NULL;   // Mesh bounding boxes, open addressing hash table keyed by vertex data
+static size_t meshBoundsCapacity = 0;   // Mesh bounding boxes table size (power of two)
+static size_t meshBoundsCount = 0;      // Mesh bounding boxes cached
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
@@ -168,6 +176,13 @@ static ModelAnimation *LoadModelAnimationsM3D(const char *fileName, int *animCou
 static void ProcessMaterialsOBJ(Material *rayMaterials, tinyobj_material_t *materials, int materialCount);  // Process obj materials
 #endif
 
+static size_t GetMeshBoundsHome(const float *vertices); // Get mesh bounds table home slot of vertex data
+static size_t GetMeshBoundsSlot(const float *vertices); // Get mesh bounds table slot for vertex data (found or empty)
+static BoundingBox GetMeshBoundsCached(Mesh mesh);      // Get mesh bounding box, computed on first request
+static void RemoveMeshBounds(const float *vertices);    // Remove mesh bounding box from cache
+static bool CheckMeshInFrustum(Mesh mesh, Matrix transform);   // Check if mesh is visible, always true if culling is disabled
+static void DrawMeshElements(Mesh mesh, Material material, Matrix transform, int offset, int count);  // Draw a range of mesh elements
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition
 //----------------------------------------------------------------------------------
@@ -1292,10 +1307,42 @@ void UploadMesh(Mesh *mesh, bool dynamic)
 void UpdateMeshBuffer(Mesh mesh, int index, const void *data, int dataSize, int offset)
 {
     rlUpdateVertexBuffer(mesh.vboId[index], data, dataSize, offset);
+
+    // Vertex positions changed, bounding box is computed again on next draw
+    if (index == 0) RemoveMeshBounds(mesh.vertices);
+}
+
+// Enable frustum culling, DrawMesh() skips meshes outside of view frustum
+// NOTE: Mesh bounding boxes are computed from vertex data (mesh.vertices) and cached,
+// meshes displaced by vertex shaders or skinned for animation (mesh.animVertices) are not culled
+void EnableMeshCulling(void)
+{
+    meshCulling = true;
+}
+
+// Disable frustum culling
+void DisableMeshCulling(void)
+{
+    meshCulling = false;
+}
+
+// Check if frustum culling is enabled
+bool IsMeshCullingEnabled(void)
+{
+    return meshCulling;
 }
 
 // Draw a 3d mesh with material and transform
 void DrawMesh(Mesh mesh, Material material, Matrix transform)
+{
+    // Skip mesh if its bounding box is outside of view frustum
+    if (!CheckMeshInFrustum(mesh, transform)) return;
+
+    DrawMeshElements(mesh, material, transform, 0, (mesh.indices != NULL)? mesh.triangleCount*3 : mesh.vertexCount);
+}
+
+// Draw a range of mesh elements (indices or vertices if not indexed) with material and transform
+static void DrawMeshElements(Mesh mesh, Material material, Matrix transform, int offset, int count)
 {
 #if defined(GRAPHICS_API_OPENGL_11)
     #define GL_VERTEX_ARRAY         0x8074
@@ -1317,8 +1364,8 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
                    material.maps[MATERIAL_MAP_DIFFUSE].color.b,
                    material.maps[MATERIAL_MAP_DIFFUSE].color.a);
 
-        if (mesh.indices != NULL) rlDrawVertexArrayElements(0, mesh.triangleCount*3, mesh.indices);
-        else rlDrawVertexArray(0, mesh.vertexCount);
+        if (mesh.indices != NULL) rlDrawVertexArrayElements(offset, count, mesh.indices);
+        else rlDrawVertexArray(offset, count);
     rlPopMatrix();
 
     rlDisableStatePointer(GL_VERTEX_ARRAY);
@@ -1492,8 +1539,8 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
         rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MVP], matModelViewProjection);
 
         // Draw mesh
-        if (mesh.indices != NULL) rlDrawVertexArrayElements(0, mesh.triangleCount*3, 0);
-        else rlDrawVertexArray(0, mesh.vertexCount);
+        if (mesh.indices != NULL) rlDrawVertexArrayElements(offset, count, 0);
+        else rlDrawVertexArray(offset, count);
     }
 
     // Unbind all bound texture maps
@@ -1750,6 +1797,8 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
 // Unload mesh from memory (RAM and VRAM)
 void UnloadMesh(Mesh mesh)
 {
+    RemoveMeshBounds(mesh.vertices);
+
     // Unload rlgl mesh vboId data
     rlUnloadVertexArray(mesh.vaoId);
 
@@ -1770,6 +1819,182 @@ void UnloadMesh(Mesh mesh)
     RL_FREE(mesh.boneIds);
 }
 
+// Load static batch, meshes sharing a material are merged into few large meshes with their transforms applied
+// NOTE: Merged meshes use 16bit indices, they are split in chunks of up to 65536 vertices, meshes bigger
+// than that are skipped; texcoords and normals are kept if all meshes provide them, colors if any does
+StaticBatch LoadStaticBatch(const Mesh *meshes, const Matrix *transforms, int count, Material material)
+{
+    #define MAX_STATIC_BATCH_VERTICES   65536
+
+    StaticBatch batch = { 0 };
+    batch.material = material;
+
+    if ((meshes == NULL) || (count <= 0)) return batch;
+
+    batch.rangeCount = count;
+    batch.ranges = (StaticBatchRange *)RL_CALLOC(count, sizeof(StaticBatchRange));
+
+    // First pass: assign meshes to chunks and find the vertex attributes to keep
+    bool texcoords = true;
+    bool normals = true;
+    bool colors = false;
+    int chunkVertices = MAX_STATIC_BATCH_VERTICES;
+    int chunkElements = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        const Mesh *mesh = &meshes[i];
+        int elements = (mesh->indices != NULL)? mesh->triangleCount*3 : mesh->vertexCount;
+        elements -= elements%3;     // Trailing vertices of non-indexed meshes make no triangle, they are not drawn
+
+        if ((mesh->vertices == NULL) || (mesh->vertexCount <= 0) || (elements <= 0)) continue;
+        if (mesh->vertexCount > MAX_STATIC_BATCH_VERTICES)
+        {
+            TRACELOG(LOG_WARNING, "MESH: Static batch mesh %i skipped, too many vertices (%i)", i, mesh->vertexCount);
+            continue;
+        }
+
+        if (chunkVertices + mesh->vertexCount > MAX_STATIC_BATCH_VERTICES)
+        {
+            batch.meshCount++;
+            chunkVertices = 0;
+            chunkElements = 0;
+        }
+
+        batch.ranges[i] = (StaticBatchRange){ batch.meshCount - 1, chunkElements, elements };
+        chunkVertices += mesh->vertexCount;
+        chunkElements += elements;
+
+        if (mesh->texcoords == NULL) texcoords = false;
+        if (mesh->normals == NULL) normals = false;
+        if (mesh->colors != NULL) colors = true;
+    }
+
+    if (batch.meshCount == 0) return batch;
+
+    batch.meshes = (Mesh *)RL_CALLOC(batch.meshCount, sizeof(Mesh));
+
+    // Second pass: count chunks data and allocate it
+    for (int i = 0; i < count; i++)
+    {
+        if (batch.ranges[i].count == 0) continue;
+
+        Mesh *chunk = &batch.meshes[batch.ranges[i].mesh];
+        chunk->vertexCount += meshes[i].vertexCount;
+        chunk->triangleCount += batch.ranges[i].count/3;
+    }
+
+    for (int m = 0; m < batch.meshCount; m++)
+    {
+        Mesh *chunk = &batch.meshes[m];
+        chunk->vertices = (float *)RL_MALLOC(chunk->vertexCount*3*sizeof(float));
+        if (texcoords) chunk->texcoords = (float *)RL_MALLOC(chunk->vertexCount*2*sizeof(float));
+        if (normals) chunk->normals = (float *)RL_MALLOC(chunk->vertexCount*3*sizeof(float));
+        if (colors) chunk->colors = (unsigned char *)RL_MALLOC(chunk->vertexCount*4*sizeof(unsigned char));
+        chunk->indices = (unsigned short *)RL_MALLOC(chunk->triangleCount*3*sizeof(unsigned short));
+        chunk->vertexCount = 0;
+    }
+
+    // Third pass: copy vertex data transformed, indices are offset by the vertices already in the chunk
+    for (int i = 0; i < count; i++)
+    {
+        if (batch.ranges[i].count == 0) continue;
+
+        const Mesh *mesh = &meshes[i];
+        Mesh *chunk = &batch.meshes[batch.ranges[i].mesh];
+        Matrix transform = (transforms != NULL)? transforms[i] : MatrixIdentity();
+        Matrix normalMatrix = MatrixTranspose(MatrixInvert(transform));
+        normalMatrix.m12 = 0.0f;
+        normalMatrix.m13 = 0.0f;
+        normalMatrix.m14 = 0.0f;
+        int base = chunk->vertexCount;
+
+        for (int v = 0; v < mesh->vertexCount; v++)
+        {
+            Vector3 position = { mesh->vertices[v*3], mesh->vertices[v*3 + 1], mesh->vertices[v*3 + 2] };
+            position = Vector3Transform(position, transform);
+            chunk->vertices[(base + v)*3] = position.x;
+            chunk->vertices[(base + v)*3 + 1] = position.y;
+            chunk->vertices[(base + v)*3 + 2] = position.z;
+
+            if (normals)
+            {
+                Vector3 normal = { mesh->normals[v*3], mesh->normals[v*3 + 1], mesh->normals[v*3 + 2] };
+                normal = Vector3Normalize(Vector3Transform(normal, normalMatrix));
+                chunk->normals[(base + v)*3] = normal.x;
+                chunk->normals[(base + v)*3 + 1] = normal.y;
+                chunk->normals[(base + v)*3 + 2] = normal.z;
+            }
+        }
+
+        if (texcoords) memcpy(chunk->texcoords + base*2, mesh->texcoords, mesh->vertexCount*2*sizeof(float));
+        if (colors)
+        {
+            if (mesh->colors != NULL) memcpy(chunk->colors + base*4, mesh->colors, mesh->vertexCount*4*sizeof(unsigned char));
+            else memset(chunk->colors + base*4, 255, mesh->vertexCount*4*sizeof(unsigned char));
+        }
+
+        unsigned short *indices = chunk->indices + batch.ranges[i].offset;
+        if (mesh->indices != NULL) for (int e = 0; e < batch.ranges[i].count; e++) indices[e] = (unsigned short)(base + mesh->indices[e]);
+        else for (int e = 0; e < batch.ranges[i].count; e++) indices[e] = (unsigned short)(base + e);
+
+        chunk->vertexCount += mesh->vertexCount;
+    }
+
+    for (int m = 0; m < batch.meshCount; m++) UploadMesh(&batch.meshes[m], false);
+
+    TRACELOG(LOG_INFO, "MESH: Static batch loaded, %i meshes merged into %i", count, batch.meshCount);
+
+    return batch;
+}
+
+// Unload static batch merged meshes from memory (RAM and VRAM)
+// NOTE: Material is not unloaded, it was provided on loading
+void UnloadStaticBatch(StaticBatch batch)
+{
+    for (int m = 0; m < batch.meshCount; m++) UnloadMesh(batch.meshes[m]);
+
+    RL_FREE(batch.meshes);
+    RL_FREE(batch.ranges);
+}
+
+// Draw static batch, one draw call per merged mesh
+void DrawStaticBatch(StaticBatch batch, Matrix transform)
+{
+    for (int m = 0; m < batch.meshCount; m++) DrawMesh(batch.meshes[m], batch.material, transform);
+}
+
+// Draw a range of the meshes merged into static batch, by their order on loading
+// NOTE: Consecutive meshes in the same merged mesh are drawn together with one draw call
+void DrawStaticBatchRange(StaticBatch batch, int first, int count, Matrix transform)
+{
+    if (first < 0) first = 0;
+    if (first + count > batch.rangeCount) count = batch.rangeCount - first;
+
+    int mesh = -1;
+    int offset = 0;
+    int elements = 0;
+
+    for (int i = first; i <= first + count; i++)
+    {
+        StaticBatchRange range = (i < first + count)? batch.ranges[i] : (StaticBatchRange){ -1, 0, 0 };
+        if ((i < first + count) && (range.count == 0)) continue;
+
+        // Extend current draw while ranges are contiguous, draw it otherwise
+        if ((range.mesh == mesh) && (range.offset == offset + elements))
+        {
+            elements += range.count;
+            continue;
+        }
+
+        if ((elements > 0) && CheckMeshInFrustum(batch.meshes[mesh], transform)) DrawMeshElements(batch.meshes[mesh], batch.material, transform, offset, elements);
+
+        mesh = range.mesh;
+        offset = range.offset;
+        elements = range.count;
+    }
+}
+
 // Export mesh data to file
 bool ExportMesh(Mesh mesh, const char *fileName)
 {
@@ -3885,6 +4110,119 @@ RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Ve
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+// Get mesh bounds table home slot of vertex data, where its probe sequence starts
+static size_t GetMeshBoundsHome(const float *vertices)
+{
+    // Fibonacci hashing of the pointer, low bits are always zero because of allocation alignment
+    unsigned long long hash = ((unsigned long long)(size_t)vertices >> 4)*11400714819323198485ull;
+
+    return (size_t)(hash >> 32) & (meshBoundsCapacity - 1);
+}
+
+// Get mesh bounds table slot for vertex data, the slot holding it or the empty slot ending its probe sequence
+// NOTE: Table must have at least one empty slot
+static size_t GetMeshBoundsSlot(const float *vertices)
+{
+    size_t slot = GetMeshBoundsHome(vertices);
+
+    while ((meshBounds[slot].vertices != NULL) && (meshBounds[slot].vertices != vertices)) slot = (slot + 1) & (meshBoundsCapacity - 1);
+
+    return slot;
+}
+
+// Get mesh bounding box, computed on first request
+static BoundingBox GetMeshBoundsCached(Mesh mesh)
+{
+    if (meshBoundsCapacity > 0)
+    {
+        size_t slot = GetMeshBoundsSlot(mesh.vertices);
+        if (meshBounds[slot].vertices != NULL) return meshBounds[slot].box;
+    }
+
+    // Grow table when half full, entries are inserted again into the new one
+    // NOTE: If the table can't grow, bounding box is computed without caching it
+    if (2*(meshBoundsCount + 1) > meshBoundsCapacity)
+    {
+        MeshBounds *previous = meshBounds;
+        size_t previousCapacity = meshBoundsCapacity;
+        size_t capacity = (previousCapacity == 0)? 64 : 2*previousCapacity;
+
+        MeshBounds *table = NULL;
+        if ((capacity > previousCapacity) && (capacity <= SIZE_MAX/sizeof(MeshBounds))) table = (MeshBounds *)RL_CALLOC(capacity, sizeof(MeshBounds));
+
+        if (table == NULL)
+        {
+            TRACELOG(LOG_WARNING, "MESH: Failed to grow bounding boxes cache, computing bounds uncached");
+            return GetMeshBoundingBox(mesh);
+        }
+
+        meshBounds = table;
+        meshBoundsCapacity = capacity;
+
+        for (size_t i = 0; i < previousCapacity; i++)
+        {
+            if (previous[i].vertices != NULL) meshBounds[GetMeshBoundsSlot(previous[i].vertices)] = previous[i];
+        }
+
+        RL_FREE(previous);
+    }
+
+    size_t slot = GetMeshBoundsSlot(mesh.vertices);
+    meshBounds[slot].vertices = mesh.vertices;
+    meshBounds[slot].box = GetMeshBoundingBox(mesh);
+    meshBoundsCount++;
+
+    return meshBounds[slot].box;
+}
+
+// Remove mesh bounding box from cache
+// NOTE: Following entries of the probe sequence are moved back, so no lookup stops at the emptied slot
+static void RemoveMeshBounds(const float *vertices)
+{
+    if ((vertices == NULL) || (meshBoundsCount == 0)) return;
+
+    size_t slot = GetMeshBoundsSlot(vertices);
+    if (meshBounds[slot].vertices == NULL) return;
+
+    size_t mask = meshBoundsCapacity - 1;
+    size_t next = (slot + 1) & mask;
+
+    while (meshBounds[next].vertices != NULL)
+    {
+        // Move entry back if its home slot is not between the emptied slot and its current one (cyclically)
+        size_t home = GetMeshBoundsHome(meshBounds[next].vertices);
+
+        if (((next - home) & mask) >= ((next - slot) & mask))
+        {
+            meshBounds[slot] = meshBounds[next];
+            slot = next;
+        }
+
+        next = (next + 1) & mask;
+    }
+
+    meshBounds[slot].vertices = NULL;
+    meshBoundsCount--;
+
+    // Release table once all meshes are unloaded
+    if (meshBoundsCount == 0)
+    {
+        RL_FREE(meshBounds);
+        meshBounds = NULL;
+        meshBoundsCapacity = 0;
+    }
+}
+
+// Check mesh bounding box against view frustum, always true if culling is disabled
+// NOTE: Culled and checked meshes are counted in rlGetFrameStats()
+static bool CheckMeshInFrustum(Mesh mesh, Matrix transform)
+{
+    if (!meshCulling || (mesh.vertices == NULL) || (mesh.animVertices != NULL)) return true;
+
+    BoundingBox box = GetMeshBoundsCached(mesh);
+    return rlCheckBoxInFrustum(transform, box.min.x, box.min.y, box.min.z, box.max.x, box.max.y, box.max.z);
+}
+
 #if defined(SUPPORT_FILEFORMAT_IQM) || defined(SUPPORT_FILEFORMAT_GLTF)
 // Build pose from parent joints
 // NOTE: Required for animations loading (required by IQM and GLTF)
@@ -1078,6 +1078,32 @@ void DrawFPS(int posX, int posY)
     DrawText(TextFormat("%2i FPS", fps), posX, posY, 20, color);
 }
 
+// Draw last frame statistics: draw calls, vertices, batch flushes, binds and timings
+// NOTE: Uses default font, GPU times shown only when enabled with rlEnableGpuTiming()
+void DrawFrameStats(int posX, int posY)
+{
+    rlFrameStats stats = rlGetFrameStats();
+    int fontSize = 10;
+    int lineHeight = 12;
+
+    DrawText(TextFormat("draw calls: %i  flushes: %i", stats.drawCalls, stats.batchFlushes), posX, posY, fontSize, LIME);
+    DrawText(TextFormat("vertices: %i", stats.vertexCount), posX, posY + lineHeight, fontSize, LIME);
+    DrawText(TextFormat("texture binds: %i  shaders: %i", stats.textureBinds, stats.shaderSwitches), posX, posY + 2*lineHeight, fontSize, LIME);
+    DrawText(TextFormat("culled: %i/%i", stats.culledCount, stats.cullTests), posX, posY + 3*lineHeight, fontSize, LIME);
+    DrawText(TextFormat("cpu: %.2f ms", stats.cpuTime), posX, posY + 4*lineHeight, fontSize, LIME);
+
+    if (rlIsGpuTimingEnabled())
+    {
+        DrawText(TextFormat("gpu: %.2f ms", stats.gpuTime), posX, posY + 5*lineHeight, fontSize, LIME);
+
+        for (int i = 0; i < stats.gpuScopeCount; i++)
+        {
+            DrawText(TextFormat("%s: %.2f ms", stats.gpuScopes[i].name, stats.gpuScopes[i].time),
+                posX + 10*(stats.gpuScopes[i].depth + 1), posY + (6 + i)*lineHeight, fontSize, LIME);
+        }
+    }
+}
+
 // Draw text (using default font)
 // NOTE: fontSize work like in any drawing program but if fontSize is lower than font-base-size, then font-base-size is used
 // NOTE: chars spacing is proportional to fontSize
@@ -34,6 +34,10 @@
 *       #define SUPPORT_IMAGE_GENERATION
 *           Support procedural image generation functionality (gradient, spot, perlin-noise, cellular)
 *
+*       #define SUPPORT_IMAGE_THREADS
+*           Support splitting the processing of large images in row ranges run by worker threads,
+*           threads are created per call, no pool is kept alive between calls
+*
 *   DEPENDENCIES:
 *       stb_image        - Multiple image formats loading (JPEG, PNG, BMP, TGA, PSD, GIF, PIC)
 *                          NOTE: stb_image has been slightly modified to support Android platform.
@@ -128,6 +132,31 @@
     #define STBI_NO_SIMD
 #endif
 
+// SIMD instruction sets used by pixel format conversion kernels, the ones always available on target
+#if !defined(__TINYC__)
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #define RL_TEXTURES_SSE2
+        #include <emmintrin.h>      // Required for: SSE2 intrinsics [Used in ConvertPixelsKernel()]
+    #elif defined(__ARM_NEON) && defined(__aarch64__)
+        #define RL_TEXTURES_NEON
+        #include <arm_neon.h>       // Required for: NEON intrinsics [Used in ConvertPixelsKernel()]
+    #endif
+#endif
+
+#if defined(SUPPORT_IMAGE_THREADS)
+    #if defined(_WIN32)
+        #include <process.h>        // Required for: _beginthreadex() [Used in ParallelFor()]
+
+        // NOTE: Declaring required Win32 functions to avoid including windows.h
+        __declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *hHandle, unsigned long dwMilliseconds);
+        __declspec(dllimport) int __stdcall CloseHandle(void *hObject);
+        __declspec(dllimport) unsigned long __stdcall GetActiveProcessorCount(unsigned short groupNumber);
+    #else
+        #include <pthread.h>        // Required for: pthread_create(), pthread_join() [Used in ParallelFor()]
+        #include <unistd.h>         // Required for: sysconf() [Used in GetImageThreadCount()]
+    #endif
+#endif
+
 #if (defined(SUPPORT_FILEFORMAT_BMP) || \
      defined(SUPPORT_FILEFORMAT_PNG) || \
      defined(SUPPORT_FILEFORMAT_TGA) || \
@@ -234,15 +263,119 @@
     #define GAUSSIAN_BLUR_ITERATIONS  4    // Number of box blur iterations to approximate gaussian blur
 #endif
 
+#ifndef PIXEL_CONVERT_CHUNK_SIZE
+    #define PIXEL_CONVERT_CHUNK_SIZE  256  // Pixels converted at once through conversion tables
+#endif
+
+#ifndef IMAGE_MAX_THREADS
+    #define IMAGE_MAX_THREADS           8  // Maximum threads processing an image, including calling thread
+#endif
+#ifndef IMAGE_PARALLEL_MIN_PIXELS
+    #define IMAGE_PARALLEL_MIN_PIXELS  65536  // Minimum pixels processed by every thread, smaller images run on calling thread
+#endif
+
+#ifndef IMAGE_COLOR_MAX_STAGES
+    #define IMAGE_COLOR_MAX_STAGES      8  // Maximum stages of a fused color operations pass, more stages require more passes
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Pixel format conversion tables, indexed by source channel code (r, g, b, a)
+typedef struct PixelConvertTables {
+    float normalized[4][256];           // Channel values normalized
+    float gray[3][256];                 // Channel values normalized and weighted for grayscale (0.299f, 0.587f, 0.114f)
+    unsigned short packed[4][256];      // Channel values in destination format: 8 bit, shifted into 16 bit pixel or half float
+} PixelConvertTables;
+
+// Image rows range processing function, called by ParallelFor()
+typedef void (*ImageRowsFunc)(int start, int end, void *data);
+
+// Image rows range processed by a thread
+typedef struct ImageRowsJob {
+    ImageRowsFunc func;                 // Function processing the rows
+    void *data;                         // Data shared by all ranges
+    int start;                          // First row of the range
+    int end;                            // Row after last row of the range
+} ImageRowsJob;
+
+// Image drawing rows data, shared by all rows ranges
+typedef struct ImageDrawRowsData {
+    unsigned char *srcBase;             // Source first pixel to draw
+    unsigned char *dstBase;             // Destination first pixel to draw into
+    int srcStride;                      // Source bytes per row
+    int dstStride;                      // Destination bytes per row
+    int srcFormat;                      // Source pixel format
+    int dstFormat;                      // Destination pixel format
+    int srcBytesPerPixel;               // Source bytes per pixel
+    int dstBytesPerPixel;               // Destination bytes per pixel
+    int width;                          // Pixels drawn per row
+    Color tint;                         // Tint applied to source, premultiplied for BLEND_ALPHA_PREMULTIPLY
+    int blendMode;                      // Blend mode: BLEND_ALPHA or BLEND_ALPHA_PREMULTIPLY
+    bool blendRequired;                 // Blend required, otherwise source is copied
+} ImageDrawRowsData;
+
+// Image color operations fused pass stage
+// NOTE: Consecutive per channel operations (tint, invert, contrast, brightness) are composed in one lookup table
+typedef struct ImageColorStage {
+    int type;                           // Stage type: IMAGE_COLOR_TINT (channels lookup table), IMAGE_COLOR_GRAYSCALE or IMAGE_COLOR_REPLACE
+    unsigned char table[4][256];        // Channels lookup table, indexed by channel (r, g, b, a) and value
+    Color color;                        // Color to replace
+    Color replace;                      // Replacement color
+} ImageColorStage;
+
+// Image color operations rows data, shared by all rows ranges
+typedef struct ImageColorRowsData {
+    unsigned char *data;                // Image pixel data
+    int format;                         // Image pixel format
+    int width;                          // Pixels per row
+    int stride;                         // Bytes per row
+    int bytesPerPixel;                  // Bytes per pixel
+    const ImageColorStage *stages;      // Stages applied in order
+    int stageCount;                     // Stages count
+    const float (*gray)[256];           // Channel values normalized and weighted for grayscale, as ImageFormat() does
+    const PixelConvertTables *toColors; // Conversion tables from image format to R8G8B8A8, NULL to use GetPixelColor()
+    const PixelConvertTables *fromColors;   // Conversion tables from R8G8B8A8 to image format
+} ImageColorRowsData;
+
+// Image generation rows data, shared by all rows ranges
+// NOTE: Generated pixels are a region of a larger image, noise is a function of pixel position in the larger image
+typedef struct ImageGenRowsData {
+    Color *pixels;                      // Generated region pixels
+    int width;                          // Generated image width
+    int height;                         // Generated image height
+    int recX;                           // Region position in generated image
+    int recY;
+    int recWidth;                       // Region size
+    int recHeight;
+    float factor;                       // White noise: factor of white pixels
+    unsigned int seed;                  // White noise: random seed
+    int offsetX;                        // Perlin noise: offset
+    int offsetY;
+    float scale;                        // Perlin noise: scale
+    int tileSize;                       // Cellular: cell size, one seed per cell
+    int cellsPerRow;                    // Cellular: cells per row in generated image
+    int cellsPerCol;                    // Cellular: cells per column in generated image
+    const Vector2 *seeds;               // Cellular: seeds of cells around region
+    int seedsX;                         // Cellular: first cell of seeds
+    int seedsY;
+    int seedsPerRow;                    // Cellular: seeds per row
+} ImageGenRowsData;
+
+// Image box downsampling rows data, shared by all rows ranges
+typedef struct ImageBoxRowsData {
+    const unsigned char *src;           // Source pixel data
+    unsigned char *dst;                 // Destination pixel data
+    int srcWidth;                       // Source width, 1 or twice destination width
+    int srcHeight;                      // Source height, 1 or twice destination height
+    int dstWidth;                       // Destination width
+    int channels;                       // Channels per pixel, 8 bit each
+} ImageBoxRowsData;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// It's lonely here...
+static int imageThreadCount = 0;        // Threads processing an image, 0 for one per CPU core
 
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
@@ -255,6 +388,31 @@ extern void LoadFontDefault(void);          // [Module: text] Loads default font
 static float HalfToFloat(unsigned short x);
 static unsigned short FloatToHalf(float x);
 static Vector4 *LoadImageDataNormalized(Image image);       // Load pixel data from image as Vector4 array (float normalized)
+static void *LoadImageDataFormatted(Image image, int format);   // Load pixel data converted to another uncompressed format (up to 8 bit per channel sources)
+static bool GetPixelChannelBits(int format, int *bits);     // Get channel bits of uncompressed formats with up to 8 bit per channel
+static bool InitPixelConvertTables(PixelConvertTables *tables, int srcFormat, int dstFormat);  // Init pixel conversion tables for a formats pair
+static void ConvertPixelsTables(const void *src, int srcFormat, void *dst, int dstFormat, int offset, int count, const PixelConvertTables *tables);  // Convert pixels through conversion tables
+static int ConvertPixelsKernel(const void *src, int srcFormat, void *dst, int dstFormat, int count);  // Convert pixels with a specialized kernel, returns pixels converted
+static void ParallelFor(int count, int minCount, ImageRowsFunc func, void *data);   // Process rows [0, count) split in ranges of at least minCount rows run by worker threads
+static Color ColorAlphaBlendPremultiplied(Color dst, Color src, Color tint);        // Blend premultiplied source color over destination color, tint already premultiplied
+static void BlendRowRGBA(Color *dst, const Color *src, int count, Color tint);      // Blend straight alpha R8G8B8A8 row over R8G8B8A8 row
+static void BlendRowRGBAPremultiplied(Color *dst, const Color *src, int count, Color tint);  // Blend premultiplied R8G8B8A8 row over R8G8B8A8 row
+static void ImageDrawRows(int start, int end, void *data);  // Draw a range of rows of ImageDrawBlend()
+static void ResizePixelsLinear(const unsigned char *input, int width, int height, unsigned char *output, int newWidth, int newHeight, int layout);  // Resize 8 bit per channel pixels, in splits run by worker threads for large images
+static void ResizeSplits(int start, int end, void *data);   // Resize a range of splits of ResizePixelsLinear()
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+static unsigned char ApplyColorOpChannel(ImageColorOp op, int channel, unsigned char value);    // Apply per channel color operation to a channel value
+static void ApplyColorStages(Color *pixels, int count, const ImageColorRowsData *rows);          // Apply color operations stages to pixels
+static void ImageColorRows(int start, int end, void *data);  // Apply color operations to a range of rows of ImageColorOps()
+static void DownsampleBoxRows(int start, int end, void *data);  // Downsample a range of rows by 2 with a box filter, for ImageMipmaps()
+#endif
+#if defined(SUPPORT_IMAGE_GENERATION)
+static bool InitImageGenRows(ImageGenRowsData *rows, int width, int height, Rectangle rec);  // Init generation rows data for a region of an image, allocating region pixels
+static unsigned int HashNoise(unsigned int x);              // Hash a value into noise bits
+static void GenWhiteNoiseRows(int start, int end, void *data);     // Generate a range of rows of white noise
+static void GenPerlinNoiseRows(int start, int end, void *data);    // Generate a range of rows of perlin noise
+static void GenCellularRows(int start, int end, void *data);       // Generate a range of rows of cellular noise
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -660,6 +818,37 @@ void UnloadImage(Image image)
     RL_FREE(image.data);
 }
 
+// Set threads processing large images
+// NOTE: 0 uses one thread per CPU core, 1 processes images on calling thread only
+void SetImageThreadCount(int count)
+{
+    imageThreadCount = (count < 0)? 0 : count;
+}
+
+// Get threads processing large images
+int GetImageThreadCount(void)
+{
+    int count = 1;
+
+#if defined(SUPPORT_IMAGE_THREADS)
+    count = imageThreadCount;
+
+    if (count == 0)
+    {
+    #if defined(_WIN32)
+        count = (int)GetActiveProcessorCount(0xffff);   // ALL_PROCESSOR_GROUPS
+    #elif defined(_SC_NPROCESSORS_ONLN)
+        count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    #endif
+    }
+
+    if (count < 1) count = 1;
+    if (count > IMAGE_MAX_THREADS) count = IMAGE_MAX_THREADS;
+#endif
+
+    return count;
+}
+
 // Export image data to file
 // NOTE: File format depends on fileName extension
 bool ExportImage(Image image, const char *fileName)
@@ -1010,21 +1199,28 @@ Image GenImageChecked(int width, int height, int checksX, int checksY, Color col
 // Generate image: white noise
 Image GenImageWhiteNoise(int width, int height, float factor)
 {
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    // NOTE: Seed is taken from raylib random generator, results are reproducible with SetRandomSeed()
+    unsigned int seed = (unsigned int)GetRandomValue(0, 0x7fff) | ((unsigned int)GetRandomValue(0, 0x7fff) << 15);
+
+    return GenImageWhiteNoiseRec(width, height, (Rectangle){ 0, 0, (float)width, (float)height }, factor, seed);
+}
+
+// Generate image: white noise, region of a width x height image
+// NOTE: Pixels only depend on seed and their position, tiles of any image size can be generated separately
+Image GenImageWhiteNoiseRec(int width, int height, Rectangle rec, float factor, unsigned int seed)
+{
+    Image image = { 0 };
+    ImageGenRowsData rows = { 0 };
 
-    for (int i = 0; i < width*height; i++)
+    if (InitImageGenRows(&rows, width, height, rec))
     {
-        if (GetRandomValue(0, 99) < (int)(factor*100.0f)) pixels[i] = WHITE;
-        else pixels[i] = BLACK;
-    }
+        rows.factor = factor;
+        rows.seed = seed;
 
-    Image image = {
-        .data = pixels,
-        .width = width,
-        .height = height,
-        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
-        .mipmaps = 1
-    };
+        ParallelFor(rows.recHeight, IMAGE_PARALLEL_MIN_PIXELS/rows.recWidth, GenWhiteNoiseRows, &rows);
+
+        image = (Image){ rows.pixels, rows.recWidth, rows.recHeight, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+    }
 
     return image;
 }
@@ -1032,109 +1228,115 @@ Image GenImageWhiteNoise(int width, int height, float factor)
 // Generate image: perlin noise
 Image GenImagePerlinNoise(int width, int height, int offsetX, int offsetY, float scale)
 {
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
-
-    for (int y = 0; y < height; y++)
-    {
-        for (int x = 0; x < width; x++)
-        {
-            float nx = (float)(x + offsetX)*(scale/(float)width);
-            float ny = (float)(y + offsetY)*(scale/(float)height);
-
-            // Basic perlin noise implementation (not used)
-            //float p = (stb_perlin_noise3(nx, ny, 0.0f, 0, 0, 0);
+    return GenImagePerlinNoiseRec(width, height, (Rectangle){ 0, 0, (float)width, (float)height }, offsetX, offsetY, scale);
+}
 
-            // Calculate a better perlin noise using fbm (fractal brownian motion)
-            // Typical values to start playing with:
-            //   lacunarity = ~2.0   -- spacing between successive octaves (use exactly 2.0 for wrapping output)
-            //   gain       =  0.5   -- relative weighting applied to each successive octave
-            //   octaves    =  6     -- number of "octaves" of noise3() to sum
-            float p = stb_perlin_fbm_noise3(nx, ny, 1.0f, 2.0f, 0.5f, 6);
+// Generate image: perlin noise, region of a width x height image
+// NOTE: Tiles generated separately match the same region of a complete image
+Image GenImagePerlinNoiseRec(int width, int height, Rectangle rec, int offsetX, int offsetY, float scale)
+{
+    Image image = { 0 };
+    ImageGenRowsData rows = { 0 };
 
-            // Clamp between -1.0f and 1.0f
-            if (p < -1.0f) p = -1.0f;
-            if (p > 1.0f) p = 1.0f;
+    if (InitImageGenRows(&rows, width, height, rec))
+    {
+        rows.offsetX = offsetX;
+        rows.offsetY = offsetY;
+        rows.scale = scale;
 
-            // We need to normalize the data from [-1..1] to [0..1]
-            float np = (p + 1.0f)/2.0f;
+        // NOTE: Perlin noise is expensive per pixel, rows ranges are split with less pixels
+        ParallelFor(rows.recHeight, IMAGE_PARALLEL_MIN_PIXELS/16/rows.recWidth, GenPerlinNoiseRows, &rows);
 
-            int intensity = (int)(np*255.0f);
-            pixels[y*width + x] = (Color){ intensity, intensity, intensity, 255 };
-        }
+        image = (Image){ rows.pixels, rows.recWidth, rows.recHeight, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
     }
 
-    Image image = {
-        .data = pixels,
-        .width = width,
-        .height = height,
-        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
-        .mipmaps = 1
-    };
-
     return image;
 }
 
 // Generate image: cellular algorithm. Bigger tileSize means bigger cells
 Image GenImageCellular(int width, int height, int tileSize)
 {
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    Image image = { 0 };
+    ImageGenRowsData rows = { 0 };
 
-    int seedsPerRow = width/tileSize;
-    int seedsPerCol = height/tileSize;
-    int seedCount = seedsPerRow*seedsPerCol;
+    if ((tileSize > 0) && InitImageGenRows(&rows, width, height, (Rectangle){ 0, 0, (float)width, (float)height }))
+    {
+        rows.tileSize = tileSize;
+        rows.cellsPerRow = width/tileSize;
+        rows.cellsPerCol = height/tileSize;
+        rows.seedsPerRow = rows.cellsPerRow;
 
-    Vector2 *seeds = (Vector2 *)RL_MALLOC(seedCount*sizeof(Vector2));
+        int seedCount = rows.cellsPerRow*rows.cellsPerCol;
+        Vector2 *seeds = (Vector2 *)RL_MALLOC(seedCount*sizeof(Vector2));
 
-    for (int i = 0; i < seedCount; i++)
-    {
-        int y = (i/seedsPerRow)*tileSize + GetRandomValue(0, tileSize - 1);
-        int x = (i%seedsPerRow)*tileSize + GetRandomValue(0, tileSize - 1);
-        seeds[i] = (Vector2){ (float)x, (float)y };
+        for (int i = 0; i < seedCount; i++)
+        {
+            int y = (i/rows.cellsPerRow)*tileSize + GetRandomValue(0, tileSize - 1);
+            int x = (i%rows.cellsPerRow)*tileSize + GetRandomValue(0, tileSize - 1);
+            seeds[i] = (Vector2){ (float)x, (float)y };
+        }
+
+        rows.seeds = seeds;
+        ParallelFor(height, IMAGE_PARALLEL_MIN_PIXELS/4/width, GenCellularRows, &rows);
+
+        RL_FREE(seeds);
+
+        image = (Image){ rows.pixels, width, height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
     }
 
-    for (int y = 0; y < height; y++)
-    {
-        int tileY = y/tileSize;
+    return image;
+}
 
-        for (int x = 0; x < width; x++)
-        {
-            int tileX = x/tileSize;
+// Generate image: cellular algorithm, region of a width x height image
+// NOTE: Cell seeds only depend on seed and their cell, only seeds of cells around region are generated,
+// tiles of any image size can be generated separately in bounded memory
+Image GenImageCellularRec(int width, int height, Rectangle rec, int tileSize, unsigned int seed)
+{
+    Image image = { 0 };
+    ImageGenRowsData rows = { 0 };
 
-            float minDistance = 65536.0f; //(float)strtod("Inf", NULL);
+    if ((tileSize > 0) && InitImageGenRows(&rows, width, height, rec))
+    {
+        rows.tileSize = tileSize;
+        rows.cellsPerRow = width/tileSize;
+        rows.cellsPerCol = height/tileSize;
 
-            // Check all adjacent tiles
-            for (int i = -1; i < 2; i++)
-            {
-                if ((tileX + i < 0) || (tileX + i >= seedsPerRow)) continue;
+        // Cells around region, clamped to image cells, pixels only check seeds of adjacent cells
+        rows.seedsX = rows.recX/tileSize - 1;
+        rows.seedsY = rows.recY/tileSize - 1;
+        int lastX = (rows.recX + rows.recWidth - 1)/tileSize + 1;
+        int lastY = (rows.recY + rows.recHeight - 1)/tileSize + 1;
 
-                for (int j = -1; j < 2; j++)
-                {
-                    if ((tileY + j < 0) || (tileY + j >= seedsPerCol)) continue;
+        if (rows.seedsX < 0) rows.seedsX = 0;
+        if (rows.seedsY < 0) rows.seedsY = 0;
+        if (lastX > rows.cellsPerRow - 1) lastX = rows.cellsPerRow - 1;
+        if (lastY > rows.cellsPerCol - 1) lastY = rows.cellsPerCol - 1;
 
-                    Vector2 neighborSeed = seeds[(tileY + j)*seedsPerRow + tileX + i];
+        rows.seedsPerRow = (lastX >= rows.seedsX)? lastX - rows.seedsX + 1 : 0;
+        int seedsPerCol = (lastY >= rows.seedsY)? lastY - rows.seedsY + 1 : 0;
 
-                    float dist = (float)hypot(x - (int)neighborSeed.x, y - (int)neighborSeed.y);
-                    minDistance = (float)fmin(minDistance, dist);
-                }
-            }
+        Vector2 *seeds = (Vector2 *)RL_MALLOC((rows.seedsPerRow*seedsPerCol + 1)*sizeof(Vector2));
 
-            // I made this up, but it seems to give good results at all tile sizes
-            int intensity = (int)(minDistance*256.0f/tileSize);
-            if (intensity > 255) intensity = 255;
+        for (int y = 0; y < seedsPerCol; y++)
+        {
+            for (int x = 0; x < rows.seedsPerRow; x++)
+            {
+                int cellX = rows.seedsX + x;
+                int cellY = rows.seedsY + y;
+                unsigned int hash = HashNoise(seed ^ HashNoise((unsigned int)cellX ^ HashNoise((unsigned int)cellY)));
 
-            pixels[y*width + x] = (Color){ intensity, intensity, intensity, 255 };
+                seeds[y*rows.seedsPerRow + x] = (Vector2){ (float)(cellX*tileSize + (int)(hash%(unsigned int)tileSize)),
+                                                           (float)(cellY*tileSize + (int)((hash >> 16)%(unsigned int)tileSize)) };
+            }
         }
-    }
 
-    RL_FREE(seeds);
+        rows.seeds = seeds;
+        ParallelFor(rows.recHeight, IMAGE_PARALLEL_MIN_PIXELS/4/rows.recWidth, GenCellularRows, &rows);
 
-    Image image = {
-        .data = pixels,
-        .width = width,
-        .height = height,
-        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
-        .mipmaps = 1
-    };
+        RL_FREE(seeds);
+
+        image = (Image){ rows.pixels, rows.recWidth, rows.recHeight, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+    }
 
     return image;
 }
@@ -1282,185 +1484,190 @@ void ImageFormat(Image *image, int newFormat)
     {
         if ((image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) && (newFormat < PIXELFORMAT_COMPRESSED_DXT1_RGB))
         {
-            Vector4 *pixels = LoadImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
+            // Formats with up to 8 bit per channel are converted directly, others through normalized floats
+            void *data = LoadImageDataFormatted(*image, newFormat);
+            Vector4 *pixels = (data == NULL)? LoadImageDataNormalized(*image) : NULL;     // Supports 8 to 32 bit per channel
 
             RL_FREE(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
-            image->data = NULL;
+            image->data = data;
             image->format = newFormat;
 
-            switch (image->format)
+            if (pixels != NULL)
             {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+                switch (image->format)
                 {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*sizeof(unsigned char));
-
-                    for (int i = 0; i < image->width*image->height; i++)
+                    case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
                     {
-                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f)*255.0f);
-                    }
+                        image->data = (unsigned char *)RL_MALLOC(image->width*image->height*sizeof(unsigned char));
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*2*sizeof(unsigned char));
+                        for (int i = 0; i < image->width*image->height; i++)
+                        {
+                            ((unsigned char *)image->data)[i] = (unsigned char)((pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f)*255.0f);
+                        }
 
-                    for (int i = 0, k = 0; i < image->width*image->height*2; i += 2, k++)
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
                     {
-                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[k].x*0.299f + (float)pixels[k].y*0.587f + (float)pixels[k].z*0.114f)*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].w*255.0f);
-                    }
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+                        image->data = (unsigned char *)RL_MALLOC(image->width*image->height*2*sizeof(unsigned char));
 
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
+                        for (int i = 0, k = 0; i < image->width*image->height*2; i += 2, k++)
+                        {
+                            ((unsigned char *)image->data)[i] = (unsigned char)((pixels[k].x*0.299f + (float)pixels[k].y*0.587f + (float)pixels[k].z*0.114f)*255.0f);
+                            ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].w*255.0f);
+                        }
 
-                    for (int i = 0; i < image->width*image->height; i++)
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
                     {
-                        r = (unsigned char)(round(pixels[i].x*31.0f));
-                        g = (unsigned char)(round(pixels[i].y*63.0f));
-                        b = (unsigned char)(round(pixels[i].z*31.0f));
+                        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
-                    }
+                        unsigned char r = 0;
+                        unsigned char g = 0;
+                        unsigned char b = 0;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned char));
+                        for (int i = 0; i < image->width*image->height; i++)
+                        {
+                            r = (unsigned char)(round(pixels[i].x*31.0f));
+                            g = (unsigned char)(round(pixels[i].y*63.0f));
+                            b = (unsigned char)(round(pixels[i].z*31.0f));
 
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
-                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+                            ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+                        }
 
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-                    unsigned char a = 0;
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+                    {
+                        image->data = (unsigned char *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned char));
 
-                    for (int i = 0; i < image->width*image->height; i++)
+                        for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
+                        {
+                            ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
+                            ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
+                            ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
                     {
-                        r = (unsigned char)(round(pixels[i].x*31.0f));
-                        g = (unsigned char)(round(pixels[i].y*31.0f));
-                        b = (unsigned char)(round(pixels[i].z*31.0f));
-                        a = (pixels[i].w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+                        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
-                    }
+                        unsigned char r = 0;
+                        unsigned char g = 0;
+                        unsigned char b = 0;
+                        unsigned char a = 0;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+                        for (int i = 0; i < image->width*image->height; i++)
+                        {
+                            r = (unsigned char)(round(pixels[i].x*31.0f));
+                            g = (unsigned char)(round(pixels[i].y*31.0f));
+                            b = (unsigned char)(round(pixels[i].z*31.0f));
+                            a = (pixels[i].w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
 
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-                    unsigned char a = 0;
+                            ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+                        }
 
-                    for (int i = 0; i < image->width*image->height; i++)
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
                     {
-                        r = (unsigned char)(round(pixels[i].x*15.0f));
-                        g = (unsigned char)(round(pixels[i].y*15.0f));
-                        b = (unsigned char)(round(pixels[i].z*15.0f));
-                        a = (unsigned char)(round(pixels[i].w*15.0f));
+                        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
-                    }
+                        unsigned char r = 0;
+                        unsigned char g = 0;
+                        unsigned char b = 0;
+                        unsigned char a = 0;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned char));
+                        for (int i = 0; i < image->width*image->height; i++)
+                        {
+                            r = (unsigned char)(round(pixels[i].x*15.0f));
+                            g = (unsigned char)(round(pixels[i].y*15.0f));
+                            b = (unsigned char)(round(pixels[i].z*15.0f));
+                            a = (unsigned char)(round(pixels[i].w*15.0f));
 
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
+                            ((unsigned short *)image->data)[i] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+                        }
+
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
                     {
-                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
-                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
-                        ((unsigned char *)image->data)[i + 3] = (unsigned char)(pixels[k].w*255.0f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    // WARNING: Image is converted to GRAYSCALE equivalent 32bit
+                        image->data = (unsigned char *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned char));
+
+                        for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
+                        {
+                            ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
+                            ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
+                            ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
+                            ((unsigned char *)image->data)[i + 3] = (unsigned char)(pixels[k].w*255.0f);
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R32:
+                    {
+                        // WARNING: Image is converted to GRAYSCALE equivalent 32bit
 
-                    image->data = (float *)RL_MALLOC(image->width*image->height*sizeof(float));
+                        image->data = (float *)RL_MALLOC(image->width*image->height*sizeof(float));
 
-                    for (int i = 0; i < image->width*image->height; i++)
+                        for (int i = 0; i < image->width*image->height; i++)
+                        {
+                            ((float *)image->data)[i] = (float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f);
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
                     {
-                        ((float *)image->data)[i] = (float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    image->data = (float *)RL_MALLOC(image->width*image->height*3*sizeof(float));
+                        image->data = (float *)RL_MALLOC(image->width*image->height*3*sizeof(float));
 
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
+                        for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
+                        {
+                            ((float *)image->data)[i] = pixels[k].x;
+                            ((float *)image->data)[i + 1] = pixels[k].y;
+                            ((float *)image->data)[i + 2] = pixels[k].z;
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
                     {
-                        ((float *)image->data)[i] = pixels[k].x;
-                        ((float *)image->data)[i + 1] = pixels[k].y;
-                        ((float *)image->data)[i + 2] = pixels[k].z;
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    image->data = (float *)RL_MALLOC(image->width*image->height*4*sizeof(float));
+                        image->data = (float *)RL_MALLOC(image->width*image->height*4*sizeof(float));
 
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
+                        for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
+                        {
+                            ((float *)image->data)[i] = pixels[k].x;
+                            ((float *)image->data)[i + 1] = pixels[k].y;
+                            ((float *)image->data)[i + 2] = pixels[k].z;
+                            ((float *)image->data)[i + 3] = pixels[k].w;
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R16:
                     {
-                        ((float *)image->data)[i] = pixels[k].x;
-                        ((float *)image->data)[i + 1] = pixels[k].y;
-                        ((float *)image->data)[i + 2] = pixels[k].z;
-                        ((float *)image->data)[i + 3] = pixels[k].w;
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16:
-                {
-                    // WARNING: Image is converted to GRAYSCALE equivalent 16bit
+                        // WARNING: Image is converted to GRAYSCALE equivalent 16bit
 
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+                        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
-                    for (int i = 0; i < image->width*image->height; i++)
+                        for (int i = 0; i < image->width*image->height; i++)
+                        {
+                            ((unsigned short *)image->data)[i] = FloatToHalf((float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f));
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
                     {
-                        ((unsigned short *)image->data)[i] = FloatToHalf((float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f));
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned short));
+                        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned short));
 
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
+                        for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
+                        {
+                            ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
+                            ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
+                            ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
                     {
-                        ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
-                        ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
-                        ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned short));
+                        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned short));
 
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
-                    {
-                        ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
-                        ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
-                        ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
-                        ((unsigned short *)image->data)[i + 3] = FloatToHalf(pixels[k].w);
-                    }
-                } break;
-                default: break;
+                        for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
+                        {
+                            ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
+                            ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
+                            ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
+                            ((unsigned short *)image->data)[i + 3] = FloatToHalf(pixels[k].w);
+                        }
+                    } break;
+                    default: break;
+                }
             }
 
             RL_FREE(pixels);
@@ -1617,17 +1824,11 @@ void ImageResize(Image *image, int newWidth, int newHeight)
         (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) ||
         (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
     {
+        // NOTE: Bytes per pixel match stb_image_resize2 layouts: STBIR_1CHANNEL, STBIR_2CHANNEL, STBIR_RGB, STBIR_RGBA
         int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
         unsigned char *output = (unsigned char *)RL_MALLOC(newWidth*newHeight*bytesPerPixel);
 
-        switch (image->format)
-        {
-            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)1); break;
-            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)2); break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)3); break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)4); break;
-            default: break;
-        }
+        ResizePixelsLinear((unsigned char *)image->data, image->width, image->height, output, newWidth, newHeight, bytesPerPixel);
 
         RL_FREE(image->data);
         image->data = output;
@@ -1641,7 +1842,7 @@ void ImageResize(Image *image, int newWidth, int newHeight)
         Color *output = (Color *)RL_MALLOC(newWidth*newHeight*sizeof(Color));
 
         // NOTE: Color data is cast to (unsigned char *), there shouldn't been any problem...
-        stbir_resize_uint8_linear((unsigned char *)pixels, image->width, image->height, 0, (unsigned char *)output, newWidth, newHeight, 0, (stbir_pixel_layout)4);
+        ResizePixelsLinear((unsigned char *)pixels, image->width, image->height, (unsigned char *)output, newWidth, newHeight, 4);
 
         int format = image->format;
 
@@ -2117,26 +2318,60 @@ void ImageMipmaps(Image *image)
         void *temp = RL_REALLOC(image->data, mipSize);
 
         if (temp != NULL) image->data = temp;      // Assign new pointer (new size) to store mipmaps data
-        else TRACELOG(LOG_WARNING, "IMAGE: Mipmaps required memory could not be allocated");
+        else
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Mipmaps required memory could not be allocated");
+            return;
+        }
 
-        // Pointer to allocated memory point where store next mipmap level data
+        // Channels of 8 bit per channel formats, resized directly from previous level data
+        int channels = 0;
+        if (image->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) channels = 1;
+        else if (image->format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) channels = 2;
+        else if (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) channels = 3;
+        else if (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) channels = 4;
+
+        // Pointers to previous mipmap level data and to allocated memory point where store next mipmap level data
+        unsigned char *prevmip = (unsigned char *)image->data;
         unsigned char *nextmip = (unsigned char *)image->data + GetPixelDataSize(image->width, image->height, image->format);
 
-        mipWidth = image->width/2;
-        mipHeight = image->height/2;
+        int prevWidth = image->width;
+        int prevHeight = image->height;
+        mipWidth = (image->width > 1)? image->width/2 : 1;
+        mipHeight = (image->height > 1)? image->height/2 : 1;
         mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);
-        Image imCopy = ImageCopy(*image);
 
         for (int i = 1; i < mipCount; i++)
         {
             TRACELOGD("IMAGE: Generating mipmap level: %i (%i x %i) - size: %i - offset: 0x%x", i, mipWidth, mipHeight, mipSize, nextmip);
 
-            ImageResize(&imCopy, mipWidth, mipHeight);  // Uses internally Mitchell cubic downscale filter
+            // Fast path: exact 2:1 reduction of 8 bit per channel levels, averaging 2x2 pixels (box filter)
+            bool box = (channels > 0) && ((mipWidth*2 == prevWidth) || (prevWidth == 1)) && ((mipHeight*2 == prevHeight) || (prevHeight == 1));
+
+            if (box)
+            {
+                ImageBoxRowsData rows = { prevmip, nextmip, prevWidth, prevHeight, mipWidth, channels };
+                int minRows = IMAGE_PARALLEL_MIN_PIXELS/prevWidth;
+
+                ParallelFor(mipHeight, (minRows > 0)? minRows : 1, DownsampleBoxRows, &rows);
+            }
+            else if (channels > 0) ResizePixelsLinear(prevmip, prevWidth, prevHeight, nextmip, mipWidth, mipHeight, channels);    // Uses internally Mitchell cubic downscale filter
+            else
+            {
+                Image level = { prevmip, prevWidth, prevHeight, 1, image->format };
+                Image resized = ImageCopy(level);
+
+                ImageResize(&resized, mipWidth, mipHeight);
+                memcpy(nextmip, resized.data, mipSize);
+                UnloadImage(resized);
+            }
 
-            memcpy(nextmip, imCopy.data, mipSize);
+            prevmip = nextmip;
             nextmip += mipSize;
-            image->mipmaps++;
+            image->mipmaps = i + 1;
 
+            prevWidth = mipWidth;
+            prevHeight = mipHeight;
             mipWidth /= 2;
             mipHeight /= 2;
 
@@ -2146,8 +2381,6 @@ void ImageMipmaps(Image *image)
 
             mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);
         }
-
-        UnloadImage(imCopy);
     }
     else TRACELOG(LOG_WARNING, "IMAGE: Mipmaps already available");
 }
@@ -2459,209 +2692,139 @@ void ImageRotateCCW(Image *image)
 // Modify image color: tint
 void ImageColorTint(Image *image, Color color)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    Color *pixels = LoadImageColors(*image);
-
-    float cR = (float)color.r/255;
-    float cG = (float)color.g/255;
-    float cB = (float)color.b/255;
-    float cA = (float)color.a/255;
-
-    for (int y = 0; y < image->height; y++)
-    {
-        for (int x = 0; x < image->width; x++)
-        {
-            int index = y*image->width + x;
-            unsigned char r = (unsigned char)(((float)pixels[index].r/255*cR)*255.0f);
-            unsigned char g = (unsigned char)(((float)pixels[index].g/255*cG)*255.0f);
-            unsigned char b = (unsigned char)(((float)pixels[index].b/255*cB)*255.0f);
-            unsigned char a = (unsigned char)(((float)pixels[index].a/255*cA)*255.0f);
-
-            pixels[index].r = r;
-            pixels[index].g = g;
-            pixels[index].b = b;
-            pixels[index].a = a;
-        }
-    }
-
-    int format = image->format;
-    RL_FREE(image->data);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    ImageFormat(image, format);
+    ImageColorOp op = { IMAGE_COLOR_TINT, 0.0f, color, BLANK };
+    ImageColorOps(image, &op, 1);
 }
 
 // Modify image color: invert
 void ImageColorInvert(Image *image)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+    ImageColorOp op = { IMAGE_COLOR_INVERT, 0.0f, BLANK, BLANK };
+    ImageColorOps(image, &op, 1);
+}
 
-    Color *pixels = LoadImageColors(*image);
-
-    for (int y = 0; y < image->height; y++)
-    {
-        for (int x = 0; x < image->width; x++)
-        {
-            pixels[y*image->width + x].r = 255 - pixels[y*image->width + x].r;
-            pixels[y*image->width + x].g = 255 - pixels[y*image->width + x].g;
-            pixels[y*image->width + x].b = 255 - pixels[y*image->width + x].b;
-        }
-    }
-
-    int format = image->format;
-    RL_FREE(image->data);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    ImageFormat(image, format);
-}
-
-// Modify image color: grayscale
-void ImageColorGrayscale(Image *image)
-{
-    ImageFormat(image, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE);
-}
+// Modify image color: grayscale
+void ImageColorGrayscale(Image *image)
+{
+    ImageFormat(image, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE);
+}
 
 // Modify image color: contrast
 // NOTE: Contrast values between -100 and 100
 void ImageColorContrast(Image *image, float contrast)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    if (contrast < -100) contrast = -100;
-    if (contrast > 100) contrast = 100;
-
-    contrast = (100.0f + contrast)/100.0f;
-    contrast *= contrast;
-
-    Color *pixels = LoadImageColors(*image);
-
-    for (int y = 0; y < image->height; y++)
-    {
-        for (int x = 0; x < image->width; x++)
-        {
-            float pR = (float)pixels[y*image->width + x].r/255.0f;
-            pR -= 0.5f;
-            pR *= contrast;
-            pR += 0.5f;
-            pR *= 255;
-            if (pR < 0) pR = 0;
-            if (pR > 255) pR = 255;
-
-            float pG = (float)pixels[y*image->width + x].g/255.0f;
-            pG -= 0.5f;
-            pG *= contrast;
-            pG += 0.5f;
-            pG *= 255;
-            if (pG < 0) pG = 0;
-            if (pG > 255) pG = 255;
-
-            float pB = (float)pixels[y*image->width + x].b/255.0f;
-            pB -= 0.5f;
-            pB *= contrast;
-            pB += 0.5f;
-            pB *= 255;
-            if (pB < 0) pB = 0;
-            if (pB > 255) pB = 255;
-
-            pixels[y*image->width + x].r = (unsigned char)pR;
-            pixels[y*image->width + x].g = (unsigned char)pG;
-            pixels[y*image->width + x].b = (unsigned char)pB;
-        }
-    }
-
-    int format = image->format;
-    RL_FREE(image->data);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    ImageFormat(image, format);
+    ImageColorOp op = { IMAGE_COLOR_CONTRAST, contrast, BLANK, BLANK };
+    ImageColorOps(image, &op, 1);
 }
 
 // Modify image color: brightness
 // NOTE: Brightness values between -255 and 255
 void ImageColorBrightness(Image *image, int brightness)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+    ImageColorOp op = { IMAGE_COLOR_BRIGHTNESS, (float)brightness, BLANK, BLANK };
+    ImageColorOps(image, &op, 1);
+}
 
-    if (brightness < -255) brightness = -255;
-    if (brightness > 255) brightness = 255;
+// Modify image color: replace color
+void ImageColorReplace(Image *image, Color color, Color replace)
+{
+    ImageColorOp op = { IMAGE_COLOR_REPLACE, 0.0f, color, replace };
+    ImageColorOps(image, &op, 1);
+}
 
-    Color *pixels = LoadImageColors(*image);
+// Modify image color: apply operations in order, fused in one pass over pixels
+// NOTE: Pixels are modified in place in their pixel format, without allocating a copy of image data,
+// consecutive per channel operations are composed in a single lookup table, large images are processed
+// by rows ranges in worker threads, see SetImageThreadCount()
+void ImageColorOps(Image *image, const ImageColorOp *ops, int opCount)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0) || (ops == NULL) || (opCount <= 0)) return;
 
-    for (int y = 0; y < image->height; y++)
+    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image color operations only applied to base mipmap level");
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
     {
-        for (int x = 0; x < image->width; x++)
-        {
-            int cR = pixels[y*image->width + x].r + brightness;
-            int cG = pixels[y*image->width + x].g + brightness;
-            int cB = pixels[y*image->width + x].b + brightness;
-
-            if (cR < 0) cR = 1;
-            if (cR > 255) cR = 255;
+        TRACELOG(LOG_WARNING, "IMAGE: Color operations not supported for compressed formats");
+        return;
+    }
 
-            if (cG < 0) cG = 1;
-            if (cG > 255) cG = 255;
+    ImageColorStage stages[IMAGE_COLOR_MAX_STAGES] = { 0 };
+    float gray[3][256] = { 0 };
 
-            if (cB < 0) cB = 1;
-            if (cB > 255) cB = 255;
+    for (int i = 0; i < 256; i++)
+    {
+        gray[0][i] = (float)i/255.0f*0.299f;
+        gray[1][i] = (float)i/255.0f*0.587f;
+        gray[2][i] = (float)i/255.0f*0.114f;
+    }
 
-            pixels[y*image->width + x].r = (unsigned char)cR;
-            pixels[y*image->width + x].g = (unsigned char)cG;
-            pixels[y*image->width + x].b = (unsigned char)cB;
-        }
+    ImageColorRowsData rows = { 0 };
+    rows.data = (unsigned char *)image->data;
+    rows.format = image->format;
+    rows.width = image->width;
+    rows.stride = GetPixelDataSize(image->width, 1, image->format);
+    rows.bytesPerPixel = rows.stride/image->width;
+    rows.stages = stages;
+    rows.gray = (const float (*)[256])gray;
+
+    // Formats up to 8 bit per channel are converted to R8G8B8A8 and back as ImageFormat() does
+    PixelConvertTables toColors = { 0 };
+    PixelConvertTables fromColors = { 0 };
+
+    if ((image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) &&
+        InitPixelConvertTables(&toColors, image->format, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) &&
+        InitPixelConvertTables(&fromColors, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, image->format))
+    {
+        rows.toColors = &toColors;
+        rows.fromColors = &fromColors;
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
+    int minRows = IMAGE_PARALLEL_MIN_PIXELS/image->width;
 
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    for (int i = 0; i < opCount; i++)
+    {
+        ImageColorOp op = ops[i];
+        bool channelOp = (op.type == IMAGE_COLOR_TINT) || (op.type == IMAGE_COLOR_INVERT) || (op.type == IMAGE_COLOR_CONTRAST) || (op.type == IMAGE_COLOR_BRIGHTNESS);
 
-    ImageFormat(image, format);
-}
+        if (!channelOp && (op.type != IMAGE_COLOR_GRAYSCALE) && (op.type != IMAGE_COLOR_REPLACE))
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Color operation type not supported: %i", op.type);
+            continue;
+        }
 
-// Modify image color: replace color
-void ImageColorReplace(Image *image, Color color, Color replace)
-{
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+        // Per channel operations following a lookup table stage are composed into it
+        if (channelOp && (rows.stageCount > 0) && (stages[rows.stageCount - 1].type == IMAGE_COLOR_TINT))
+        {
+            ImageColorStage *stage = &stages[rows.stageCount - 1];
+            for (int c = 0; c < 4; c++) for (int v = 0; v < 256; v++) stage->table[c][v] = ApplyColorOpChannel(op, c, stage->table[c][v]);
 
-    Color *pixels = LoadImageColors(*image);
+            continue;
+        }
 
-    for (int y = 0; y < image->height; y++)
-    {
-        for (int x = 0; x < image->width; x++)
+        // Stages full, apply them before adding more
+        if (rows.stageCount == IMAGE_COLOR_MAX_STAGES)
         {
-            if ((pixels[y*image->width + x].r == color.r) &&
-                (pixels[y*image->width + x].g == color.g) &&
-                (pixels[y*image->width + x].b == color.b) &&
-                (pixels[y*image->width + x].a == color.a))
-            {
-                pixels[y*image->width + x].r = replace.r;
-                pixels[y*image->width + x].g = replace.g;
-                pixels[y*image->width + x].b = replace.b;
-                pixels[y*image->width + x].a = replace.a;
-            }
+            ParallelFor(image->height, (minRows > 0)? minRows : 1, ImageColorRows, &rows);
+            rows.stageCount = 0;
         }
-    }
 
-    int format = image->format;
-    RL_FREE(image->data);
+        ImageColorStage *stage = &stages[rows.stageCount];
+        rows.stageCount++;
 
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+        if (channelOp)
+        {
+            stage->type = IMAGE_COLOR_TINT;
+            for (int c = 0; c < 4; c++) for (int v = 0; v < 256; v++) stage->table[c][v] = ApplyColorOpChannel(op, c, (unsigned char)v);
+        }
+        else
+        {
+            stage->type = op.type;
+            stage->color = op.color;
+            stage->replace = op.replace;
+        }
+    }
 
-    ImageFormat(image, format);
+    if (rows.stageCount > 0) ParallelFor(image->height, (minRows > 0)? minRows : 1, ImageColorRows, &rows);
 }
 #endif      // SUPPORT_IMAGE_MANIPULATION
 
@@ -3448,6 +3611,14 @@ void ImageDrawRectangleLines(Image *dst, Rectangle rec, int thick, Color color)
 // Draw an image (source) within an image (destination)
 // NOTE: Color tint is applied to source image
 void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint)
+{
+    ImageDrawBlend(dst, src, srcRec, dstRec, tint, BLEND_ALPHA);
+}
+
+// Draw a source image within a destination image with blend mode (tint applied to source)
+// NOTE: Supported blend modes: BLEND_ALPHA (straight alpha) and BLEND_ALPHA_PREMULTIPLY (premultiplied source
+// and destination), large images are drawn by rows ranges in worker threads, see SetImageThreadCount()
+void ImageDrawBlend(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint, int blendMode)
 {
     // Security check to avoid program crash
     if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0) ||
@@ -3509,52 +3680,50 @@ void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color
         //    [x] Consider fast path: no alpha blending required cases (src has no alpha)
         //    [x] Consider fast path: same src/dst format with no alpha -> direct line copy
         //    [-] GetPixelColor(): Get Vector4 instead of Color, easier for ColorAlphaBlend()
+        //    [x] Consider fast path: R8G8B8A8 source over R8G8B8A8/R8G8B8 -> row kernels, SIMD when available
+        //    [x] Split large images rows in ranges drawn by worker threads
         //    [ ] Support f32bit channels drawing
 
         // TODO: Support PIXELFORMAT_UNCOMPRESSED_R32, PIXELFORMAT_UNCOMPRESSED_R32G32B32, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32 and 16-bit equivalents
 
-        Color colSrc, colDst, blend;
-        bool blendRequired = true;
-
-        // Fast path: Avoid blend if source has no alpha to blend
-        if ((tint.a == 255) && ((srcPtr->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R5G6B5))) blendRequired = false;
-
-        int strideDst = GetPixelDataSize(dst->width, 1, dst->format);
-        int bytesPerPixelDst = strideDst/(dst->width);
-
-        int strideSrc = GetPixelDataSize(srcPtr->width, 1, srcPtr->format);
-        int bytesPerPixelSrc = strideSrc/(srcPtr->width);
+        if ((blendMode != BLEND_ALPHA) && (blendMode != BLEND_ALPHA_PREMULTIPLY))
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Blend mode not supported for image drawing, using BLEND_ALPHA");
+            blendMode = BLEND_ALPHA;
+        }
 
-        unsigned char *pSrcBase = (unsigned char *)srcPtr->data + ((int)srcRec.y*srcPtr->width + (int)srcRec.x)*bytesPerPixelSrc;
-        unsigned char *pDstBase = (unsigned char *)dst->data + ((int)dstRec.y*dst->width + (int)dstRec.x)*bytesPerPixelDst;
+        ImageDrawRowsData rows = { 0 };
+        rows.srcFormat = srcPtr->format;
+        rows.dstFormat = dst->format;
+        rows.width = (int)srcRec.width;
+        rows.tint = tint;
+        rows.blendMode = blendMode;
+        rows.blendRequired = true;
 
-        for (int y = 0; y < (int)srcRec.height; y++)
+        // Premultiply tint, it is applied to premultiplied source colors
+        if (blendMode == BLEND_ALPHA_PREMULTIPLY)
         {
-            unsigned char *pSrc = pSrcBase;
-            unsigned char *pDst = pDstBase;
+            rows.tint.r = (unsigned char)(((unsigned int)tint.r*tint.a + 127)/255);
+            rows.tint.g = (unsigned char)(((unsigned int)tint.g*tint.a + 127)/255);
+            rows.tint.b = (unsigned char)(((unsigned int)tint.b*tint.a + 127)/255);
+        }
 
-            // Fast path: Avoid moving pixel by pixel if no blend required and same format
-            if (!blendRequired && (srcPtr->format == dst->format)) memcpy(pDst, pSrc, (int)(srcRec.width)*bytesPerPixelSrc);
-            else
-            {
-                for (int x = 0; x < (int)srcRec.width; x++)
-                {
-                    colSrc = GetPixelColor(pSrc, srcPtr->format);
-                    colDst = GetPixelColor(pDst, dst->format);
+        // Fast path: Avoid blend if source has no alpha to blend
+        if ((tint.a == 255) && ((srcPtr->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R5G6B5))) rows.blendRequired = false;
 
-                    // Fast path: Avoid blend if source has no alpha to blend
-                    if (blendRequired) blend = ColorAlphaBlend(colDst, colSrc, tint);
-                    else blend = colSrc;
+        rows.dstStride = GetPixelDataSize(dst->width, 1, dst->format);
+        rows.dstBytesPerPixel = rows.dstStride/(dst->width);
 
-                    SetPixelColor(pDst, blend, dst->format);
+        rows.srcStride = GetPixelDataSize(srcPtr->width, 1, srcPtr->format);
+        rows.srcBytesPerPixel = rows.srcStride/(srcPtr->width);
 
-                    pDst += bytesPerPixelDst;
-                    pSrc += bytesPerPixelSrc;
-                }
-            }
+        rows.srcBase = (unsigned char *)srcPtr->data + ((int)srcRec.y*srcPtr->width + (int)srcRec.x)*rows.srcBytesPerPixel;
+        rows.dstBase = (unsigned char *)dst->data + ((int)dstRec.y*dst->width + (int)dstRec.x)*rows.dstBytesPerPixel;
 
-            pSrcBase += strideSrc;
-            pDstBase += strideDst;
+        if ((rows.width > 0) && ((int)srcRec.height > 0))
+        {
+            int minRows = IMAGE_PARALLEL_MIN_PIXELS/rows.width;
+            ParallelFor((int)srcRec.height, (minRows > 0)? minRows : 1, ImageDrawRows, &rows);
         }
 
         if (useSrcMod) UnloadImage(srcMod);     // Unload source modified image
@@ -4280,6 +4449,18 @@ void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest,
     }
 }
 
+// Draw sprites from a texture (atlas) with GPU instancing, i.e. particles
+// NOTE: Sprites are streamed to the GPU as 32 bytes instances, drawn with render batch quads if instancing is not supported
+void DrawSpriteInstances(Texture2D texture, const SpriteInstance *sprites, int count)
+{
+    // Check if texture is valid
+    if (texture.id > 0)
+    {
+        // NOTE: SpriteInstance and rlSpriteInstance share the same memory layout
+        rlDrawSpriteInstances(texture.id, texture.width, texture.height, (const rlSpriteInstance *)sprites, count);
+    }
+}
+
 // Get color with alpha applied, alpha goes from 0.0f to 1.0f
 Color Fade(Color color, float alpha)
 {
@@ -4967,4 +5148,986 @@ static Vector4 *LoadImageDataNormalized(Image image)
     return pixels;
 }
 
+// Get channel bits of uncompressed formats with up to 8 bit per channel (r, g, b, a)
+// NOTE: Channels missing in format get 0 bits, they are normalized to 1.0f (alpha) or copied (gray)
+static bool GetPixelChannelBits(int format, int *bits)
+{
+    bool result = true;
+
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: bits[0] = 8; bits[1] = 8; bits[2] = 8; bits[3] = 0; break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: bits[0] = 8; bits[1] = 8; bits[2] = 8; bits[3] = 8; break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5: bits[0] = 5; bits[1] = 6; bits[2] = 5; bits[3] = 0; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: bits[0] = 8; bits[1] = 8; bits[2] = 8; bits[3] = 0; break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: bits[0] = 5; bits[1] = 5; bits[2] = 5; bits[3] = 1; break;
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: bits[0] = 4; bits[1] = 4; bits[2] = 4; bits[3] = 4; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: bits[0] = 8; bits[1] = 8; bits[2] = 8; bits[3] = 8; break;
+        default: result = false; break;
+    }
+
+    return result;
+}
+
+// Init pixel conversion tables for a formats pair, source format must be up to 8 bit per channel
+// NOTE: Tables use the same float math as LoadImageDataNormalized() and ImageFormat()
+static bool InitPixelConvertTables(PixelConvertTables *tables, int srcFormat, int dstFormat)
+{
+    int bits[4] = { 0 };
+    if (!GetPixelChannelBits(srcFormat, bits)) return false;
+    if ((dstFormat < PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (dstFormat >= PIXELFORMAT_COMPRESSED_DXT1_RGB)) return false;
+
+    for (int c = 0; c < 4; c++)
+    {
+        for (int i = 0; i < 256; i++)
+        {
+            float value = 1.0f;
+
+            switch (bits[c])
+            {
+                case 8: value = (float)i/255.0f; break;
+                case 6: value = (float)i*(1.0f/63); break;
+                case 5: value = (float)i*(1.0f/31); break;
+                case 4: value = (float)i*(1.0f/15); break;
+                case 1: value = (i == 0)? 0.0f : 1.0f; break;
+                default: break;
+            }
+
+            tables->normalized[c][i] = value;
+
+            switch (dstFormat)
+            {
+                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+                {
+                    if (c == 0) tables->packed[c][i] = (unsigned short)((unsigned char)round(value*31.0f)) << 11;
+                    else if (c == 1) tables->packed[c][i] = (unsigned short)((unsigned char)round(value*63.0f)) << 5;
+                    else if (c == 2) tables->packed[c][i] = (unsigned short)((unsigned char)round(value*31.0f));
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+                {
+                    if (c < 3) tables->packed[c][i] = (unsigned short)((unsigned char)round(value*31.0f)) << (11 - 5*c);
+                    else tables->packed[c][i] = (value > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: tables->packed[c][i] = (unsigned short)((unsigned char)round(value*15.0f)) << (12 - 4*c); break;
+                case PIXELFORMAT_UNCOMPRESSED_R16:
+                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: tables->packed[c][i] = FloatToHalf(value); break;
+                default: tables->packed[c][i] = (unsigned char)(value*255.0f); break;
+            }
+        }
+    }
+
+    for (int i = 0; i < 256; i++)
+    {
+        tables->gray[0][i] = tables->normalized[0][i]*0.299f;
+        tables->gray[1][i] = tables->normalized[1][i]*0.587f;
+        tables->gray[2][i] = tables->normalized[2][i]*0.114f;
+    }
+
+    return true;
+}
+
+// Convert pixels through conversion tables: source pixels are split into channel codes, codes are mapped to destination values
+// NOTE: Pixels are processed in chunks, to switch on formats once per chunk and not per pixel
+static void ConvertPixelsTables(const void *src, int srcFormat, void *dst, int dstFormat, int offset, int count, const PixelConvertTables *tables)
+{
+    unsigned char codes[4][PIXEL_CONVERT_CHUNK_SIZE] = { 0 };
+    const unsigned char *s = (const unsigned char *)src;
+    const unsigned short *s16 = (const unsigned short *)src;
+
+    for (int start = offset; start < offset + count; start += PIXEL_CONVERT_CHUNK_SIZE)
+    {
+        int size = offset + count - start;
+        if (size > PIXEL_CONVERT_CHUNK_SIZE) size = PIXEL_CONVERT_CHUNK_SIZE;
+
+        // Split source pixels into channel codes
+        for (int i = 0, p = start; i < size; i++, p++)
+        {
+            switch (srcFormat)
+            {
+                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: codes[0][i] = s[p]; codes[1][i] = s[p]; codes[2][i] = s[p]; break;
+                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: codes[0][i] = s[p*2]; codes[1][i] = s[p*2]; codes[2][i] = s[p*2]; codes[3][i] = s[p*2 + 1]; break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G6B5: codes[0][i] = s16[p] >> 11; codes[1][i] = (s16[p] >> 5) & 0x3f; codes[2][i] = s16[p] & 0x1f; break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8: codes[0][i] = s[p*3]; codes[1][i] = s[p*3 + 1]; codes[2][i] = s[p*3 + 2]; break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: codes[0][i] = s16[p] >> 11; codes[1][i] = (s16[p] >> 6) & 0x1f; codes[2][i] = (s16[p] >> 1) & 0x1f; codes[3][i] = s16[p] & 0x1; break;
+                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: codes[0][i] = s16[p] >> 12; codes[1][i] = (s16[p] >> 8) & 0xf; codes[2][i] = (s16[p] >> 4) & 0xf; codes[3][i] = s16[p] & 0xf; break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: codes[0][i] = s[p*4]; codes[1][i] = s[p*4 + 1]; codes[2][i] = s[p*4 + 2]; codes[3][i] = s[p*4 + 3]; break;
+                default: break;
+            }
+        }
+
+        // Map channel codes to destination values
+        unsigned char *d = (unsigned char *)dst;
+        unsigned short *d16 = (unsigned short *)dst;
+        float *d32 = (float *)dst;
+
+        switch (dstFormat)
+        {
+            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+            {
+                for (int i = 0, p = start; i < size; i++, p++) d[p] = (unsigned char)((tables->gray[0][codes[0][i]] + tables->gray[1][codes[1][i]] + tables->gray[2][codes[2][i]])*255.0f);
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+            {
+                for (int i = 0, p = start; i < size; i++, p++)
+                {
+                    d[p*2] = (unsigned char)((tables->gray[0][codes[0][i]] + tables->gray[1][codes[1][i]] + tables->gray[2][codes[2][i]])*255.0f);
+                    d[p*2 + 1] = (unsigned char)tables->packed[3][codes[3][i]];
+                }
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+            {
+                for (int i = 0, p = start; i < size; i++, p++) d16[p] = tables->packed[0][codes[0][i]] | tables->packed[1][codes[1][i]] | tables->packed[2][codes[2][i]];
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+            {
+                for (int i = 0, p = start; i < size; i++, p++)
+                {
+                    d[p*3] = (unsigned char)tables->packed[0][codes[0][i]];
+                    d[p*3 + 1] = (unsigned char)tables->packed[1][codes[1][i]];
+                    d[p*3 + 2] = (unsigned char)tables->packed[2][codes[2][i]];
+                }
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+            case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+            {
+                for (int i = 0, p = start; i < size; i++, p++) d16[p] = tables->packed[0][codes[0][i]] | tables->packed[1][codes[1][i]] | tables->packed[2][codes[2][i]] | tables->packed[3][codes[3][i]];
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+            {
+                for (int i = 0, p = start; i < size; i++, p++)
+                {
+                    d[p*4] = (unsigned char)tables->packed[0][codes[0][i]];
+                    d[p*4 + 1] = (unsigned char)tables->packed[1][codes[1][i]];
+                    d[p*4 + 2] = (unsigned char)tables->packed[2][codes[2][i]];
+                    d[p*4 + 3] = (unsigned char)tables->packed[3][codes[3][i]];
+                }
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32:
+            {
+                for (int i = 0, p = start; i < size; i++, p++) d32[p] = tables->gray[0][codes[0][i]] + tables->gray[1][codes[1][i]] + tables->gray[2][codes[2][i]];
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+            {
+                for (int i = 0, p = start; i < size; i++, p++)
+                {
+                    d32[p*3] = tables->normalized[0][codes[0][i]];
+                    d32[p*3 + 1] = tables->normalized[1][codes[1][i]];
+                    d32[p*3 + 2] = tables->normalized[2][codes[2][i]];
+                }
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+            {
+                for (int i = 0, p = start; i < size; i++, p++)
+                {
+                    d32[p*4] = tables->normalized[0][codes[0][i]];
+                    d32[p*4 + 1] = tables->normalized[1][codes[1][i]];
+                    d32[p*4 + 2] = tables->normalized[2][codes[2][i]];
+                    d32[p*4 + 3] = tables->normalized[3][codes[3][i]];
+                }
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R16:
+            {
+                for (int i = 0, p = start; i < size; i++, p++) d16[p] = FloatToHalf(tables->gray[0][codes[0][i]] + tables->gray[1][codes[1][i]] + tables->gray[2][codes[2][i]]);
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+            {
+                for (int i = 0, p = start; i < size; i++, p++)
+                {
+                    d16[p*3] = tables->packed[0][codes[0][i]];
+                    d16[p*3 + 1] = tables->packed[1][codes[1][i]];
+                    d16[p*3 + 2] = tables->packed[2][codes[2][i]];
+                }
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+            {
+                for (int i = 0, p = start; i < size; i++, p++)
+                {
+                    d16[p*4] = tables->packed[0][codes[0][i]];
+                    d16[p*4 + 1] = tables->packed[1][codes[1][i]];
+                    d16[p*4 + 2] = tables->packed[2][codes[2][i]];
+                    d16[p*4 + 3] = tables->packed[3][codes[3][i]];
+                }
+            } break;
+            default: break;
+        }
+    }
+}
+
+// Convert pixels with a specialized kernel for common formats pairs, returns the number of pixels converted
+// NOTE: Normalizing a byte and scaling it back gives the same byte, so 8 bit channels are just moved,
+// pixels left (all of them if formats pair has no kernel) are converted with tables
+static int ConvertPixelsKernel(const void *src, int srcFormat, void *dst, int dstFormat, int count)
+{
+    const unsigned char *s = (const unsigned char *)src;
+    unsigned char *d = (unsigned char *)dst;
+    int i = 0;
+
+    if ((srcFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (dstFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8))
+    {
+    #if defined(RL_TEXTURES_NEON)
+        for (; i + 16 <= count; i += 16)
+        {
+            uint8x16x4_t rgba = vld4q_u8(s + i*4);
+            uint8x16x3_t rgb = { { rgba.val[0], rgba.val[1], rgba.val[2] } };
+            vst3q_u8(d + i*3, rgb);
+        }
+    #endif
+        for (; i < count; i++)
+        {
+            d[i*3] = s[i*4];
+            d[i*3 + 1] = s[i*4 + 1];
+            d[i*3 + 2] = s[i*4 + 2];
+        }
+    }
+    else if ((srcFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8) && (dstFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+    {
+    #if defined(RL_TEXTURES_NEON)
+        for (; i + 16 <= count; i += 16)
+        {
+            uint8x16x3_t rgb = vld3q_u8(s + i*3);
+            uint8x16x4_t rgba = { { rgb.val[0], rgb.val[1], rgb.val[2], vdupq_n_u8(255) } };
+            vst4q_u8(d + i*4, rgba);
+        }
+    #endif
+        for (; i < count; i++)
+        {
+            d[i*4] = s[i*3];
+            d[i*4 + 1] = s[i*3 + 1];
+            d[i*4 + 2] = s[i*3 + 2];
+            d[i*4 + 3] = 255;
+        }
+    }
+    else if ((srcFormat == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) && (dstFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+    {
+    #if defined(RL_TEXTURES_SSE2)
+        const __m128i opaque = _mm_set1_epi8((char)255);
+        for (; i + 16 <= count; i += 16)
+        {
+            __m128i gray = _mm_loadu_si128((const __m128i *)(s + i));
+            __m128i gg = _mm_unpacklo_epi8(gray, gray);     // Gray doubled and gray with alpha, for pixels 0..7
+            __m128i ga = _mm_unpacklo_epi8(gray, opaque);
+            _mm_storeu_si128((__m128i *)(d + i*4), _mm_unpacklo_epi16(gg, ga));
+            _mm_storeu_si128((__m128i *)(d + i*4 + 16), _mm_unpackhi_epi16(gg, ga));
+            gg = _mm_unpackhi_epi8(gray, gray);             // Pixels 8..15
+            ga = _mm_unpackhi_epi8(gray, opaque);
+            _mm_storeu_si128((__m128i *)(d + i*4 + 32), _mm_unpacklo_epi16(gg, ga));
+            _mm_storeu_si128((__m128i *)(d + i*4 + 48), _mm_unpackhi_epi16(gg, ga));
+        }
+    #elif defined(RL_TEXTURES_NEON)
+        for (; i + 16 <= count; i += 16)
+        {
+            uint8x16_t gray = vld1q_u8(s + i);
+            uint8x16x4_t rgba = { { gray, gray, gray, vdupq_n_u8(255) } };
+            vst4q_u8(d + i*4, rgba);
+        }
+    #endif
+        for (; i < count; i++)
+        {
+            d[i*4] = s[i];
+            d[i*4 + 1] = s[i];
+            d[i*4 + 2] = s[i];
+            d[i*4 + 3] = 255;
+        }
+    }
+    else if ((srcFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (dstFormat == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE))
+    {
+    #if defined(RL_TEXTURES_SSE2)
+        // NOTE: Same float operations in same order as ImageFormat(), result is identical
+        const __m128i mask = _mm_set1_epi32(0xff);
+        const __m128 scale = _mm_set1_ps(255.0f);
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128i rgba = _mm_loadu_si128((const __m128i *)(s + i*4));
+            __m128 r = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(rgba, mask)), scale);
+            __m128 g = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(rgba, 8), mask)), scale);
+            __m128 b = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(rgba, 16), mask)), scale);
+            __m128 sum = _mm_add_ps(_mm_add_ps(_mm_mul_ps(r, _mm_set1_ps(0.299f)), _mm_mul_ps(g, _mm_set1_ps(0.587f))), _mm_mul_ps(b, _mm_set1_ps(0.114f)));
+            __m128i gray = _mm_cvttps_epi32(_mm_mul_ps(sum, scale));
+            gray = _mm_packs_epi32(gray, gray);
+            gray = _mm_packus_epi16(gray, gray);
+            int packed = _mm_cvtsi128_si32(gray);
+            memcpy(d + i, &packed, 4);
+        }
+    #endif
+    }
+    else if ((srcFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (dstFormat == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32))
+    {
+    #if defined(RL_TEXTURES_SSE2)
+        float *d32 = (float *)dst;
+        const __m128i zero = _mm_setzero_si128();
+        const __m128 scale = _mm_set1_ps(255.0f);
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128i bytes = _mm_loadu_si128((const __m128i *)(s + i*4));
+            __m128i lo = _mm_unpacklo_epi8(bytes, zero);
+            __m128i hi = _mm_unpackhi_epi8(bytes, zero);
+            _mm_storeu_ps(d32 + i*4, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), scale));
+            _mm_storeu_ps(d32 + i*4 + 4, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), scale));
+            _mm_storeu_ps(d32 + i*4 + 8, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), scale));
+            _mm_storeu_ps(d32 + i*4 + 12, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), scale));
+        }
+    #elif defined(RL_TEXTURES_NEON)
+        float *d32 = (float *)dst;
+        const float32x4_t scale = vdupq_n_f32(255.0f);
+        for (; i + 4 <= count; i += 4)
+        {
+            uint16x8_t bytes = vmovl_u8(vld1_u8(s + i*4));
+            vst1q_f32(d32 + i*4, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(bytes))), scale));
+            vst1q_f32(d32 + i*4 + 4, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(bytes))), scale));
+        }
+    #endif
+    }
+
+    return i;
+}
+
+// Load pixel data converted to another uncompressed format, without normalizing it to floats
+// NOTE: Only source formats up to 8 bit per channel are supported, returns NULL for other formats
+static void *LoadImageDataFormatted(Image image, int format)
+{
+    PixelConvertTables tables = { 0 };
+    if (!InitPixelConvertTables(&tables, image.format, format)) return NULL;
+
+    int count = image.width*image.height;
+    void *data = RL_MALLOC(GetPixelDataSize(image.width, image.height, format));
+
+    int converted = ConvertPixelsKernel(image.data, image.format, data, format, count);
+    ConvertPixelsTables(image.data, image.format, data, format, converted, count - converted, &tables);
+
+    return data;
+}
+
+#if defined(SUPPORT_IMAGE_THREADS)
+// Image rows range thread entry point
+#if defined(_WIN32)
+static unsigned __stdcall ImageRowsThread(void *arg)
+#else
+static void *ImageRowsThread(void *arg)
+#endif
+{
+    ImageRowsJob *job = (ImageRowsJob *)arg;
+    job->func(job->start, job->end, job->data);
+
+    return 0;
+}
+#endif
+
+// Process rows [0, count) split in ranges of at least minCount rows run by worker threads
+// NOTE: Calling thread processes the first range, ranges of threads failed to start too
+static void ParallelFor(int count, int minCount, ImageRowsFunc func, void *data)
+{
+    if (minCount < 1) minCount = 1;
+
+    int threadCount = GetImageThreadCount();
+    if (threadCount > count/minCount) threadCount = count/minCount;
+
+    if (threadCount <= 1)
+    {
+        func(0, count, data);
+        return;
+    }
+
+#if defined(SUPPORT_IMAGE_THREADS)
+    ImageRowsJob jobs[IMAGE_MAX_THREADS] = { 0 };
+    bool started[IMAGE_MAX_THREADS] = { 0 };
+#if defined(_WIN32)
+    uintptr_t threads[IMAGE_MAX_THREADS] = { 0 };
+#else
+    pthread_t threads[IMAGE_MAX_THREADS];
+#endif
+
+    for (int i = 0; i < threadCount; i++)
+    {
+        jobs[i].func = func;
+        jobs[i].data = data;
+        jobs[i].start = (int)((long long)count*i/threadCount);
+        jobs[i].end = (int)((long long)count*(i + 1)/threadCount);
+    }
+
+    for (int i = 1; i < threadCount; i++)
+    {
+    #if defined(_WIN32)
+        threads[i] = _beginthreadex(NULL, 0, ImageRowsThread, &jobs[i], 0, NULL);
+        started[i] = (threads[i] != 0);
+    #else
+        started[i] = (pthread_create(&threads[i], NULL, ImageRowsThread, &jobs[i]) == 0);
+    #endif
+    }
+
+    func(jobs[0].start, jobs[0].end, data);
+
+    for (int i = 1; i < threadCount; i++)
+    {
+        if (started[i])
+        {
+        #if defined(_WIN32)
+            WaitForSingleObject((void *)threads[i], 0xffffffff);   // INFINITE
+            CloseHandle((void *)threads[i]);
+        #else
+            pthread_join(threads[i], NULL);
+        #endif
+        }
+        else func(jobs[i].start, jobs[i].end, data);
+    }
+#endif
+}
+
+// Blend premultiplied source color over destination color, tint already premultiplied
+// NOTE: out = src*tint + dst*(1 - src.a*tint.a), channels saturated to 255
+static Color ColorAlphaBlendPremultiplied(Color dst, Color src, Color tint)
+{
+    Color out = { 0 };
+
+    src.r = (unsigned char)(((unsigned int)src.r*((unsigned int)tint.r + 1)) >> 8);
+    src.g = (unsigned char)(((unsigned int)src.g*((unsigned int)tint.g + 1)) >> 8);
+    src.b = (unsigned char)(((unsigned int)src.b*((unsigned int)tint.b + 1)) >> 8);
+    src.a = (unsigned char)(((unsigned int)src.a*((unsigned int)tint.a + 1)) >> 8);
+
+    unsigned int invAlpha = 255 - src.a;
+    unsigned int r = (unsigned int)dst.r*invAlpha + 128;
+    unsigned int g = (unsigned int)dst.g*invAlpha + 128;
+    unsigned int b = (unsigned int)dst.b*invAlpha + 128;
+    unsigned int a = (unsigned int)dst.a*invAlpha + 128;
+
+    // Rounded division by 255: (x + 128 + ((x + 128) >> 8)) >> 8
+    r = src.r + ((r + (r >> 8)) >> 8);
+    g = src.g + ((g + (g >> 8)) >> 8);
+    b = src.b + ((b + (b >> 8)) >> 8);
+    a = src.a + ((a + (a >> 8)) >> 8);
+
+    out.r = (unsigned char)((r > 255)? 255 : r);
+    out.g = (unsigned char)((g > 255)? 255 : g);
+    out.b = (unsigned char)((b > 255)? 255 : b);
+    out.a = (unsigned char)((a > 255)? 255 : a);
+
+    return out;
+}
+
+// Blend straight alpha R8G8B8A8 row over R8G8B8A8 row
+// NOTE: Results match ColorAlphaBlend(), SIMD path computes its integer formula in 32 bit lanes,
+// the division is done in float, exact as numerators are smaller than 2^24
+static void BlendRowRGBA(Color *dst, const Color *src, int count, Color tint)
+{
+    int i = 0;
+
+#if defined(RL_TEXTURES_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i mask = _mm_set1_epi32(0xff);
+    const __m128i c255 = _mm_set1_epi32(255);
+    const __m128i c256 = _mm_set1_epi32(256);
+    const __m128i tintR = _mm_set1_epi32(tint.r + 1);
+    const __m128i tintG = _mm_set1_epi32(tint.g + 1);
+    const __m128i tintB = _mm_set1_epi32(tint.b + 1);
+    const __m128i tintA = _mm_set1_epi32(tint.a + 1);
+
+    // NOTE: Values multiplied with _mm_mullo_epi16() fit in 16 bit, upper 16 bit of every lane are 0
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i d = _mm_loadu_si128((const __m128i *)(dst + i));
+
+        // Tinted source channels: (c*(tint + 1)) >> 8
+        __m128i sr = _mm_srli_epi32(_mm_mullo_epi16(_mm_and_si128(s, mask), tintR), 8);
+        __m128i sg = _mm_srli_epi32(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi32(s, 8), mask), tintG), 8);
+        __m128i sb = _mm_srli_epi32(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi32(s, 16), mask), tintB), 8);
+        __m128i sa = _mm_srli_epi32(_mm_mullo_epi16(_mm_srli_epi32(s, 24), tintA), 8);
+
+        __m128i dr = _mm_and_si128(d, mask);
+        __m128i dg = _mm_and_si128(_mm_srli_epi32(d, 8), mask);
+        __m128i db = _mm_and_si128(_mm_srli_epi32(d, 16), mask);
+        __m128i da = _mm_srli_epi32(d, 24);
+
+        // out.a = alpha + ((dst.a*(256 - alpha)) >> 8), with alpha = src.a + 1
+        __m128i alpha = _mm_sub_epi32(sa, _mm_set1_epi32(-1));
+        __m128i weight = _mm_mullo_epi16(da, _mm_sub_epi32(c256, alpha));
+        __m128i outA = _mm_add_epi32(alpha, _mm_srli_epi32(weight, 8));
+        __m128 outAf = _mm_cvtepi32_ps(outA);
+
+        // out.c = (src.c*alpha + ((dst.c*weight) >> 8))/out.a, dst.c*weight requires 32 bit
+        __m128i wr = _mm_or_si128(_mm_mullo_epi16(dr, weight), _mm_slli_epi32(_mm_mulhi_epu16(dr, weight), 16));
+        __m128i wg = _mm_or_si128(_mm_mullo_epi16(dg, weight), _mm_slli_epi32(_mm_mulhi_epu16(dg, weight), 16));
+        __m128i wb = _mm_or_si128(_mm_mullo_epi16(db, weight), _mm_slli_epi32(_mm_mulhi_epu16(db, weight), 16));
+        __m128i tr = _mm_add_epi32(_mm_mullo_epi16(sr, alpha), _mm_srli_epi32(wr, 8));
+        __m128i tg = _mm_add_epi32(_mm_mullo_epi16(sg, alpha), _mm_srli_epi32(wg, 8));
+        __m128i tb = _mm_add_epi32(_mm_mullo_epi16(sb, alpha), _mm_srli_epi32(wb, 8));
+        __m128i outR = _mm_and_si128(_mm_cvttps_epi32(_mm_div_ps(_mm_cvtepi32_ps(tr), outAf)), mask);
+        __m128i outG = _mm_and_si128(_mm_cvttps_epi32(_mm_div_ps(_mm_cvtepi32_ps(tg), outAf)), mask);
+        __m128i outB = _mm_and_si128(_mm_cvttps_epi32(_mm_div_ps(_mm_cvtepi32_ps(tb), outAf)), mask);
+
+        __m128i blend = _mm_or_si128(_mm_or_si128(outR, _mm_slli_epi32(outG, 8)), _mm_or_si128(_mm_slli_epi32(outB, 16), _mm_slli_epi32(outA, 24)));
+        __m128i tinted = _mm_or_si128(_mm_or_si128(sr, _mm_slli_epi32(sg, 8)), _mm_or_si128(_mm_slli_epi32(sb, 16), _mm_slli_epi32(sa, 24)));
+
+        // Transparent source keeps destination, opaque source replaces it
+        __m128i transparent = _mm_cmpeq_epi32(sa, zero);
+        __m128i opaque = _mm_cmpeq_epi32(sa, c255);
+        __m128i out = _mm_or_si128(_mm_and_si128(opaque, tinted), _mm_andnot_si128(opaque, blend));
+        out = _mm_or_si128(_mm_and_si128(transparent, d), _mm_andnot_si128(transparent, out));
+
+        _mm_storeu_si128((__m128i *)(dst + i), out);
+    }
+#endif
+
+    for (; i < count; i++) dst[i] = ColorAlphaBlend(dst[i], src[i], tint);
+}
+
+// Blend premultiplied R8G8B8A8 row over R8G8B8A8 row
+// NOTE: Results match ColorAlphaBlendPremultiplied(), SIMD path processes two pixels per register in 16 bit lanes
+static void BlendRowRGBAPremultiplied(Color *dst, const Color *src, int count, Color tint)
+{
+    int i = 0;
+
+#if defined(RL_TEXTURES_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i c128 = _mm_set1_epi16(128);
+    const __m128i c255 = _mm_set1_epi16(255);
+    const __m128i factor = _mm_setr_epi16(tint.r + 1, tint.g + 1, tint.b + 1, tint.a + 1, tint.r + 1, tint.g + 1, tint.b + 1, tint.a + 1);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i d = _mm_loadu_si128((const __m128i *)(dst + i));
+
+        __m128i sLo = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(s, zero), factor), 8);
+        __m128i sHi = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), factor), 8);
+
+        // Inverse source alpha of every pixel broadcast to its channels
+        __m128i invLo = _mm_sub_epi16(c255, _mm_shufflehi_epi16(_mm_shufflelo_epi16(sLo, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3)));
+        __m128i invHi = _mm_sub_epi16(c255, _mm_shufflehi_epi16(_mm_shufflelo_epi16(sHi, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3)));
+
+        __m128i xLo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), invLo), c128);
+        __m128i xHi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), invHi), c128);
+        xLo = _mm_srli_epi16(_mm_add_epi16(xLo, _mm_srli_epi16(xLo, 8)), 8);
+        xHi = _mm_srli_epi16(_mm_add_epi16(xHi, _mm_srli_epi16(xHi, 8)), 8);
+
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_packus_epi16(_mm_add_epi16(sLo, xLo), _mm_add_epi16(sHi, xHi)));
+    }
+#endif
+
+    for (; i < count; i++) dst[i] = ColorAlphaBlendPremultiplied(dst[i], src[i], tint);
+}
+
+// Resize 8 bit per channel pixels, in splits run by worker threads for large images
+// NOTE: Layout is a stb_image_resize2 pixel layout, splits are output rows ranges giving same results as a single resize
+static void ResizePixelsLinear(const unsigned char *input, int width, int height, unsigned char *output, int newWidth, int newHeight, int layout)
+{
+    STBIR_RESIZE resize = { 0 };
+    stbir_resize_init(&resize, input, width, height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)layout, STBIR_TYPE_UINT8);
+
+    int pixels = (width*height > newWidth*newHeight)? width*height : newWidth*newHeight;
+    int threadCount = GetImageThreadCount();
+    if (threadCount > pixels/IMAGE_PARALLEL_MIN_PIXELS) threadCount = pixels/IMAGE_PARALLEL_MIN_PIXELS;
+
+    int splits = (threadCount > 1)? stbir_build_samplers_with_splits(&resize, threadCount) : 0;
+
+    if (splits > 1) ParallelFor(splits, 1, ResizeSplits, &resize);
+    else stbir_resize_extended(&resize);
+
+    stbir_free_samplers(&resize);
+}
+
+// Resize a range of splits of ResizePixelsLinear()
+static void ResizeSplits(int start, int end, void *data)
+{
+    stbir_resize_extended_split((STBIR_RESIZE *)data, start, end - start);
+}
+
+// Draw a range of rows of ImageDrawBlend()
+static void ImageDrawRows(int start, int end, void *data)
+{
+    const ImageDrawRowsData *rows = (const ImageDrawRowsData *)data;
+    bool premultiplied = (rows->blendMode == BLEND_ALPHA_PREMULTIPLY);
+    bool srcRGBA = (rows->srcFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    for (int y = start; y < end; y++)
+    {
+        unsigned char *pSrc = rows->srcBase + (size_t)y*rows->srcStride;
+        unsigned char *pDst = rows->dstBase + (size_t)y*rows->dstStride;
+
+        // Fast path: Avoid moving pixel by pixel if no blend required and same format
+        if (!rows->blendRequired && (rows->srcFormat == rows->dstFormat)) memcpy(pDst, pSrc, rows->width*rows->srcBytesPerPixel);
+        else if (rows->blendRequired && srcRGBA && (rows->dstFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+        {
+            // Fast path: R8G8B8A8 over R8G8B8A8, blended by row kernels
+            if (premultiplied) BlendRowRGBAPremultiplied((Color *)pDst, (const Color *)pSrc, rows->width, rows->tint);
+            else BlendRowRGBA((Color *)pDst, (const Color *)pSrc, rows->width, rows->tint);
+        }
+        else if (rows->blendRequired && srcRGBA && (rows->dstFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8))
+        {
+            // Fast path: R8G8B8A8 over opaque R8G8B8, blended by row kernels in chunks expanded to R8G8B8A8
+            Color chunk[PIXEL_CONVERT_CHUNK_SIZE];
+
+            for (int x = 0; x < rows->width; x += PIXEL_CONVERT_CHUNK_SIZE)
+            {
+                int count = rows->width - x;
+                if (count > PIXEL_CONVERT_CHUNK_SIZE) count = PIXEL_CONVERT_CHUNK_SIZE;
+
+                unsigned char *pChunk = pDst + x*3;
+                for (int i = 0; i < count; i++) chunk[i] = (Color){ pChunk[i*3], pChunk[i*3 + 1], pChunk[i*3 + 2], 255 };
+
+                if (premultiplied) BlendRowRGBAPremultiplied(chunk, (const Color *)pSrc + x, count, rows->tint);
+                else BlendRowRGBA(chunk, (const Color *)pSrc + x, count, rows->tint);
+
+                for (int i = 0; i < count; i++)
+                {
+                    pChunk[i*3] = chunk[i].r;
+                    pChunk[i*3 + 1] = chunk[i].g;
+                    pChunk[i*3 + 2] = chunk[i].b;
+                }
+            }
+        }
+        else
+        {
+            for (int x = 0; x < rows->width; x++)
+            {
+                Color colSrc = GetPixelColor(pSrc, rows->srcFormat);
+                Color colDst = GetPixelColor(pDst, rows->dstFormat);
+                Color blend = colSrc;
+
+                // Fast path: Avoid blend if source has no alpha to blend
+                if (rows->blendRequired)
+                {
+                    if (premultiplied) blend = ColorAlphaBlendPremultiplied(colDst, colSrc, rows->tint);
+                    else blend = ColorAlphaBlend(colDst, colSrc, rows->tint);
+                }
+
+                SetPixelColor(pDst, blend, rows->dstFormat);
+
+                pDst += rows->dstBytesPerPixel;
+                pSrc += rows->srcBytesPerPixel;
+            }
+        }
+    }
+}
+
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+// Apply per channel color operation to a channel value
+// NOTE: Results match previous ImageColorTint(), ImageColorInvert(), ImageColorContrast() and ImageColorBrightness()
+// applied on R8G8B8A8 pixels, only tint modifies alpha
+static unsigned char ApplyColorOpChannel(ImageColorOp op, int channel, unsigned char value)
+{
+    unsigned char result = value;
+
+    switch (op.type)
+    {
+        case IMAGE_COLOR_TINT:
+        {
+            unsigned char tint = (channel == 0)? op.color.r : (channel == 1)? op.color.g : (channel == 2)? op.color.b : op.color.a;
+            float factor = (float)tint/255;
+
+            result = (unsigned char)(((float)value/255*factor)*255.0f);
+        } break;
+        case IMAGE_COLOR_INVERT: if (channel < 3) result = 255 - value; break;
+        case IMAGE_COLOR_CONTRAST:
+        {
+            if (channel < 3)
+            {
+                float contrast = op.value;
+                if (contrast < -100) contrast = -100;
+                if (contrast > 100) contrast = 100;
+
+                contrast = (100.0f + contrast)/100.0f;
+                contrast *= contrast;
+
+                float pixel = (float)value/255.0f;
+                pixel -= 0.5f;
+                pixel *= contrast;
+                pixel += 0.5f;
+                pixel *= 255;
+                if (pixel < 0) pixel = 0;
+                if (pixel > 255) pixel = 255;
+
+                result = (unsigned char)pixel;
+            }
+        } break;
+        case IMAGE_COLOR_BRIGHTNESS:
+        {
+            if (channel < 3)
+            {
+                int brightness = (int)op.value;
+                if (brightness < -255) brightness = -255;
+                if (brightness > 255) brightness = 255;
+
+                // NOTE: Negative results are set to 1, as ImageColorBrightness() always did
+                int pixel = value + brightness;
+                if (pixel < 0) pixel = 1;
+                if (pixel > 255) pixel = 255;
+
+                result = (unsigned char)pixel;
+            }
+        } break;
+        default: break;
+    }
+
+    return result;
+}
+
+// Apply color operations stages to pixels
+static void ApplyColorStages(Color *pixels, int count, const ImageColorRowsData *rows)
+{
+    for (int s = 0; s < rows->stageCount; s++)
+    {
+        const ImageColorStage *stage = &rows->stages[s];
+
+        switch (stage->type)
+        {
+            case IMAGE_COLOR_TINT:
+            {
+                for (int i = 0; i < count; i++)
+                {
+                    pixels[i].r = stage->table[0][pixels[i].r];
+                    pixels[i].g = stage->table[1][pixels[i].g];
+                    pixels[i].b = stage->table[2][pixels[i].b];
+                    pixels[i].a = stage->table[3][pixels[i].a];
+                }
+            } break;
+            case IMAGE_COLOR_GRAYSCALE:
+            {
+                for (int i = 0; i < count; i++)
+                {
+                    unsigned char gray = (unsigned char)((rows->gray[0][pixels[i].r] + rows->gray[1][pixels[i].g] + rows->gray[2][pixels[i].b])*255.0f);
+
+                    pixels[i].r = gray;
+                    pixels[i].g = gray;
+                    pixels[i].b = gray;
+                }
+            } break;
+            case IMAGE_COLOR_REPLACE:
+            {
+                for (int i = 0; i < count; i++)
+                {
+                    if ((pixels[i].r == stage->color.r) && (pixels[i].g == stage->color.g) &&
+                        (pixels[i].b == stage->color.b) && (pixels[i].a == stage->color.a)) pixels[i] = stage->replace;
+                }
+            } break;
+            default: break;
+        }
+    }
+}
+
+// Apply color operations to a range of rows of ImageColorOps()
+// NOTE: Pixels are processed in chunks, all stages are applied to a chunk while it is in cache, formats
+// other than R8G8B8A8 are converted to R8G8B8A8 and back as ImageFormat() does, or with GetPixelColor()
+// and SetPixelColor() for formats over 8 bit per channel
+static void ImageColorRows(int start, int end, void *data)
+{
+    const ImageColorRowsData *rows = (const ImageColorRowsData *)data;
+    Color chunk[PIXEL_CONVERT_CHUNK_SIZE];
+
+    for (int y = start; y < end; y++)
+    {
+        unsigned char *row = rows->data + (size_t)y*rows->stride;
+
+        for (int x = 0; x < rows->width; x += PIXEL_CONVERT_CHUNK_SIZE)
+        {
+            int count = rows->width - x;
+            if (count > PIXEL_CONVERT_CHUNK_SIZE) count = PIXEL_CONVERT_CHUNK_SIZE;
+
+            unsigned char *pixels = row + x*rows->bytesPerPixel;
+
+            if (rows->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) ApplyColorStages((Color *)pixels, count, rows);
+            else if (rows->toColors != NULL)
+            {
+                int converted = ConvertPixelsKernel(pixels, rows->format, chunk, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, count);
+                ConvertPixelsTables(pixels, rows->format, chunk, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, converted, count - converted, rows->toColors);
+
+                ApplyColorStages(chunk, count, rows);
+
+                converted = ConvertPixelsKernel(chunk, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, pixels, rows->format, count);
+                ConvertPixelsTables(chunk, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, pixels, rows->format, converted, count - converted, rows->fromColors);
+            }
+            else
+            {
+                for (int i = 0; i < count; i++) chunk[i] = GetPixelColor(pixels + i*rows->bytesPerPixel, rows->format);
+
+                ApplyColorStages(chunk, count, rows);
+
+                for (int i = 0; i < count; i++) SetPixelColor(pixels + i*rows->bytesPerPixel, chunk[i], rows->format);
+            }
+        }
+    }
+}
+
+// Downsample a range of rows by 2 with a box filter, for ImageMipmaps()
+// NOTE: Every destination channel is the rounded average of a 2x2 source block, as GPU mipmaps generation does,
+// source dimensions of 1 pixel are not reduced, so the block is 2x1, 1x2 or the same pixel
+static void DownsampleBoxRows(int start, int end, void *data)
+{
+    const ImageBoxRowsData *rows = (const ImageBoxRowsData *)data;
+    int channels = rows->channels;
+    int srcStride = rows->srcWidth*channels;
+    int stepX = (rows->srcWidth > 1)? channels : 0;          // Offset of the right pixel of a block
+    int stepY = (rows->srcHeight > 1)? srcStride : 0;        // Offset of the bottom row of a block
+
+    for (int y = start; y < end; y++)
+    {
+        const unsigned char *src = rows->src + (size_t)y*((stepY > 0)? 2 : 1)*srcStride;
+        unsigned char *dst = rows->dst + (size_t)y*rows->dstWidth*channels;
+
+        for (int x = 0; x < rows->dstWidth; x++)
+        {
+            for (int c = 0; c < channels; c++) dst[c] = (unsigned char)((src[c] + src[c + stepX] + src[c + stepY] + src[c + stepX + stepY] + 2) >> 2);
+
+            src += (stepX > 0)? 2*channels : channels;
+            dst += channels;
+        }
+    }
+}
+#endif      // SUPPORT_IMAGE_MANIPULATION
+
+#if defined(SUPPORT_IMAGE_GENERATION)
+// Init generation rows data for a region of an image, allocating region pixels
+// NOTE: Region is clamped to image bounds, returns false if empty
+static bool InitImageGenRows(ImageGenRowsData *rows, int width, int height, Rectangle rec)
+{
+    int x0 = (int)rec.x;
+    int y0 = (int)rec.y;
+    int x1 = (int)rec.x + (int)rec.width;
+    int y1 = (int)rec.y + (int)rec.height;
+
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > width) x1 = width;
+    if (y1 > height) y1 = height;
+
+    if ((x1 <= x0) || (y1 <= y0))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Generation region out of image bounds");
+        return false;
+    }
+
+    rows->width = width;
+    rows->height = height;
+    rows->recX = x0;
+    rows->recY = y0;
+    rows->recWidth = x1 - x0;
+    rows->recHeight = y1 - y0;
+    rows->pixels = (Color *)RL_MALLOC((size_t)rows->recWidth*rows->recHeight*sizeof(Color));
+
+    return true;
+}
+
+// Hash a value into noise bits
+// NOTE: Integer hash with good avalanche, by Chris Wellons (lowbias32)
+static unsigned int HashNoise(unsigned int x)
+{
+    x ^= x >> 16;
+    x *= 0x7feb352d;
+    x ^= x >> 15;
+    x *= 0x846ca68b;
+    x ^= x >> 16;
+
+    return x;
+}
+
+// Generate a range of rows of white noise
+static void GenWhiteNoiseRows(int start, int end, void *data)
+{
+    const ImageGenRowsData *rows = (const ImageGenRowsData *)data;
+    int threshold = (int)(rows->factor*100.0f);
+
+    for (int y = start; y < end; y++)
+    {
+        Color *pixels = rows->pixels + (size_t)y*rows->recWidth;
+        unsigned int rowHash = HashNoise((unsigned int)(rows->recY + y) ^ HashNoise(rows->seed));
+
+        for (int x = 0; x < rows->recWidth; x++)
+        {
+            unsigned int hash = HashNoise((unsigned int)(rows->recX + x) ^ rowHash);
+
+            if ((int)(hash%100) < threshold) pixels[x] = WHITE;
+            else pixels[x] = BLACK;
+        }
+    }
+}
+
+// Generate a range of rows of perlin noise
+static void GenPerlinNoiseRows(int start, int end, void *data)
+{
+    const ImageGenRowsData *rows = (const ImageGenRowsData *)data;
+
+    for (int y = start; y < end; y++)
+    {
+        Color *pixels = rows->pixels + (size_t)y*rows->recWidth;
+        float ny = (float)(rows->recY + y + rows->offsetY)*(rows->scale/(float)rows->height);
+
+        for (int x = 0; x < rows->recWidth; x++)
+        {
+            float nx = (float)(rows->recX + x + rows->offsetX)*(rows->scale/(float)rows->width);
+
+            // Basic perlin noise implementation (not used)
+            //float p = (stb_perlin_noise3(nx, ny, 0.0f, 0, 0, 0);
+
+            // Calculate a better perlin noise using fbm (fractal brownian motion)
+            // Typical values to start playing with:
+            //   lacunarity = ~2.0   -- spacing between successive octaves (use exactly 2.0 for wrapping output)
+            //   gain       =  0.5   -- relative weighting applied to each successive octave
+            //   octaves    =  6     -- number of "octaves" of noise3() to sum
+            float p = stb_perlin_fbm_noise3(nx, ny, 1.0f, 2.0f, 0.5f, 6);
+
+            // Clamp between -1.0f and 1.0f
+            if (p < -1.0f) p = -1.0f;
+            if (p > 1.0f) p = 1.0f;
+
+            // We need to normalize the data from [-1..1] to [0..1]
+            float np = (p + 1.0f)/2.0f;
+
+            int intensity = (int)(np*255.0f);
+            pixels[x] = (Color){ intensity, intensity, intensity, 255 };
+        }
+    }
+}
+
+// Generate a range of rows of cellular noise
+// NOTE: Pixels check seeds of their cell and adjacent cells (grid search), comparing squared
+// integer distances, only the nearest distance is square rooted
+static void GenCellularRows(int start, int end, void *data)
+{
+    const ImageGenRowsData *rows = (const ImageGenRowsData *)data;
+    int tileSize = rows->tileSize;
+
+    for (int y = start; y < end; y++)
+    {
+        Color *pixels = rows->pixels + (size_t)y*rows->recWidth;
+        int py = rows->recY + y;
+        int tileY = py/tileSize;
+
+        for (int x = 0; x < rows->recWidth; x++)
+        {
+            int px = rows->recX + x;
+            int tileX = px/tileSize;
+            int minDistanceSqr = -1;
+
+            // Check all adjacent tiles
+            for (int j = -1; j < 2; j++)
+            {
+                if ((tileY + j < 0) || (tileY + j >= rows->cellsPerCol)) continue;
+
+                const Vector2 *seedsRow = rows->seeds + (tileY + j - rows->seedsY)*rows->seedsPerRow - rows->seedsX;
+
+                for (int i = -1; i < 2; i++)
+                {
+                    if ((tileX + i < 0) || (tileX + i >= rows->cellsPerRow)) continue;
+
+                    Vector2 neighborSeed = seedsRow[tileX + i];
+                    int dx = px - (int)neighborSeed.x;
+                    int dy = py - (int)neighborSeed.y;
+                    int distanceSqr = dx*dx + dy*dy;
+
+                    if ((minDistanceSqr < 0) || (distanceSqr < minDistanceSqr)) minDistanceSqr = distanceSqr;
+                }
+            }
+
+            float minDistance = (minDistanceSqr < 0)? 65536.0f : (float)sqrt((double)minDistanceSqr);
+
+            // I made this up, but it seems to give good results at all tile sizes
+            int intensity = (int)(minDistance*256.0f/tileSize);
+            if (intensity > 255) intensity = 255;
+
+            pixels[x] = (Color){ intensity, intensity, intensity, 255 };
+        }
+    }
+}
+#endif      // SUPPORT_IMAGE_GENERATION
+
 #endif      // SUPPORT_MODULE_RTEXTURES
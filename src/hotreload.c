@@ -0,0 +1,55 @@
+#include <stdio.h>
+#include <dlfcn.h>
+#include <sys/stat.h>
+
+#include "raylib.h"
+#include "hotreload.h"
+
+// nob.c builds the plug in there, see append_plug_cmd and watch_plug_linux which rebuilds it
+static const char *libplug_file_name = "./build/libplug.so";
+static void *libplug = NULL;
+
+// Identity of the libplug.so that is loaded. nob replaces it through a rename, so a new build is a new
+// inode even when it lands within the same second as the previous one.
+static struct stat libplug_stat = {0};
+
+#define PLUG(name, ...) name##_t *name = NULL;
+LIST_OF_PLUGS
+#undef PLUG
+
+bool reload_libplug(void)
+{
+    if (libplug != NULL) dlclose(libplug);
+
+    if (stat(libplug_file_name, &libplug_stat) < 0) {
+        TraceLog(LOG_ERROR, "HOTRELOAD: could not find %s", libplug_file_name);
+        return false;
+    }
+
+    libplug = dlopen(libplug_file_name, RTLD_NOW);
+    if (libplug == NULL) {
+        TraceLog(LOG_ERROR, "HOTRELOAD: could not load %s: %s", libplug_file_name, dlerror());
+        return false;
+    }
+
+    #define PLUG(name, ...)                                                                  \
+        name = dlsym(libplug, #name);                                                        \
+        if (name == NULL) {                                                                  \
+            TraceLog(LOG_ERROR, "HOTRELOAD: could not find %s symbol in %s: %s",             \
+                     #name, libplug_file_name, dlerror());                                   \
+            return false;                                                                    \
+        }
+    LIST_OF_PLUGS
+    #undef PLUG
+
+    TraceLog(LOG_INFO, "HOTRELOAD: loaded %s", libplug_file_name);
+    return true;
+}
+
+// Polled by the host every frame, a stat is cheap enough for that
+bool libplug_changed(void)
+{
+    struct stat st = {0};
+    if (stat(libplug_file_name, &st) < 0) return false; // in the middle of being replaced
+    return st.st_ino != libplug_stat.st_ino || st.st_mtime != libplug_stat.st_mtime;
+}
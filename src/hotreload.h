@@ -0,0 +1,24 @@
+#ifndef HOTRELOAD_H_
+#define HOTRELOAD_H_
+
+#include <stdbool.h>
+
+#include "plug.h"
+
+#ifdef HOTRELOAD
+    #define PLUG(name, ...) extern name##_t *name;
+    LIST_OF_PLUGS
+    #undef PLUG
+
+    bool reload_libplug(void);
+    bool libplug_changed(void);
+#else
+    #define PLUG(name, ...) name##_t name;
+    LIST_OF_PLUGS
+    #undef PLUG
+
+    #define reload_libplug() true
+    #define libplug_changed() false
+#endif
+
+#endif // HOTRELOAD_H_
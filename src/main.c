@@ -1,16 +1,31 @@
 #include "raylib.h"
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
-int main()
+#include "hotreload.h"
+
+int main(int argc, char **argv)
 {
     const int width  = 500;
     const int height = 500;
+
+    // `--frames N` closes the window on its own after N frames, nob uses it for training runs
+    int max_frames = -1;
+    if (argc == 3 && strcmp(argv[1], "--frames") == 0) max_frames = atoi(argv[2]);
+
     InitWindow(width, height, "hello from raylib");
+    if (!reload_libplug()) return 1;
+    plug_init();
 
-    while(!WindowShouldClose()) {
-        BeginDrawing();
-            ClearBackground(BLUE);
-        EndDrawing();
+    int frame = 0;
+    while(!WindowShouldClose() && frame++ != max_frames) {
+        if (libplug_changed()) {
+            void *state = plug_pre_reload();
+            if (!reload_libplug()) return 1;
+            plug_post_reload(state);
+        }
+        plug_update();
     }
     CloseWindow();
     return 0;
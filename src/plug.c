@@ -0,0 +1,38 @@
+#include <stdlib.h>
+#include <assert.h>
+
+#include "raylib.h"
+#include "plug.h"
+
+// Everything that has to survive a reload lives in here. Changing its layout needs a restart of the host.
+typedef struct {
+    float time;
+} Plug;
+
+static Plug *p = NULL;
+
+void plug_init(void)
+{
+    p = calloc(1, sizeof(*p));
+    assert(p != NULL && "Buy more RAM lol");
+}
+
+void *plug_pre_reload(void)
+{
+    return p;
+}
+
+void plug_post_reload(void *state)
+{
+    p = state;
+}
+
+void plug_update(void)
+{
+    p->time += GetFrameTime();
+
+    BeginDrawing();
+        ClearBackground(BLUE);
+        DrawText(TextFormat("%.1f", p->time), 10, 10, 20, RAYWHITE);
+    EndDrawing();
+}
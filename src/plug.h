@@ -0,0 +1,16 @@
+#ifndef PLUG_H_
+#define PLUG_H_
+
+// Everything the host calls into the game logic. With -DHOTRELOAD these are looked up in libplug.so and
+// reloaded whenever it changes, otherwise plug.c is linked into the executable like any other file.
+#define LIST_OF_PLUGS                                                                                      \
+    PLUG(plug_init, void, void)               /* Create the state of the game, called once */           \
+    PLUG(plug_pre_reload, void*, void)        /* Hand the state over to the host before unloading */    \
+    PLUG(plug_post_reload, void, void*)       /* Take the state back after loading the new version */   \
+    PLUG(plug_update, void, void)             /* Update and draw one frame */
+
+#define PLUG(name, ret, ...) typedef ret (name##_t)(__VA_ARGS__);
+LIST_OF_PLUGS
+#undef PLUG
+
+#endif // PLUG_H_